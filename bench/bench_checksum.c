@@ -0,0 +1,344 @@
+// -*- coding: utf-8 -*-
+// vim:fileencoding=utf-8
+/**
+@file bench_checksum.c
+@author Devyn Collier Johnson <DevynCJohnson@Gmail.com>
+@copyright LGPLv3
+
+@brief Checksum Benchmark
+@version 2016.03.20
+
+@section DESCRIPTION
+Measures the throughput (GB/s) and cost (TSC cycles per byte) of every checksum in cryptx.h over message sizes from 16 B up to 1 GiB (by powers of four), for aligned and unaligned starts, with a hot cache and with the message flushed from the cache before every call;
+Results are printed as CSV (default) or JSON; The `value` column holds the checksum itself, so that a changed result shows up next to a changed speed
+
+Usage: bench_checksum [-j] [-m max_MiB] [-a algorithms] [-r min_seconds]
+
+@section LICENSE
+GNU Lesser General Public License v3
+Copyright (c) Devyn Collier Johnson, All rights reserved.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 3.0 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library.
+*/
+
+
+#include "cryptx.h"
+#include "x86_64_asm_func.h"
+#include <time.h>
+
+
+#if (defined(ENV64BIT) && (defined(__x86_64__) || defined(__x86_64)))
+#   define BENCH_HAVE_TSC  // Cycles come from `rdtsc()`; They are reference (TSC) cycles, not core cycles
+#endif
+#define BENCH_MIN_SIZE   (16)
+#define BENCH_HOT_BATCH   (0x10000)  // Bytes checksummed between clock reads on a hot cache
+#define BENCH_EVICT_SIZE   (0x4000000)  // Bytes written to push a message out of the cache without `clflush`
+#define BENCH_NEEDS_SSE42   (0x01)
+#define BENCH_NEEDS_PCLMUL   (0x02)
+
+
+/** Keep the compiler from merging calls with identical arguments (several checksums are declared `const` or `pure`) */
+#define BENCH_OPAQUE(ptr)   __asm__ volatile ("" : "+r" ( ptr ))
+
+
+/* DATATYPES */
+
+
+/** One checksum under test; `width` is the element size that the function counts in */
+typedef struct bench_algorithm {
+    const char *name;
+    uint64_t (*func)(const uint8_t *data, const size_t len);
+    size_t width;
+    unsigned int needs;  // BENCH_NEEDS_* flags
+    unsigned int reserved;  // Rounds the entry up to a multiple of 8 bytes
+} bench_algorithm;
+
+
+/** Result of one measurement */
+typedef struct bench_result {
+    uint64_t runs;
+    uint64_t value;  // Checksum of the message
+    double gbps;
+    double cycles_per_byte;  // Zero without a TSC
+} bench_result;
+
+
+/* WRAPPERS */
+
+
+static uint64_t bench_crc8(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return crc8(data, len); }
+static uint64_t bench_crc8portable(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return crc8portable(data, (uint32_t)len); }
+static uint64_t bench_crc16(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return crc16(data, len); }
+static uint64_t bench_crc16mem(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return crc16mem((const uint16_t *)NULL, data, (uint32_t)len); }
+static uint64_t bench_crc32(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return crc32(0x0, data, len); }
+static uint64_t bench_crc32_slice8(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return crc32_slice8(0x0, data, len); }
+static uint64_t bench_crc32_slice16(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return crc32_slice16(0x0, data, len); }
+#ifdef CRYPTX_X86_DISPATCH
+static uint64_t bench_crc32_clmul(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return crc32_clmul(0x0, data, len); }
+static uint64_t bench_crc32c_hw(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return crc32c_final(crc32c_hw(crc32c_init(), data, len)); }
+#endif
+static uint64_t bench_crc32c_sw(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return crc32c_final(crc32c_sw(crc32c_init(), data, len)); }
+static uint64_t bench_crc32c(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return crc32c(data, len); }
+#ifdef INTEL64
+static uint64_t bench_fastcrc32(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return fastcrc32((char *)(uintptr_t)data, (uint32_t)len); }
+#endif
+static uint64_t bench_adler8(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return adler8(data, len); }
+static uint64_t bench_adler16(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return adler16(data, len); }
+static uint64_t bench_adler32(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return adler32(data, len); }
+static uint64_t bench_adler64(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return adler64(data, len); }
+static uint64_t bench_antiadler64(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return antiadler64(data, len); }
+static uint64_t bench_antiadler64rev2(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return antiadler64rev2(data, len); }
+#ifdef UINT128_SUPPORTED
+static uint64_t bench_adler128(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return (uint64_t)adler128(data, len); }
+#endif
+static uint64_t bench_fletcher8(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return fletcher8(data, len); }
+static uint64_t bench_fletcher16(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return fletcher16(data, len); }
+static uint64_t bench_fletcher16fast(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return fletcher16fast(data, len); }
+static uint64_t bench_fletcher32(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return fletcher32((const uint16_t *)(const void *)data, (len >> 1)); }
+static uint64_t bench_fletcher32fast(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return fletcher32fast((const uint16_t *)(const void *)data, (len >> 1)); }
+static uint64_t bench_fletcher64(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return fletcher64((const uint32_t *)(const void *)data, (len >> 2)); }
+static uint64_t bench_fletcher64char(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return fletcher64char(data, len); }
+static uint64_t bench_collier32(const uint8_t *data, const size_t len) { BENCH_OPAQUE(data); return collier32((const uint16_t *)(const void *)data, (len >> 1)); }
+
+
+/** Streaming API in MTU-sized pieces, to show the cost of `checksum_update()` against the one-shot functions */
+static uint64_t bench_stream_adler32(const uint8_t *data, const size_t len) {
+    static checksum_ctx ctx;  // Static, since its 4-byte `pending` array is too small for the stack protector; `checksum_init()` resets it on every call
+    size_t pos;
+    BENCH_OPAQUE(data);
+    (void)checksum_init(&ctx, CHECKSUM_ADLER32);
+    for (pos = 0x00; pos < len; pos += 1500) checksum_update(&ctx, data + pos, (((len - pos) < 1500) ? (len - pos) : 1500));
+    return checksum_final(&ctx);
+}
+
+
+static const bench_algorithm bench_algorithms[] = {
+    { "crc8", bench_crc8, 0x01, 0x00, 0x00 },
+    { "crc8portable", bench_crc8portable, 0x01, 0x00, 0x00 },
+    { "crc16", bench_crc16, 0x01, 0x00, 0x00 },
+    { "crc16mem", bench_crc16mem, 0x01, 0x00, 0x00 },
+    { "crc32", bench_crc32, 0x01, 0x00, 0x00 },
+    { "crc32_slice8", bench_crc32_slice8, 0x01, 0x00, 0x00 },
+    { "crc32_slice16", bench_crc32_slice16, 0x01, 0x00, 0x00 },
+#ifdef CRYPTX_X86_DISPATCH
+    { "crc32_clmul", bench_crc32_clmul, 0x01, BENCH_NEEDS_PCLMUL, 0x00 },
+    { "crc32c_hw", bench_crc32c_hw, 0x01, BENCH_NEEDS_SSE42, 0x00 },
+#endif
+    { "crc32c_sw", bench_crc32c_sw, 0x01, 0x00, 0x00 },
+    { "crc32c", bench_crc32c, 0x01, 0x00, 0x00 },
+#ifdef INTEL64
+    { "fastcrc32", bench_fastcrc32, 0x01, BENCH_NEEDS_SSE42, 0x00 },
+#endif
+    { "adler8", bench_adler8, 0x01, 0x00, 0x00 },
+    { "adler16", bench_adler16, 0x01, 0x00, 0x00 },
+    { "adler32", bench_adler32, 0x01, 0x00, 0x00 },
+    { "adler64", bench_adler64, 0x01, 0x00, 0x00 },
+    { "antiadler64", bench_antiadler64, 0x01, 0x00, 0x00 },
+    { "antiadler64rev2", bench_antiadler64rev2, 0x01, 0x00, 0x00 },
+#ifdef UINT128_SUPPORTED
+    { "adler128", bench_adler128, 0x01, 0x00, 0x00 },
+#endif
+    { "fletcher8", bench_fletcher8, 0x01, 0x00, 0x00 },
+    { "fletcher16", bench_fletcher16, 0x01, 0x00, 0x00 },
+    { "fletcher16fast", bench_fletcher16fast, 0x01, 0x00, 0x00 },
+    { "fletcher32", bench_fletcher32, 0x02, 0x00, 0x00 },
+    { "fletcher32fast", bench_fletcher32fast, 0x02, 0x00, 0x00 },
+    { "fletcher64", bench_fletcher64, 0x04, 0x00, 0x00 },
+    { "fletcher64char", bench_fletcher64char, 0x01, 0x00, 0x00 },
+    { "collier32", bench_collier32, 0x02, 0x00, 0x00 },
+    { "stream_adler32", bench_stream_adler32, 0x01, 0x00, 0x00 }
+};
+
+
+/* FUNCTIONS */
+
+
+/** Seconds on a monotonic clock */
+static double bench_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9));
+}
+
+
+/** TSC ticks, or zero without a TSC */
+static uint64_t bench_ticks(void) {
+#ifdef BENCH_HAVE_TSC
+    return (uint64_t)rdtsc();
+#else
+    return 0x00;
+#endif
+}
+
+
+/** TSC ticks per second, measured against the monotonic clock (zero without a TSC) */
+static double bench_tsc_rate(void) {
+    const double start = bench_now();
+    const uint64_t ticks = bench_ticks();
+    double elapsed;
+    do { elapsed = (bench_now() - start); } while (elapsed < 0.05);
+    return ((double)(bench_ticks() - ticks) / elapsed);
+}
+
+
+/** Small deterministic PRNG (xorshift64*) so every run checksums the same message */
+static uint64_t bench_rand(uint64_t *state) {
+    *state ^= (*state >> 12);
+    *state ^= (*state << 25);
+    *state ^= (*state >> 27);
+    return (*state * 0x2545F4914F6CDD1DULL);
+}
+
+
+/** Return non-zero if the CPU can run `algo` */
+static int bench_supported(const bench_algorithm *algo) {
+#ifdef CRYPTX_X86_DISPATCH
+    if ((algo->needs & BENCH_NEEDS_SSE42) && !__builtin_cpu_supports("sse4.2")) return 0x00;
+    if ((algo->needs & BENCH_NEEDS_PCLMUL) && !(__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1"))) return 0x00;
+    return 0x01;
+#else
+    return (algo->needs == 0x00);
+#endif
+}
+
+
+/** Push a message out of every cache level */
+static void bench_evict(const uint8_t *data, const size_t len, uint8_t *scratch) {
+#ifdef CRYPTX_X86_DISPATCH
+    size_t pos;
+    (void)scratch;
+    for (pos = 0x00; pos < len; pos += 64) _mm_clflush(data + pos);
+    _mm_clflush(data + len - 0x01);
+    _mm_mfence();
+#else
+    (void)data;
+    (void)len;
+    memset(scratch, (int)(bench_now() * 1e3), BENCH_EVICT_SIZE);
+#endif
+}
+
+
+/** Checksum `len` bytes at `data` for at least `min_time` seconds; A cold measurement flushes the message before every (separately timed) call */
+static void bench_measure(const bench_algorithm *algo, const uint8_t *data, const size_t len, const int cold, const double min_time, const double tsc_rate, uint8_t *scratch, bench_result *result) {
+    const size_t batch = ((len >= BENCH_HOT_BATCH) ? 0x01 : (BENCH_HOT_BATCH / len));
+    uint64_t ticks = 0x00, start_ticks, runs = 0x00;
+    double seconds = 0.0, start, wall;
+    size_t index;
+    memset(result, 0x00, sizeof(bench_result));
+    result->value = algo->func(data, len);  // Also warms the cache and the branch predictors
+    wall = bench_now();
+    do {
+        if (cold) {
+            bench_evict(data, len, scratch);
+            start = bench_now();
+            start_ticks = bench_ticks();
+            (void)algo->func(data, len);
+            ticks += (bench_ticks() - start_ticks);
+            seconds += (bench_now() - start);
+            ++runs;
+        } else {
+            start = bench_now();
+            start_ticks = bench_ticks();
+            for (index = 0x00; index < batch; ++index) (void)algo->func(data, len);
+            ticks += (bench_ticks() - start_ticks);
+            seconds += (bench_now() - start);
+            runs += batch;
+        }
+    } while ((bench_now() - wall) < min_time);
+    result->runs = runs;
+    if (tsc_rate > 0.0 && ticks != 0x00) seconds = ((double)ticks / tsc_rate);  // Finer than the clock for single cold calls
+    result->gbps = (((double)len * (double)runs) / (seconds * 1e9));
+    result->cycles_per_byte = ((double)ticks / ((double)len * (double)runs));
+}
+
+
+/** Return non-zero if `name` appears in the comma-separated `list` (a NULL list selects everything) */
+static int bench_selected(const char *list, const char *name) {
+    const size_t len = strlen(name);
+    const char *pos;
+    if (list == (const char *)NULL) return 0x01;
+    for (pos = list; *pos != '\0'; ++pos) {
+        if (strncmp(pos, name, len) == 0x00 && (pos[len] == ',' || pos[len] == '\0')) return 0x01;
+        pos = strchr(pos, ',');
+        if (pos == (const char *)NULL) break;
+    }
+    return 0x00;
+}
+
+
+/** Print one result row */
+static void bench_print(const int json, const int first, const char *name, const size_t len, const size_t offset, const int cold, const bench_result *result) {
+    if (json) {
+        printf("%s\n  {\"algorithm\": \"%s\", \"bytes\": %zu, \"offset\": %zu, \"cache\": \"%s\", \"runs\": %llu, \"gb_per_s\": %.4f, \"cycles_per_byte\": %.4f, \"value\": \"0x%016llx\"}", (first ? "" : ","), name, len, offset, (cold ? "cold" : "hot"), (unsigned long long)result->runs, result->gbps, result->cycles_per_byte, (unsigned long long)result->value);
+    } else {
+        printf("%s,%zu,%zu,%s,%llu,%.4f,%.4f,0x%016llx\n", name, len, offset, (cold ? "cold" : "hot"), (unsigned long long)result->runs, result->gbps, result->cycles_per_byte, (unsigned long long)result->value);
+    }
+    fflush(stdout);
+}
+
+
+int main(int argc, char *argv[]) {
+    const size_t nalgorithms = (sizeof(bench_algorithms) / sizeof(bench_algorithms[0]));
+    size_t max_size = ((size_t)1024 << 20), len, pos, a;
+    const char *only = (const char *)NULL;
+    double min_time = 0.05;
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    uint8_t *block = (uint8_t *)NULL, *base, *scratch = (uint8_t *)NULL;
+    int json = 0x00, first = 0x01, argi, aligned, cold;
+    for (argi = 0x01; argi < argc; argi++) {
+        const char opt = ((argv[argi][0] == '-') ? argv[argi][1] : '\0');
+        if (opt == 'j') json = 0x01;
+        else if ((argi + 1) < argc && opt == 'm') max_size = ((size_t)strtoul(argv[++argi], NULL, 10) << 20);
+        else if ((argi + 1) < argc && opt == 'a') only = argv[++argi];
+        else if ((argi + 1) < argc && opt == 'r') min_time = strtod(argv[++argi], NULL);
+        else {
+            fprintf(stderr, "Usage: %s [-j] [-m max_MiB] [-a algorithms] [-r min_seconds]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (max_size < BENCH_MIN_SIZE) max_size = BENCH_MIN_SIZE;
+    while (max_size >= BENCH_MIN_SIZE && (block = (uint8_t *)malloc(max_size + 128)) == (uint8_t *)NULL) max_size >>= 1;
+    if (block == (uint8_t *)NULL) return EXIT_FAILURE;
+#ifndef CRYPTX_X86_DISPATCH
+    scratch = (uint8_t *)malloc(BENCH_EVICT_SIZE);
+    if (scratch == (uint8_t *)NULL) return EXIT_FAILURE;
+#endif
+    base = (uint8_t *)(((uintptr_t)block + 63) & ~(uintptr_t)63);
+    for (pos = 0x00; pos < (max_size + 64); pos += sizeof(uint64_t)) {
+        const uint64_t val = bench_rand(&state);
+        memcpy(base + pos, &val, sizeof(val));
+    }
+    const double tsc_rate = bench_tsc_rate();
+    if (json) fputs("[", stdout);
+    else puts("algorithm,bytes,offset,cache,runs,gb_per_s,cycles_per_byte,value");
+    for (a = 0x00; a < nalgorithms; a++) {
+        const bench_algorithm *algo = &bench_algorithms[a];
+        if (!bench_selected(only, algo->name) || !bench_supported(algo)) continue;
+        for (len = BENCH_MIN_SIZE; len <= max_size; len <<= 2) {
+            for (aligned = 0x01; aligned >= 0x00; aligned--) {
+                const size_t offset = (aligned ? 0x00 : algo->width);  // Off the cache line and vector boundaries, but on an element boundary
+                for (cold = 0x00; cold <= 0x01; cold++) {
+                    bench_result result;
+                    bench_measure(algo, base + offset, len, cold, min_time, tsc_rate, scratch, &result);
+                    bench_print(json, first, algo->name, len, offset, cold, &result);
+                    first = 0x00;
+                }
+            }
+        }
+    }
+    if (json) puts("\n]");
+    free(scratch);
+    free(block);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,410 @@
+// -*- coding: utf-8 -*-
+// vim:fileencoding=utf-8
+/**
+@file bench_compression.c
+@author Devyn Collier Johnson <DevynCJohnson@Gmail.com>
+@copyright LGPLv3
+
+@brief Compression Benchmark
+@version 2016.03.20
+
+@section DESCRIPTION
+Measures compression and decompression throughput, compression ratio, and peak memory use over synthetic corpora (random, text, logs, zeros) and user-supplied files, for every combination of codec, level, and buffer size;
+Results are printed as CSV (default) or JSON
+
+Usage: bench_compression [-j] [-s MiB] [-l levels] [-b buffer_sizes] [-r min_seconds] [FILE...]
+
+@section LICENSE
+GNU Lesser General Public License v3
+Copyright (c) Devyn Collier Johnson, All rights reserved.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 3.0 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library.
+*/
+
+
+#include "compression.h"
+#include <time.h>
+#ifdef OSPOSIX
+#   include <sys/resource.h>
+#   include <sys/wait.h>
+#   include <unistd.h>
+#endif
+
+
+#define BENCH_MAX_LIST   (16)  // Most levels or buffer sizes accepted on the command line
+
+
+/* DATATYPES */
+
+
+/** Input data for one set of measurements */
+typedef struct bench_corpus {
+    const char *name;
+    uint8_t *data;
+    size_t len;
+} bench_corpus;
+
+
+/** Result of one measurement */
+typedef struct bench_result {
+    size_t out_len;  // Compressed size
+    double compress_mbps;
+    double decompress_mbps;
+    long peak_rss_kb;  // Peak resident set size of the measuring process (zero if unknown)
+    int ret;  // Z_OK, or the error that stopped the measurement
+    int reserved;  // Pads the struct to a multiple of its 8-byte alignment
+} bench_result;
+
+
+/* FUNCTIONS */
+
+
+/** Seconds on a monotonic clock */
+static double bench_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9));
+}
+
+
+/** Small deterministic PRNG (xorshift64*) so every run sees the same corpora */
+static uint64_t bench_rand(uint64_t *state) {
+    *state ^= (*state >> 12);
+    *state ^= (*state << 25);
+    *state ^= (*state >> 27);
+    return (*state * 0x2545F4914F6CDD1DULL);
+}
+
+
+/** Fill a buffer with one of the synthetic corpora */
+static void bench_generate(const char *name, uint8_t *buf, const size_t len) {
+    static const char *words[] = { "the", "of", "and", "to", "in", "is", "that", "for", "it", "as", "was", "with", "be", "by", "on", "not", "he", "this", "are", "or", "his", "from", "at", "which", "but", "have", "an", "had", "they", "you", "were", "their", "one", "all", "we", "can", "her", "has", "there", "been", "compression", "library", "function", "stream", "buffer", "window", "python", "module" };
+    static const char *levels[] = { "DEBUG", "INFO", "INFO", "INFO", "WARN", "ERROR" };
+    static const char *paths[] = { "/api/v1/users", "/api/v1/orders", "/api/v1/items", "/static/app.js", "/login", "/health" };
+    const size_t nwords = (sizeof(words) / sizeof(words[0]));
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    size_t pos = 0x00;
+    if (strcmp(name, "zeros") == 0x00) {
+        memset(buf, 0x00, len);
+        return;
+    } else if (strcmp(name, "random") == 0x00) {
+        while (pos < len) {
+            const uint64_t val = bench_rand(&state);
+            const size_t take = (((len - pos) < sizeof(val)) ? (len - pos) : sizeof(val));
+            memcpy(buf + pos, &val, take);
+            pos += take;
+        }
+        return;
+    }
+    char line[256];
+    uint64_t stamp = 1458432000000ULL;  // 2016-03-20 in milliseconds
+    while (pos < len) {
+        int n;
+        if (strcmp(name, "logs") == 0x00) {
+            const uint64_t r = bench_rand(&state);
+            stamp += (r % 50);
+            n = snprintf(line, sizeof(line), "%llu.%03u %s [worker-%u] GET %s id=%08x status=%u latency_ms=%u\n", (unsigned long long)(stamp / 1000), (unsigned int)(stamp % 1000), levels[(r >> 8) % 6], (unsigned int)((r >> 16) % 8), paths[(r >> 20) % 6], (unsigned int)(r >> 32), (((r >> 24) % 10) ? 200U : 404U), (unsigned int)((r >> 40) % 900));
+        } else {  // Text: Zipf-like word choice with sentence punctuation
+            const uint64_t r = bench_rand(&state);
+            const size_t w = (size_t)(((r % nwords) * ((r >> 16) % nwords)) / nwords);
+            n = snprintf(line, sizeof(line), (((r >> 40) % 13) ? "%s " : "%s.\n"), words[w]);
+        }
+        if (n <= 0x00) break;
+        const size_t take = (((len - pos) < (size_t)n) ? (len - pos) : (size_t)n);
+        memcpy(buf + pos, line, take);
+        pos += take;
+    }
+}
+
+
+/** Load a user-supplied file into memory */
+static int bench_load(const char *filename, bench_corpus *corpus) {
+    FILE *source = fopen(filename, "rb");
+    if (source == (FILE *)NULL) return Z_ERRNO;
+    if (fseek(source, 0L, SEEK_END) != 0x00) {
+        fclose(source);
+        return Z_ERRNO;
+    }
+    const long size = ftell(source);
+    rewind(source);
+    corpus->name = filename;
+    corpus->len = ((size > 0L) ? (size_t)size : 0x00);
+    corpus->data = (uint8_t *)malloc(corpus->len + 0x01);
+    if (corpus->data == (uint8_t *)NULL || fread(corpus->data, 0x01, corpus->len, source) != corpus->len) {
+        free(corpus->data);
+        fclose(source);
+        return Z_ERRNO;
+    }
+    fclose(source);
+    return Z_OK;
+}
+
+
+/** Streaming deflate of a whole buffer, reading and writing `bufsize` bytes at a time like `zlib_compress_stream()` does with CHUNK */
+static int bench_deflate(const uint8_t *src, const size_t len, uint8_t *dest, size_t *dest_len, const int level, const size_t bufsize) {
+    z_stream strm;
+    size_t in_pos = 0x00, out_pos = 0x00;
+    int ret, flush;
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    ret = deflateInit(&strm, level);
+    if (ret != Z_OK) return ret;
+    do {
+        const size_t take = (((len - in_pos) < bufsize) ? (len - in_pos) : bufsize);
+        strm.next_in = (Bytef *)(uintptr_t)(src + in_pos);
+        strm.avail_in = (uInt)take;
+        in_pos += take;
+        flush = ((in_pos == len) ? Z_FINISH : Z_NO_FLUSH);
+        do {
+            const size_t room = (*dest_len - out_pos);
+            strm.next_out = (dest + out_pos);
+            strm.avail_out = (uInt)((room < bufsize) ? room : bufsize);
+            const uInt before = strm.avail_out;
+            ret = deflate(&strm, flush);
+            out_pos += (size_t)(before - strm.avail_out);
+        } while (strm.avail_out == 0x00 && ret != Z_STREAM_ERROR && out_pos < *dest_len);
+    } while (flush != Z_FINISH && ret != Z_STREAM_ERROR);
+    (void)deflateEnd(&strm);
+    *dest_len = out_pos;
+    return ((ret == Z_STREAM_END) ? Z_OK : Z_BUF_ERROR);
+}
+
+
+/** Streaming inflate of a whole buffer, `bufsize` bytes at a time */
+static int bench_inflate(const uint8_t *src, const size_t len, uint8_t *dest, size_t *dest_len, const size_t bufsize) {
+    z_stream strm;
+    size_t in_pos = 0x00, out_pos = 0x00;
+    int ret;
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    strm.avail_in = 0x00;
+    strm.next_in = Z_NULL;
+    ret = inflateInit(&strm);
+    if (ret != Z_OK) return ret;
+    do {
+        const size_t take = (((len - in_pos) < bufsize) ? (len - in_pos) : bufsize);
+        if (take == 0x00) break;
+        strm.next_in = (Bytef *)(uintptr_t)(src + in_pos);
+        strm.avail_in = (uInt)take;
+        in_pos += take;
+        do {
+            const size_t room = (*dest_len - out_pos);
+            if (room == 0x00) break;
+            strm.next_out = (dest + out_pos);
+            strm.avail_out = (uInt)((room < bufsize) ? room : bufsize);
+            const uInt before = strm.avail_out;
+            ret = inflate(&strm, Z_NO_FLUSH);
+            out_pos += (size_t)(before - strm.avail_out);
+        } while (strm.avail_out == 0x00 && ret == Z_OK);
+        if (ret == Z_BUF_ERROR && strm.avail_in == 0x00) ret = Z_OK;  // The piece ended exactly on an output boundary; Feed the next one
+    } while (ret == Z_OK);
+    (void)inflateEnd(&strm);
+    *dest_len = out_pos;
+    return ((ret == Z_STREAM_END) ? Z_OK : Z_DATA_ERROR);
+}
+
+
+/** LZ codec over a whole buffer in `bufsize` blocks; Each block is stored as a 4-byte size and the block itself */
+static int bench_lz_compress(const uint8_t *src, const size_t len, uint8_t *dest, size_t *dest_len, const size_t bufsize) {
+    size_t in_pos = 0x00, out_pos = 0x00;
+    while (in_pos < len) {
+        const size_t take = (((len - in_pos) < bufsize) ? (len - in_pos) : bufsize);
+        size_t block = (*dest_len - out_pos - 0x04);
+        const int ret = lz_compress_block(src + in_pos, take, dest + out_pos + 0x04, &block);
+        if (ret != Z_OK) return ret;
+        const uint32_t block32 = (uint32_t)block;
+        memcpy(dest + out_pos, &block32, 0x04);
+        out_pos += (block + 0x04);
+        in_pos += take;
+    }
+    *dest_len = out_pos;
+    return Z_OK;
+}
+
+
+/** Reverse `bench_lz_compress()` */
+static int bench_lz_decompress(const uint8_t *src, const size_t len, uint8_t *dest, size_t *dest_len, const size_t bufsize) {
+    size_t in_pos = 0x00, out_pos = 0x00;
+    while (in_pos < len) {
+        uint32_t block = 0x00;
+        memcpy(&block, src + in_pos, 0x04);
+        size_t have = (((*dest_len - out_pos) < bufsize) ? (*dest_len - out_pos) : bufsize);
+        const int ret = lz_decompress_block(src + in_pos + 0x04, (size_t)block, dest + out_pos, &have);
+        if (ret != Z_OK) return ret;
+        in_pos += ((size_t)block + 0x04);
+        out_pos += have;
+    }
+    *dest_len = out_pos;
+    return Z_OK;
+}
+
+
+/** Compress and decompress a corpus repeatedly for at least `min_time` seconds each, then check the round trip */
+static void bench_measure(const bench_corpus *corpus, const int codec, const int level, const size_t bufsize, const double min_time, bench_result *result) {
+    const size_t bound = (codec_compress_bound(codec, corpus->len) + ((corpus->len / bufsize) + 0x01) * 0x20);
+    uint8_t *packed = (uint8_t *)malloc(bound);
+    uint8_t *unpacked = (uint8_t *)malloc(corpus->len + 0x01);
+    double start, elapsed;
+    unsigned int runs;
+    size_t out_len = bound, back_len = corpus->len;
+    memset(result, 0x00, sizeof(bench_result));
+    result->ret = Z_MEM_ERROR;
+    if (packed == (uint8_t *)NULL || unpacked == (uint8_t *)NULL) goto done;
+    runs = 0x00;
+    start = bench_now();
+    do {
+        out_len = bound;
+        result->ret = ((codec == CODEC_LZ) ? bench_lz_compress(corpus->data, corpus->len, packed, &out_len, bufsize) : bench_deflate(corpus->data, corpus->len, packed, &out_len, level, bufsize));
+        ++runs;
+        elapsed = (bench_now() - start);
+    } while (result->ret == Z_OK && elapsed < min_time);
+    if (result->ret != Z_OK) goto done;
+    result->out_len = out_len;
+    result->compress_mbps = (((double)corpus->len * (double)runs) / (elapsed * 1048576.0));
+    runs = 0x00;
+    start = bench_now();
+    do {
+        back_len = corpus->len;
+        result->ret = ((codec == CODEC_LZ) ? bench_lz_decompress(packed, out_len, unpacked, &back_len, bufsize) : bench_inflate(packed, out_len, unpacked, &back_len, bufsize));
+        ++runs;
+        elapsed = (bench_now() - start);
+    } while (result->ret == Z_OK && elapsed < min_time);
+    if (result->ret != Z_OK) goto done;
+    result->decompress_mbps = (((double)corpus->len * (double)runs) / (elapsed * 1048576.0));
+    if (back_len != corpus->len || memcmp(unpacked, corpus->data, corpus->len) != 0x00) result->ret = Z_DATA_ERROR;
+done:
+    free(unpacked);
+    free(packed);
+}
+
+
+/** Run one measurement in a child process, so that its peak RSS is not mixed up with earlier measurements */
+static void bench_isolated(const bench_corpus *corpus, const int codec, const int level, const size_t bufsize, const double min_time, bench_result *result) {
+#ifdef OSPOSIX
+    int fds[2];
+    if (pipe(fds) == 0x00) {
+        const pid_t pid = fork();
+        if (pid == 0x00) {
+            close(fds[0]);
+            bench_measure(corpus, codec, level, bufsize, min_time, result);
+            const ssize_t written = write(fds[1], result, sizeof(bench_result));
+            _exit((written == (ssize_t)sizeof(bench_result)) ? EXIT_SUCCESS : EXIT_FAILURE);
+        } else if (pid > 0x00) {
+            struct rusage usage;
+            int status;
+            close(fds[1]);
+            const ssize_t got = read(fds[0], result, sizeof(bench_result));
+            close(fds[0]);
+            memset(&usage, 0x00, sizeof(usage));
+            (void)wait4(pid, &status, 0x00, &usage);
+            if (got != (ssize_t)sizeof(bench_result)) {
+                memset(result, 0x00, sizeof(bench_result));
+                result->ret = Z_ERRNO;
+            }
+            result->peak_rss_kb = (long)usage.ru_maxrss;
+            return;
+        }
+        close(fds[0]);
+        close(fds[1]);
+    }
+#endif
+    bench_measure(corpus, codec, level, bufsize, min_time, result);
+}
+
+
+/** Parse a comma-separated list of non-negative integers */
+static unsigned int bench_parse_list(const char *arg, long *list) {
+    unsigned int count = 0x00;
+    char *end;
+    while (*arg != '\0' && count < BENCH_MAX_LIST) {
+        const long val = strtol(arg, &end, 10);
+        if (end == arg || val < 0L) break;
+        list[count++] = val;
+        arg = ((*end == ',') ? (end + 1) : end);
+    }
+    return count;
+}
+
+
+/** Print one result row */
+static void bench_print(const int json, const int first, const bench_corpus *corpus, const int codec, const int level, const size_t bufsize, const bench_result *result) {
+    const double ratio = ((result->out_len != 0x00) ? ((double)corpus->len / (double)result->out_len) : 0.0);
+    const char *codec_name = ((codec == CODEC_LZ) ? "lz" : "zlib");
+    if (json) {
+        printf("%s\n  {\"corpus\": \"%s\", \"codec\": \"%s\", \"level\": %d, \"buffer\": %zu, \"input_bytes\": %zu, \"output_bytes\": %zu, \"ratio\": %.4f, \"compress_mbps\": %.2f, \"decompress_mbps\": %.2f, \"peak_rss_kb\": %ld, \"status\": %d}", (first ? "" : ","), corpus->name, codec_name, level, bufsize, corpus->len, result->out_len, ratio, result->compress_mbps, result->decompress_mbps, result->peak_rss_kb, result->ret);
+    } else {
+        printf("%s,%s,%d,%zu,%zu,%zu,%.4f,%.2f,%.2f,%ld,%d\n", corpus->name, codec_name, level, bufsize, corpus->len, result->out_len, ratio, result->compress_mbps, result->decompress_mbps, result->peak_rss_kb, result->ret);
+    }
+    fflush(stdout);
+}
+
+
+int main(int argc, char *argv[]) {
+    static const char *synthetic[] = { "random", "text", "logs", "zeros" };
+    long levels[BENCH_MAX_LIST] = { 1, 3, 6, 9 };
+    long buffers[BENCH_MAX_LIST] = { 16384, 65536, CHUNK, 1048576 };
+    unsigned int nlevels = 0x04, nbuffers = 0x04, c, l, b;
+    size_t size = ((size_t)8 << 20);
+    double min_time = 0.2;
+    int json = 0x00, first = 0x01, argi;
+    for (argi = 0x01; argi < argc && argv[argi][0] == '-' && argv[argi][1] != '\0'; argi++) {
+        const char opt = argv[argi][1];
+        if (opt == 'j') json = 0x01;
+        else if ((argi + 1) < argc && opt == 's') size = ((size_t)strtoul(argv[++argi], NULL, 10) << 20);
+        else if ((argi + 1) < argc && opt == 'l') nlevels = bench_parse_list(argv[++argi], levels);
+        else if ((argi + 1) < argc && opt == 'b') nbuffers = bench_parse_list(argv[++argi], buffers);
+        else if ((argi + 1) < argc && opt == 'r') min_time = strtod(argv[++argi], NULL);
+        else {
+            fprintf(stderr, "Usage: %s [-j] [-s MiB] [-l levels] [-b buffer_sizes] [-r min_seconds] [FILE...]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    const unsigned int ncorpora = (0x04 + (unsigned int)(argc - argi));
+    bench_corpus *corpora = (bench_corpus *)calloc(ncorpora, sizeof(bench_corpus));
+    if (corpora == (bench_corpus *)NULL || nlevels == 0x00 || nbuffers == 0x00) return EXIT_FAILURE;
+    for (c = 0x00; c < 0x04; c++) {
+        corpora[c].name = synthetic[c];
+        corpora[c].len = size;
+        corpora[c].data = (uint8_t *)malloc(size + 0x01);
+        if (corpora[c].data == (uint8_t *)NULL) return EXIT_FAILURE;
+        bench_generate(synthetic[c], corpora[c].data, size);
+    }
+    for (; c < ncorpora; c++) {
+        if (bench_load(argv[argi + (int)(c - 0x04)], &corpora[c]) != Z_OK) {
+            fprintf(stderr, "ERROR: Failed to read `%s`!\n%s\n", argv[argi + (int)(c - 0x04)], strerror(errno));
+            return EXIT_FAILURE;
+        }
+    }
+    if (json) fputs("[", stdout);
+    else puts("corpus,codec,level,buffer,input_bytes,output_bytes,ratio,compress_mbps,decompress_mbps,peak_rss_kb,status");
+    for (c = 0x00; c < ncorpora; c++) {
+        for (b = 0x00; b < nbuffers; b++) {
+            const size_t bufsize = ((buffers[b] > 0L) ? (size_t)buffers[b] : (size_t)CHUNK);
+            bench_result result;
+            for (l = 0x00; l < nlevels; l++) {
+                bench_isolated(&corpora[c], CODEC_ZLIB, (int)levels[l], bufsize, min_time, &result);
+                bench_print(json, first, &corpora[c], CODEC_ZLIB, (int)levels[l], bufsize, &result);
+                first = 0x00;
+            }
+            bench_isolated(&corpora[c], CODEC_LZ, 0x00, bufsize, min_time, &result);
+            bench_print(json, first, &corpora[c], CODEC_LZ, 0x00, bufsize, &result);
+        }
+        free(corpora[c].data);
+    }
+    if (json) puts("\n]");
+    free(corpora);
+    return EXIT_SUCCESS;
+}
@@ -29,6 +29,13 @@ License along with this library.
 
 from itertools import cycle
 
+try:  # SIMD XOR kernel from the C extension
+    from pybooster.tools import xor_cipher_buf  # noqa  # pylint: disable=E0611
+except ImportError:
+    def xor_cipher_buf(_data: bytes, _key: bytes) -> bytes:
+        """XOR each byte of the data with the repeated key (pure-Python fallback)"""
+        return bytes(a ^ b for (a, b) in zip(_data, cycle(_key))) if _key else bytes(_data)
+
 
 __all__ = [
     # FUNCTIONS
@@ -46,13 +53,23 @@ __all__ = [
 # FUNCTIONS
 
 
+def _xor_key_str(_data: bytes, _key: str) -> str:
+    """XOR the bytes with the repeated str key and return the result as a str (one char per byte)"""
+    if not _key:
+        return ''
+    try:
+        return str(xor_cipher_buf(_data, _key.encode('latin-1')), 'latin-1')
+    except UnicodeEncodeError:  # A key character is wider than one byte
+        return ''.join(chr(a ^ ord(b)) for (a, b) in zip(_data, cycle(_key)))
+
+
 def encrypt_xor(_data: bytes) -> bytearray:
     """XOR Encryption
 
     Return the encrypted data as a bytearray
     Decrypt with decrypt_xor()
     """
-    return bytearray([b ^ 0xA8 for b in bytearray(_data)])
+    return bytearray(xor_cipher_buf(_data, b'\xA8'))
 
 
 def decrypt_xor(_data: bytearray) -> str:
@@ -61,7 +78,7 @@ def decrypt_xor(_data: bytearray) -> str:
     Return the decrypted data as a str
     Encrypt with encrypt_xor()
     """
-    return str(bytearray([b ^ 0xA8 for b in bytearray(_data)]), 'utf-8')
+    return str(xor_cipher_buf(_data, b'\xA8'), 'utf-8')
 
 
 def encrypt_xor_bytes_key_str(_data: bytes, _key: str) -> str:
@@ -70,7 +87,7 @@ def encrypt_xor_bytes_key_str(_data: bytes, _key: str) -> str:
     Encrypt the bytes and return the data as a str
     Decrypt with decrypt_xor_str_key_bytes()
     """
-    return ''.join(chr(a ^ ord(b)) for (a, b) in zip(_data, cycle(_key)))
+    return _xor_key_str(_data, _key)
 
 
 def decrypt_xor_str_key_bytes(_data: str, _key: str) -> bytes:
@@ -79,7 +96,7 @@ def decrypt_xor_str_key_bytes(_data: str, _key: str) -> bytes:
     Decrypt the str and return the data as bytes
     Encrypt with encrypt_xor_bytes_key_str()
     """
-    return ''.join(chr(a ^ ord(b)) for (a, b) in zip(_data.encode('utf-8'), cycle(_key))).encode('utf-8')
+    return _xor_key_str(_data.encode('utf-8'), _key).encode('utf-8')
 
 
 def decrypt_xor_str_key_str(_data: str, _key: str) -> str:
@@ -88,7 +105,7 @@ def decrypt_xor_str_key_str(_data: str, _key: str) -> str:
     Decrypt the str and return the data as a str
     Encrypt with encrypt_xor_bytes_key_str()
     """
-    return ''.join(chr(a ^ ord(b)) for (a, b) in zip(_data.encode('utf-8'), cycle(_key)))
+    return _xor_key_str(_data.encode('utf-8'), _key)
 
 
 def encrypt_xor_str_key_bytes(_data: str, _key: str) -> bytes:
@@ -98,7 +115,7 @@ def encrypt_xor_str_key_bytes(_data: str, _key: str) -> bytes:
     Encrypt the str and return the data as bytes
     Decrypt with decrypt_xor_bytes_key_bytes() or decrypt_xor_bytes_key_str()
     """
-    return ''.join(chr(a ^ ord(b)) for (a, b) in zip(_data.encode('utf-8'), cycle(_key))).encode('utf-8')
+    return _xor_key_str(_data.encode('utf-8'), _key).encode('utf-8')
 
 
 def decrypt_xor_bytes_key_bytes(_data: bytes, _key: str) -> bytes:
@@ -107,7 +124,7 @@ def decrypt_xor_bytes_key_bytes(_data: bytes, _key: str) -> bytes:
     Decrypt the bytes and return the data as bytes
     Encrypt with encrypt_xor_str_key_bytes()
     """
-    return ''.join(chr(a ^ ord(b)) for (a, b) in zip(_data, cycle(_key))).encode('utf-8')
+    return _xor_key_str(_data, _key).encode('utf-8')
 
 
 def decrypt_xor_bytes_key_str(_data: bytes, _key: str) -> str:
@@ -116,4 +133,4 @@ def decrypt_xor_bytes_key_str(_data: bytes, _key: str) -> str:
     Decrypt the bytes and return the data as a str
     Encrypt with encrypt_xor_str_key_bytes()
     """
-    return ''.join(chr(a ^ ord(b)) for (a, b) in zip(_data, cycle(_key)))
+    return _xor_key_str(_data, _key)
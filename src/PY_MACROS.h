@@ -52,6 +52,7 @@ License along with this library.
 
 /* MACROS */
 
+#include <stddef.h>  // Must precede MACROS.h, which redefines ptrdiff_t before the system headers can typedef it
 #include "MACROS.h"
 
 #include <Python.h>
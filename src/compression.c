@@ -33,6 +33,89 @@ License along with this library.
 #include "compression.h"
 
 
+#ifdef __GNUC__
+static ulint getfilesize(const char *filename) __attribute__((flatten));
+static unsigned int zlib_thread_count(const unsigned int num_threads) __attribute__((flatten));
+static void *zlib_deflate_block(void *arg) __attribute__((flatten, nonnull));
+static int zlib_compress_file_blocks(FILE *source, FILE *dest, const ulint source_size, const int level, const unsigned int num_threads) __attribute__((flatten));
+#   ifdef __PTHREAD_ENABLED__
+static int zring_init(zring *ring) __attribute__((nonnull));
+static void zring_destroy(zring *ring) __attribute__((nonnull));
+static int zring_acquire_empty(zring *ring) __attribute__((nonnull));
+static void zring_commit(zring *ring, const size_t len) __attribute__((nonnull));
+static int zring_acquire_full(zring *ring) __attribute__((nonnull));
+static void zring_release(zring *ring) __attribute__((nonnull));
+static void zring_close(zring *ring, const int stop) __attribute__((nonnull));
+static void *zlib_pipe_reader(void *arg) __attribute__((nonnull));
+static void *zlib_pipe_writer(void *arg) __attribute__((nonnull));
+static int zlib_pipe_start(zpipeline *pipeline, FILE *source, FILE *dest, pthread_t *reader, pthread_t *writer) __attribute__((nonnull));
+static int zlib_pipe_finish(zpipeline *pipeline, const int ret, pthread_t reader, pthread_t writer) __attribute__((nonnull));
+#   endif
+static double zlib_entropy(const uint8_t *data, const size_t len) __attribute__((nonnull, pure));
+static int zlib_trial(const uint8_t *sample, const size_t len, const int level, double *ratio, double *mbps) __attribute__((flatten, nonnull));
+static uint32_t zdict_hash(const uint8_t *src) __attribute__((nonnull, pure));
+static int zdict_segment_cmp(const void *a, const void *b) __attribute__((nonnull, pure));
+static uint32_t lz_read32(const uint8_t *src) __attribute__((nonnull, pure));
+static uint64_t lz_read64(const uint8_t *src) __attribute__((nonnull, pure));
+static void lz_put32(uint8_t *dst, const uint32_t val) __attribute__((nonnull));
+static uint32_t lz_get32(const uint8_t *src) __attribute__((nonnull, pure));
+static uint32_t lz_hash(const uint32_t sequence) __attribute__((const));
+static uint8_t *lz_put_length(uint8_t *dest, size_t len) __attribute__((nonnull, returns_nonnull));
+#   ifdef OSPOSIX
+static int zlib_mmap_run(const int fd, const ulint source_size, z_stream *strm, FILE *dest, const int deflating) __attribute__((flatten, nonnull));
+#   endif
+static void zindex_put64(uint8_t *dst, uint64_t val) __attribute__((nonnull));
+static uint64_t zindex_get64(const uint8_t *src) __attribute__((nonnull, pure));
+static int zlib_index_addpoint(zindex *index, const int bits, const uint64_t in, const uint64_t out, const unsigned int left, const unsigned char *window) __attribute__((flatten, nonnull));
+static int zlib_map_source(const char *filename, const Bytef **src, size_t *len) __attribute__((flatten, nonnull));
+static void zlib_unmap_source(const Bytef *src, const size_t len) __attribute__((flatten));
+static void *zlib_inflate_job(void *arg) __attribute__((flatten, nonnull));
+static void zlib_start_inflate_job(zinflate_job *job) __attribute__((nonnull));
+static void zlib_finish_inflate_job(zinflate_job *job) __attribute__((nonnull));
+static int zlib_inflate_members(const Bytef *src, const size_t len, FILE *dest, const int first_only, size_t *consumed) __attribute__((flatten, nonnull));
+#else
+static ulint getfilesize(const char *filename);
+static unsigned int zlib_thread_count(const unsigned int num_threads);
+static void *zlib_deflate_block(void *arg);
+static int zlib_compress_file_blocks(FILE *source, FILE *dest, const ulint source_size, const int level, const unsigned int num_threads);
+#   ifdef __PTHREAD_ENABLED__
+static int zring_init(zring *ring);
+static void zring_destroy(zring *ring);
+static int zring_acquire_empty(zring *ring);
+static void zring_commit(zring *ring, const size_t len);
+static int zring_acquire_full(zring *ring);
+static void zring_release(zring *ring);
+static void zring_close(zring *ring, const int stop);
+static void *zlib_pipe_reader(void *arg);
+static void *zlib_pipe_writer(void *arg);
+static int zlib_pipe_start(zpipeline *pipeline, FILE *source, FILE *dest, pthread_t *reader, pthread_t *writer);
+static int zlib_pipe_finish(zpipeline *pipeline, const int ret, pthread_t reader, pthread_t writer);
+#   endif
+static double zlib_entropy(const uint8_t *data, const size_t len);
+static int zlib_trial(const uint8_t *sample, const size_t len, const int level, double *ratio, double *mbps);
+static uint32_t zdict_hash(const uint8_t *src);
+static int zdict_segment_cmp(const void *a, const void *b);
+static uint32_t lz_read32(const uint8_t *src);
+static uint64_t lz_read64(const uint8_t *src);
+static void lz_put32(uint8_t *dst, const uint32_t val);
+static uint32_t lz_get32(const uint8_t *src);
+static uint32_t lz_hash(const uint32_t sequence);
+static uint8_t *lz_put_length(uint8_t *dest, size_t len);
+#   ifdef OSPOSIX
+static int zlib_mmap_run(const int fd, const ulint source_size, z_stream *strm, FILE *dest, const int deflating);
+#   endif
+static void zindex_put64(uint8_t *dst, uint64_t val);
+static uint64_t zindex_get64(const uint8_t *src);
+static int zlib_index_addpoint(zindex *index, const int bits, const uint64_t in, const uint64_t out, const unsigned int left, const unsigned char *window);
+static int zlib_map_source(const char *filename, const Bytef **src, size_t *len);
+static void zlib_unmap_source(const Bytef *src, const size_t len);
+static void *zlib_inflate_job(void *arg);
+static void zlib_start_inflate_job(zinflate_job *job);
+static void zlib_finish_inflate_job(zinflate_job *job);
+static int zlib_inflate_members(const Bytef *src, const size_t len, FILE *dest, const int first_only, size_t *consumed);
+#endif
+
+
 /* FUNCTIONS */
 
 
@@ -59,8 +142,149 @@ static ulint getfilesize(const char *filename) {
 #endif
 
 
-/** zlib stream compression */
+/** Private Function: Resolve a thread count (zero selects one thread per online processor) */
+static unsigned int zlib_thread_count(const unsigned int num_threads) {
+    if (num_threads != 0x00) return num_threads;
+#if (defined(OSPOSIX) && defined(_SC_NPROCESSORS_ONLN))
+    const slint cpus = (slint)sysconf(_SC_NPROCESSORS_ONLN);
+    return ((cpus > 0x00) ? (unsigned int)cpus : 0x01);
+#else
+    return 0x01;
+#endif
+}
+
+
+/** Private Function: Raw-deflate one block, primed with the preceding history window; Worker for the parallel compressor */
+static void *zlib_deflate_block(void *arg) {
+    zblock_job *job = (zblock_job *)arg;
+    z_stream strm;
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    job->out_len = 0x00;
+    job->check = adler32(adler32(0L, Z_NULL, 0x00), job->in, job->in_len);
+    const int level = ((job->level == ZLEVEL_AUTO) ? zlib_auto_level(job->in, job->in_len, 0.0) : job->level);
+    job->ret = deflateInit2(&strm, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    if (job->ret != Z_OK) return NULL;
+    if (job->dict_len != 0x00) {
+        job->ret = deflateSetDictionary(&strm, job->dict, job->dict_len);
+        if (job->ret != Z_OK) {
+            (void)deflateEnd(&strm);
+            return NULL;
+        }
+    }
+    strm.next_in = (Bytef *)(uintptr_t)job->in;  // zlib does not write through `next_in`
+    strm.avail_in = job->in_len;
+    strm.next_out = job->out;
+    strm.avail_out = job->out_size;
+    // Non-final blocks end with an empty stored block, so the next block starts on a byte boundary
+    job->ret = deflate(&strm, (job->last ? Z_FINISH : Z_SYNC_FLUSH));
+    job->out_len = (job->out_size - strm.avail_out);
+    if (job->last) job->ret = ((job->ret == Z_STREAM_END) ? Z_OK : Z_BUF_ERROR);
+    else if (job->ret == Z_OK && (strm.avail_in != 0x00 || strm.avail_out == 0x00)) job->ret = Z_BUF_ERROR;
+    (void)deflateEnd(&strm);
+    return NULL;
+}
+
+
+/** Private Function: Compress a file in independent blocks on a worker pool and write a single zlib stream */
+static int zlib_compress_file_blocks(FILE *source, FILE *dest, const ulint source_size, const int level, const unsigned int num_threads) {
+    const uInt out_size = (uInt)compressBound((uLong)ZBLOCK) + 0x40;
+    const size_t round_size = ((size_t)num_threads * ZBLOCK);
+    register unsigned int i, njobs;
+    ulint remaining = source_size;
+    uInt hist_len = 0x00;
+    uLong check = adler32(0L, Z_NULL, 0x00);
+    int ret = Z_OK;
+    // Input layout: [history window][block 0][block 1]...
+    Bytef *in_buf = (Bytef *)calloc(ZWINDOW + round_size, 0x01);
+    Bytef *out_buf = (Bytef *)calloc((size_t)num_threads, (size_t)out_size);
+    zblock_job *jobs = (zblock_job *)calloc((size_t)num_threads, sizeof(zblock_job));
+#ifdef __PTHREAD_ENABLED__
+    pthread_t *threads = (pthread_t *)calloc((size_t)num_threads, sizeof(pthread_t));
+    uint8_t *spawned = (uint8_t *)calloc((size_t)num_threads, 0x01);
+    if (threads == (pthread_t *)NULL || spawned == (uint8_t *)NULL) ret = Z_MEM_ERROR;
+#endif
+    if (in_buf == (Bytef *)NULL || out_buf == (Bytef *)NULL || jobs == (zblock_job *)NULL) ret = Z_MEM_ERROR;
+    // zlib header (RFC 1950), with FLEVEL mirroring what deflate() would emit
+    const unsigned int flevel = ((level == Z_DEFAULT_COMPRESSION || level == 6) ? 0x02 : (level < 2 ? 0x00 : (level < 6 ? 0x01 : 0x03)));
+    unsigned int header = ((0x78 << 8) | (flevel << 6));
+    header += (31 - (header % 31));
+    uint8_t bytes[8] = { (uint8_t)(header >> 8), (uint8_t)(header & 0xFF), 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+    if (ret == Z_OK && fwrite(bytes, 0x01, 0x02, dest) != 0x02) ret = Z_ERRNO;
+    while (ret == Z_OK) {
+        // Read the next round of blocks
+        const size_t want = ((remaining < (ulint)round_size) ? (size_t)remaining : round_size);
+        if (want != 0x00 && fread(in_buf + ZWINDOW, 0x01, want, source) != want) {
+            ret = Z_ERRNO;
+            break;
+        }
+        remaining -= (ulint)want;
+        njobs = (unsigned int)((want + ZBLOCK - 1) / ZBLOCK);
+        if (njobs == 0x00) njobs = 0x01;  // Empty input still needs a final block
+        // Deflate the blocks; Each job starts as soon as it is filled in (block 0 runs on this thread last)
+        for (i = 0x00; i < njobs; i++) {
+            jobs[i].in = (in_buf + ZWINDOW + ((size_t)i * ZBLOCK));
+            jobs[i].in_len = ((i == njobs - 1) ? (uInt)(want - ((size_t)i * ZBLOCK)) : (uInt)ZBLOCK);
+            jobs[i].dict = (jobs[i].in - (i == 0x00 ? hist_len : ZWINDOW));
+            jobs[i].dict_len = (i == 0x00 ? hist_len : (uInt)ZWINDOW);
+            jobs[i].out = (out_buf + ((size_t)i * out_size));
+            jobs[i].out_size = out_size;
+            jobs[i].level = level;
+            jobs[i].last = (remaining == 0x00 && i == njobs - 1);
+#ifdef __PTHREAD_ENABLED__
+            if (i == 0x00) continue;
+            spawned[i] = (uint8_t)(pthread_create(&threads[i], NULL, zlib_deflate_block, &jobs[i]) == 0x00);
+            if (!spawned[i]) (void)zlib_deflate_block(&jobs[i]);
+#else
+            (void)zlib_deflate_block(&jobs[i]);
+#endif
+        }
+#ifdef __PTHREAD_ENABLED__
+        (void)zlib_deflate_block(&jobs[0]);
+        for (i = 0x01; i < njobs; i++) {
+            if (spawned[i]) (void)pthread_join(threads[i], NULL);
+        }
+#endif
+        // Write the blocks in order and stitch their checksums together
+        for (i = 0x00; i < njobs; i++) {
+            if (jobs[i].ret != Z_OK) {
+                ret = jobs[i].ret;
+                break;
+            }
+            if (fwrite(jobs[i].out, 0x01, jobs[i].out_len, dest) != jobs[i].out_len || ferror(dest)) {
+                ret = Z_ERRNO;
+                break;
+            }
+            check = adler32_combine(check, jobs[i].check, (z_off_t)jobs[i].in_len);
+        }
+        if (remaining == 0x00) break;
+        // The tail of this round primes the first block of the next round
+        memmove(in_buf, (in_buf + want), ZWINDOW);
+        hist_len = ZWINDOW;
+    }
+    if (ret == Z_OK) {  // Adler-32 trailer (big-endian)
+        bytes[0] = (uint8_t)(check >> 24);
+        bytes[1] = (uint8_t)(check >> 16);
+        bytes[2] = (uint8_t)(check >> 8);
+        bytes[3] = (uint8_t)check;
+        if (fwrite(bytes, 0x01, 0x04, dest) != 0x04) ret = Z_ERRNO;
+    }
+    // Clean up and return
+#ifdef __PTHREAD_ENABLED__
+    free(threads);
+    free(spawned);
+#endif
+    free(jobs);
+    free(out_buf);
+    free(in_buf);
+    return ret;
+}
+
+
+/** zlib stream compression; `level` may be ZLEVEL_AUTO */
 int zlib_compress_stream(FILE *source, FILE *dest, const int level) {
+    if (level == ZLEVEL_AUTO) return zlib_compress_stream_auto(source, dest, 0.0);
     int ret, flush;
     unsigned have;
     z_stream strm;
@@ -101,21 +325,31 @@ int zlib_compress_stream(FILE *source, FILE *dest, const int level) {
 }
 
 
-/** zlib file compression */
-int zlib_compress_file(char *source_filename, char *dest_filename, const int level) {
+/** zlib file compression; With more than one thread, the file is deflated in parallel blocks (zero selects one thread per processor); `level` may be ZLEVEL_AUTO, which picks levels without a throughput budget (use `zlib_compress_stream_auto()` to give one); Return Z_ERRNO when a file cannot be opened */
+int zlib_compress_file(char *source_filename, char *dest_filename, const int level, const unsigned int num_threads) {
     FILE *source = fopen(source_filename, "rb");
-    if (source == (FILE *)NULL) {
-        fprintf(stderr, "ERROR: Failed to open file!\n%s\n", strerror(errno));
-        exit(EXIT_FAILURE);
-    }
+    if (source == (FILE *)NULL) return Z_ERRNO;
     FILE *dest = fopen(dest_filename, "wb");
     if (dest == (FILE *)NULL) {
-        fprintf(stderr, "ERROR: Failed to open file!\n%s\n", strerror(errno));
         fclose(source);
-        exit(EXIT_FAILURE);
+        return Z_ERRNO;
     }
     // Prepare source file and buffer
     ulint source_size = getfilesize(source_filename);
+    unsigned int threads = zlib_thread_count(num_threads);
+    if ((ulint)threads > ((source_size + ZBLOCK - 1) / ZBLOCK)) threads = (unsigned int)((source_size + ZBLOCK - 1) / ZBLOCK);
+    if (threads > 0x01) {
+        const int block_ret = zlib_compress_file_blocks(source, dest, source_size, level, threads);
+        fclose(source);
+        if (fclose(dest) != 0x00 && block_ret == Z_OK) return Z_ERRNO;
+        return block_ret;
+    }
+    if (level == ZLEVEL_AUTO) {
+        const int auto_ret = zlib_compress_stream_auto(source, dest, 0.0);
+        fclose(source);
+        if (fclose(dest) != 0x00 && auto_ret == Z_OK) return Z_ERRNO;
+        return auto_ret;
+    }
     Bytef *source_data = (Bytef *)calloc(source_size + 1, 0x01);
     if (source_data == (Bytef *)NULL) { ALLOC_ERROR() }
     if (fread(source_data, 0x01, source_size, source) != source_size) {
@@ -190,7 +424,7 @@ int zlib_decompress_stream(FILE *source, FILE *dest) {
                 case Z_MEM_ERROR:
                     (void)inflateEnd(&strm);
                     return ret;
-                default: continue;
+                default: break;
             }
             have = (CHUNK - strm.avail_out);
             if ((fwrite(out, sizeof(char), have, dest)) != have || ferror(dest)) {
@@ -297,6 +531,1953 @@ int zlib_decompress_file(char *source_filename, char *dest_filename) {
 }
 
 
+#ifdef __PTHREAD_ENABLED__
+/** Private Function: Allocate a ring of ZRING_SLOTS CHUNK-sized buffers */
+static int zring_init(zring *ring) {
+    ring->head = ring->tail = ring->count = 0x00;
+    ring->done = ring->stop = 0x00;
+    ring->mem = (unsigned char *)malloc((size_t)ZRING_SLOTS * CHUNK);
+    if (ring->mem == (unsigned char *)NULL) return Z_MEM_ERROR;
+    if (pthread_mutex_init(&ring->lock, NULL) != 0x00) {
+        free(ring->mem);
+        return Z_MEM_ERROR;
+    }
+    if (pthread_cond_init(&ring->filled, NULL) != 0x00) {
+        (void)pthread_mutex_destroy(&ring->lock);
+        free(ring->mem);
+        return Z_MEM_ERROR;
+    }
+    if (pthread_cond_init(&ring->drained, NULL) != 0x00) {
+        (void)pthread_cond_destroy(&ring->filled);
+        (void)pthread_mutex_destroy(&ring->lock);
+        free(ring->mem);
+        return Z_MEM_ERROR;
+    }
+    return Z_OK;
+}
+
+
+/** Private Function: Release a ring made by `zring_init()` */
+static void zring_destroy(zring *ring) {
+    (void)pthread_cond_destroy(&ring->drained);
+    (void)pthread_cond_destroy(&ring->filled);
+    (void)pthread_mutex_destroy(&ring->lock);
+    free(ring->mem);
+}
+
+
+/** Private Function: Wait for an empty slot and return its index (or ZRING_STOPPED) */
+static int zring_acquire_empty(zring *ring) {
+    (void)pthread_mutex_lock(&ring->lock);
+    while (ring->count == ZRING_SLOTS && !ring->stop) (void)pthread_cond_wait(&ring->drained, &ring->lock);
+    const int slot = (ring->stop ? ZRING_STOPPED : (int)ring->head);
+    (void)pthread_mutex_unlock(&ring->lock);
+    return slot;
+}
+
+
+/** Private Function: Hand the slot returned by `zring_acquire_empty()` to the consumer */
+static void zring_commit(zring *ring, const size_t len) {
+    (void)pthread_mutex_lock(&ring->lock);
+    ring->len[ring->head] = len;
+    ring->head = ((ring->head + 1) % ZRING_SLOTS);
+    ring->count++;
+    (void)pthread_cond_signal(&ring->filled);
+    (void)pthread_mutex_unlock(&ring->lock);
+}
+
+
+/** Private Function: Wait for a filled slot and return its index (or ZRING_CLOSED/ZRING_STOPPED) */
+static int zring_acquire_full(zring *ring) {
+    (void)pthread_mutex_lock(&ring->lock);
+    while (ring->count == 0x00 && !ring->done && !ring->stop) (void)pthread_cond_wait(&ring->filled, &ring->lock);
+    const int slot = (ring->stop ? ZRING_STOPPED : (ring->count == 0x00 ? ZRING_CLOSED : (int)ring->tail));
+    (void)pthread_mutex_unlock(&ring->lock);
+    return slot;
+}
+
+
+/** Private Function: Give the slot returned by `zring_acquire_full()` back to the producer */
+static void zring_release(zring *ring) {
+    (void)pthread_mutex_lock(&ring->lock);
+    ring->tail = ((ring->tail + 1) % ZRING_SLOTS);
+    ring->count--;
+    (void)pthread_cond_signal(&ring->drained);
+    (void)pthread_mutex_unlock(&ring->lock);
+}
+
+
+/** Private Function: Mark the producer as finished, or (if `stop` is set) abandon the ring and wake both sides */
+static void zring_close(zring *ring, const int stop) {
+    (void)pthread_mutex_lock(&ring->lock);
+    if (stop) ring->stop = 0x01;
+    else ring->done = 0x01;
+    (void)pthread_cond_broadcast(&ring->filled);
+    (void)pthread_cond_broadcast(&ring->drained);
+    (void)pthread_mutex_unlock(&ring->lock);
+}
+
+
+/** Private Function: Pipeline stage that fills the input ring from the source stream */
+static void *zlib_pipe_reader(void *arg) {
+    zpipeline *pipeline = (zpipeline *)arg;
+    int slot;
+    while ((slot = zring_acquire_empty(&pipeline->in)) >= 0x00) {
+        const size_t got = fread((pipeline->in.mem + ((size_t)slot * CHUNK)), 0x01, CHUNK, pipeline->source);
+        if (ferror(pipeline->source)) {
+            pipeline->read_error = Z_ERRNO;
+            zring_close(&pipeline->in, 0x01);
+            return NULL;
+        }
+        if (got != 0x00) zring_commit(&pipeline->in, got);
+        if (got < CHUNK) break;  // End of file
+    }
+    zring_close(&pipeline->in, 0x00);
+    return NULL;
+}
+
+
+/** Private Function: Pipeline stage that drains the output ring into the destination stream */
+static void *zlib_pipe_writer(void *arg) {
+    zpipeline *pipeline = (zpipeline *)arg;
+    int slot;
+    while ((slot = zring_acquire_full(&pipeline->out)) >= 0x00) {
+        const size_t len = pipeline->out.len[slot];
+        if (fwrite((pipeline->out.mem + ((size_t)slot * CHUNK)), 0x01, len, pipeline->dest) != len || ferror(pipeline->dest)) {
+            pipeline->write_error = Z_ERRNO;
+            zring_close(&pipeline->out, 0x01);
+            zring_close(&pipeline->in, 0x01);
+            return NULL;
+        }
+        zring_release(&pipeline->out);
+    }
+    return NULL;
+}
+
+
+/** Private Function: Allocate the rings and start the reader and writer threads */
+static int zlib_pipe_start(zpipeline *pipeline, FILE *source, FILE *dest, pthread_t *reader, pthread_t *writer) {
+    pipeline->source = source;
+    pipeline->dest = dest;
+    pipeline->read_error = pipeline->write_error = Z_OK;
+    if (zring_init(&pipeline->in) != Z_OK) return Z_MEM_ERROR;
+    if (zring_init(&pipeline->out) != Z_OK) {
+        zring_destroy(&pipeline->in);
+        return Z_MEM_ERROR;
+    }
+    if (pthread_create(reader, NULL, zlib_pipe_reader, pipeline) != 0x00) {
+        zring_destroy(&pipeline->out);
+        zring_destroy(&pipeline->in);
+        return Z_MEM_ERROR;
+    }
+    if (pthread_create(writer, NULL, zlib_pipe_writer, pipeline) != 0x00) {
+        zring_close(&pipeline->in, 0x01);
+        (void)pthread_join(*reader, NULL);
+        zring_destroy(&pipeline->out);
+        zring_destroy(&pipeline->in);
+        return Z_MEM_ERROR;
+    }
+    return Z_OK;
+}
+
+
+/** Private Function: Let the writer drain (or stop it after an error), join both threads, and return the first error of any stage */
+static int zlib_pipe_finish(zpipeline *pipeline, const int ret, pthread_t reader, pthread_t writer) {
+    zring_close(&pipeline->in, 0x01);  // Input is no longer needed (trailing data is ignored)
+    zring_close(&pipeline->out, (ret != Z_OK));
+    (void)pthread_join(writer, NULL);
+    (void)pthread_join(reader, NULL);
+    zring_destroy(&pipeline->out);
+    zring_destroy(&pipeline->in);
+    if (pipeline->read_error != Z_OK) return pipeline->read_error;
+    if (pipeline->write_error != Z_OK) return pipeline->write_error;
+    return ret;
+}
+#endif
+
+
+/** zlib stream compression with separate reader and writer threads, so I/O overlaps deflate(); Without pthreads this is `zlib_compress_stream()`; ZLEVEL_AUTO runs `zlib_compress_stream_auto()` on the calling thread */
+int zlib_compress_stream_pipelined(FILE *source, FILE *dest, const int level) {
+    if (level == ZLEVEL_AUTO) return zlib_compress_stream_auto(source, dest, 0.0);
+#ifdef __PTHREAD_ENABLED__
+    zpipeline pipeline;
+    pthread_t reader, writer;
+    z_stream strm;
+    int ret, flush, slot, out_slot;
+    // Allocate deflate state
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    ret = deflateInit(&strm, level);
+    if (ret != Z_OK) return ret;
+    if (zlib_pipe_start(&pipeline, source, dest, &reader, &writer) != Z_OK) {  // Fall back to a single thread
+        (void)deflateEnd(&strm);
+        return zlib_compress_stream(source, dest, level);
+    }
+    out_slot = zring_acquire_empty(&pipeline.out);
+    strm.next_out = (pipeline.out.mem + ((size_t)out_slot * CHUNK));
+    strm.avail_out = CHUNK;
+    do {  // Compress each slot handed over by the reader
+        slot = zring_acquire_full(&pipeline.in);
+        if (slot == ZRING_STOPPED) {
+            ret = Z_ERRNO;
+            break;
+        }
+        flush = ((slot == ZRING_CLOSED) ? Z_FINISH : Z_NO_FLUSH);
+        strm.next_in = ((slot == ZRING_CLOSED) ? Z_NULL : (pipeline.in.mem + ((size_t)slot * CHUNK)));
+        strm.avail_in = ((slot == ZRING_CLOSED) ? 0x00 : (uInt)pipeline.in.len[slot]);
+        do {  // Run deflate() on the slot, passing full output buffers to the writer
+            if (strm.avail_out == 0x00) {
+                zring_commit(&pipeline.out, CHUNK);
+                out_slot = zring_acquire_empty(&pipeline.out);
+                if (out_slot < 0x00) {
+                    ret = Z_ERRNO;
+                    break;
+                }
+                strm.next_out = (pipeline.out.mem + ((size_t)out_slot * CHUNK));
+                strm.avail_out = CHUNK;
+            }
+            ret = deflate(&strm, flush);
+            if (ret == Z_BUF_ERROR) ret = Z_OK;  // No progress was possible; Not fatal
+        } while (ret == Z_OK && strm.avail_out == 0x00);
+        if (slot >= 0x00) zring_release(&pipeline.in);
+    } while (ret == Z_OK);
+    if (ret == Z_STREAM_END) {  // Hand over the final partial buffer
+        zring_commit(&pipeline.out, (CHUNK - strm.avail_out));
+        ret = Z_OK;
+    }
+    // Clean up and return
+    (void)deflateEnd(&strm);
+    return zlib_pipe_finish(&pipeline, ret, reader, writer);
+#else
+    return zlib_compress_stream(source, dest, level);
+#endif
+}
+
+
+/** zlib stream decompression with separate reader and writer threads, so I/O overlaps inflate(); Without pthreads this is `zlib_decompress_stream()` */
+int zlib_decompress_stream_pipelined(FILE *source, FILE *dest) {
+#ifdef __PTHREAD_ENABLED__
+    zpipeline pipeline;
+    pthread_t reader, writer;
+    z_stream strm;
+    int ret, slot, out_slot;
+    // Allocate inflate state
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    strm.avail_in = 0x00;
+    strm.next_in = Z_NULL;
+    ret = inflateInit(&strm);
+    if (ret != Z_OK) return ret;
+    if (zlib_pipe_start(&pipeline, source, dest, &reader, &writer) != Z_OK) {  // Fall back to a single thread
+        (void)inflateEnd(&strm);
+        return zlib_decompress_stream(source, dest);
+    }
+    out_slot = zring_acquire_empty(&pipeline.out);
+    strm.next_out = (pipeline.out.mem + ((size_t)out_slot * CHUNK));
+    strm.avail_out = CHUNK;
+    do {  // Decompress each slot handed over by the reader
+        slot = zring_acquire_full(&pipeline.in);
+        if (slot < 0x00) {  // Failed read, or the input ended before the deflate stream
+            ret = ((slot == ZRING_STOPPED) ? Z_ERRNO : Z_DATA_ERROR);
+            break;
+        }
+        strm.next_in = (pipeline.in.mem + ((size_t)slot * CHUNK));
+        strm.avail_in = (uInt)pipeline.in.len[slot];
+        do {  // Run inflate() on the slot, passing full output buffers to the writer
+            if (strm.avail_out == 0x00) {
+                zring_commit(&pipeline.out, CHUNK);
+                out_slot = zring_acquire_empty(&pipeline.out);
+                if (out_slot < 0x00) {
+                    ret = Z_ERRNO;
+                    break;
+                }
+                strm.next_out = (pipeline.out.mem + ((size_t)out_slot * CHUNK));
+                strm.avail_out = CHUNK;
+            }
+            ret = inflate(&strm, Z_NO_FLUSH);
+            if (ret == Z_NEED_DICT) ret = Z_DATA_ERROR;
+            else if (ret == Z_BUF_ERROR) ret = Z_OK;  // No progress was possible; Not fatal
+        } while (ret == Z_OK && strm.avail_out == 0x00);
+        zring_release(&pipeline.in);
+    } while (ret == Z_OK);
+    if (ret == Z_STREAM_END) {  // Hand over the final partial buffer
+        zring_commit(&pipeline.out, (CHUNK - strm.avail_out));
+        ret = Z_OK;
+    }
+    // Clean up and return
+    (void)inflateEnd(&strm);
+    return zlib_pipe_finish(&pipeline, ret, reader, writer);
+#else
+    return zlib_decompress_stream(source, dest);
+#endif
+}
+
+
+/** zlib buffer compression; `dest_len` holds the capacity of `dest` (see `compressBound()`) and receives the compressed size; `level` may be ZLEVEL_AUTO */
+int zlib_compress_buffer(const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len, const int level) {
+    const size_t dest_size = *dest_len;
+    size_t left_in = source_len, left_out = dest_size;
+    int ret;
+    z_stream strm;
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    ret = deflateInit(&strm, ((level == ZLEVEL_AUTO) ? zlib_auto_level(source, source_len, 0.0) : level));
+    if (ret != Z_OK) return ret;
+    strm.next_in = (Bytef *)(uintptr_t)source;
+    strm.avail_in = 0x00;
+    strm.next_out = dest;
+    strm.avail_out = 0x00;
+    do {  // Feed zlib in pieces that fit in its 32-bit counters
+        if (strm.avail_in == 0x00) {
+            strm.avail_in = (uInt)((left_in > (size_t)UINT_MAX) ? UINT_MAX : left_in);
+            left_in -= strm.avail_in;
+        }
+        if (strm.avail_out == 0x00) {
+            strm.avail_out = (uInt)((left_out > (size_t)UINT_MAX) ? UINT_MAX : left_out);
+            left_out -= strm.avail_out;
+        }
+        ret = deflate(&strm, (left_in ? Z_NO_FLUSH : Z_FINISH));
+    } while (ret == Z_OK && (strm.avail_out != 0x00 || left_out != 0x00));
+    *dest_len = (dest_size - left_out - strm.avail_out);
+    (void)deflateEnd(&strm);
+    if (ret == Z_STREAM_END) return Z_OK;
+    return ((ret == Z_OK) ? Z_BUF_ERROR : ret);
+}
+
+
+/** zlib/gzip buffer decompression into a newly allocated buffer (released with `free()`); Concatenated gzip members are all inflated, and trailing non-gzip data is ignored */
+int zlib_decompress_buffer(const uint8_t *source, const size_t source_len, uint8_t **dest, size_t *dest_len) {
+    size_t left_in = source_len, dest_size = ((source_len < (CHUNK >> 2)) ? CHUNK : (source_len << 2)), total = 0x00;
+    int ret;
+    z_stream strm;
+    uint8_t *buf = (uint8_t *)malloc(dest_size);
+    if (buf == (uint8_t *)NULL) return Z_MEM_ERROR;
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    strm.avail_in = 0x00;
+    strm.next_in = (Bytef *)(uintptr_t)source;
+    ret = inflateInit2(&strm, (MAX_WBITS + 32));  // Accept zlib and gzip headers
+    if (ret != Z_OK) {
+        free(buf);
+        return ret;
+    }
+    do {
+        if (strm.avail_in == 0x00) {
+            strm.avail_in = (uInt)((left_in > (size_t)UINT_MAX) ? UINT_MAX : left_in);
+            left_in -= strm.avail_in;
+        }
+        if (total == dest_size) {  // Grow the output buffer
+            uint8_t *grown = (uint8_t *)realloc(buf, (dest_size << 1));
+            if (grown == (uint8_t *)NULL) {
+                ret = Z_MEM_ERROR;
+                break;
+            }
+            buf = grown;
+            dest_size <<= 1;
+        }
+        const uInt room = (uInt)(((dest_size - total) > (size_t)UINT_MAX) ? UINT_MAX : (dest_size - total));
+        strm.next_out = (buf + total);
+        strm.avail_out = room;
+        ret = inflate(&strm, Z_NO_FLUSH);
+        total += (size_t)(room - strm.avail_out);
+        if (ret == Z_NEED_DICT) ret = Z_DATA_ERROR;
+        if (ret == Z_BUF_ERROR && strm.avail_in == 0x00 && left_in == 0x00) ret = Z_DATA_ERROR;  // Truncated input
+        if (ret == Z_STREAM_END && (strm.avail_in + left_in) >= 0x02 && strm.next_in[0] == 0x1F && strm.next_in[1] == 0x8B) ret = inflateReset(&strm);  // Continue with the next gzip member, as `zlib_inflate_members()` does
+    } while (ret == Z_OK || ret == Z_BUF_ERROR);
+    (void)inflateEnd(&strm);
+    if (ret != Z_STREAM_END) {
+        free(buf);
+        return ret;
+    }
+    *dest = buf;
+    *dest_len = total;
+    return Z_OK;
+}
+
+
+/* AUTOMATIC LEVEL */
+
+
+/** Private Function: Shannon entropy of a buffer (in bits per byte) */
+static double zlib_entropy(const uint8_t *data, const size_t len) {
+    size_t counts[256] = { 0x00 };
+    register size_t i;
+    double entropy = 0.0;
+    if (len == 0x00) return 0.0;
+    for (i = 0x00; i < len; i++) ++counts[data[i]];
+    for (i = 0x00; i < 256; i++) {
+        if (counts[i] != 0x00) {
+            const double p = ((double)counts[i] / (double)len);
+            entropy -= (p * log2(p));
+        }
+    }
+    return entropy;
+}
+
+
+/** Private Function: Compress a sample at `level`, reporting the ratio and the throughput (MiB/s) of deflate() itself (setup is not timed) */
+static int zlib_trial(const uint8_t *sample, const size_t len, const int level, double *ratio, double *mbps) {
+    uint8_t out[ZAUTO_SAMPLE + (ZAUTO_SAMPLE / 16) + 0x40];
+    struct timespec start, end;
+    z_stream strm;
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    int ret = deflateInit2(&strm, level, Z_DEFLATED, 13, 8, Z_DEFAULT_STRATEGY);  // An 8KiB window covers the whole sample
+    if (ret != Z_OK) return ret;
+    strm.next_in = (Bytef *)(uintptr_t)sample;
+    strm.avail_in = (uInt)len;
+    strm.next_out = out;
+    strm.avail_out = (uInt)sizeof(out);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    ret = deflate(&strm, Z_FINISH);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    const uLong out_len = strm.total_out;
+    (void)deflateEnd(&strm);
+    if (ret != Z_STREAM_END) return Z_BUF_ERROR;
+    const double elapsed = ((double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) * 1e-9));
+    *ratio = ((double)len / (double)out_len);
+    *mbps = ((elapsed > 0.0) ? ((double)len / (elapsed * 1048576.0)) : HUGE_VAL);
+    return Z_OK;
+}
+
+
+/** Pick a compression level for a block: 0 (stored) for incompressible data, ZLEVEL_STRONG when it pays off and keeps up with `budget_mbps`, otherwise ZLEVEL_FAST;
+The choice is made from a sample of ZAUTO_SLICES evenly spaced slices: a byte histogram rules out high-entropy (already compressed or encrypted) data, then timed trial compressions at both levels measure the ratio and speed;
+A budget of zero or less means that speed is not a concern; If even ZLEVEL_FAST cannot meet the budget, the block is stored */
+int zlib_auto_level(const uint8_t *block, const size_t len, const double budget_mbps) {
+    uint8_t sample[ZAUTO_SAMPLE];
+    const uint8_t *data = block;
+    size_t n = len;
+    double fast_ratio, fast_mbps, strong_ratio, strong_mbps;
+    if (len > ZAUTO_SAMPLE) {  // Gather the slices
+        const size_t slice = (ZAUTO_SAMPLE / ZAUTO_SLICES);
+        const size_t stride = ((len - slice) / (ZAUTO_SLICES - 1));
+        for (register size_t i = 0x00; i < ZAUTO_SLICES; i++) memcpy(sample + (i * slice), block + (i * stride), slice);
+        data = sample;
+        n = ZAUTO_SAMPLE;
+    }
+    if (n < 0x40) return ZLEVEL_FAST;  // Too small to judge
+    if (zlib_entropy(data, n) >= ZAUTO_STORE_ENTROPY) return 0x00;
+    if (zlib_trial(data, n, ZLEVEL_FAST, &fast_ratio, &fast_mbps) != Z_OK) return ZLEVEL_FAST;
+    if (fast_ratio < ZAUTO_STORE_RATIO || (budget_mbps > 0.0 && fast_mbps < budget_mbps)) return 0x00;
+    if (zlib_trial(data, n, ZLEVEL_STRONG, &strong_ratio, &strong_mbps) != Z_OK) return ZLEVEL_FAST;
+    if ((budget_mbps <= 0.0 || strong_mbps >= budget_mbps) && strong_ratio >= (fast_ratio * ZAUTO_STRONG_GAIN)) return ZLEVEL_STRONG;
+    return ZLEVEL_FAST;
+}
+
+
+/** zlib stream compression that picks the level of every CHUNK with `zlib_auto_level()` and switches with deflateParams(); Stored chunks pass through at close to memcpy speed */
+int zlib_compress_stream_auto(FILE *source, FILE *dest, const double budget_mbps) {
+    int ret, flush, level = ZLEVEL_STRONG;
+    unsigned have;
+    z_stream strm;
+    unsigned char in[CHUNK];
+    unsigned char out[CHUNK];
+    // Allocate deflate state
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    ret = deflateInit(&strm, level);
+    if (ret != Z_OK) return ret;
+    do {  // Compress until end of file
+        strm.avail_in = (unsigned int)fread(in, 1, CHUNK, source);
+        if (ferror(source)) {
+            (void)deflateEnd(&strm);
+            return Z_ERRNO;
+        }
+        flush = (feof(source) ? Z_FINISH : Z_NO_FLUSH);
+        const int want = zlib_auto_level(in, strm.avail_in, budget_mbps);
+        if (want != level) {  // Switching levels flushes the pending block, so the output buffer may need draining
+            const uInt pending = strm.avail_in;
+            strm.avail_in = 0x00;
+            do {
+                strm.avail_out = CHUNK;
+                strm.next_out = out;
+                ret = deflateParams(&strm, want, Z_DEFAULT_STRATEGY);
+                have = (CHUNK - strm.avail_out);
+                if ((fwrite(out, sizeof(char), have, dest)) != have || ferror(dest)) {
+                    (void)deflateEnd(&strm);
+                    return Z_ERRNO;
+                }
+            } while (ret == Z_BUF_ERROR && strm.avail_out == 0x00);
+            if (ret != Z_OK) {
+                (void)deflateEnd(&strm);
+                return ret;
+            }
+            strm.avail_in = pending;
+            level = want;
+        }
+        strm.next_in = in;
+        do {  // Run deflate() on input until output buffer is not full
+            strm.avail_out = CHUNK;
+            strm.next_out = out;
+            ret = deflate(&strm, flush);  // No bad return value
+            if (ret == Z_STREAM_ERROR) return Z_STREAM_ERROR;  // State not clobbered
+            have = (CHUNK - strm.avail_out);
+            if ((fwrite(out, sizeof(char), have, dest)) != have || ferror(dest)) {
+                (void)deflateEnd(&strm);
+                return Z_ERRNO;
+            }
+        } while (strm.avail_out == 0);
+        if (strm.avail_in != 0x00) return Z_STREAM_ERROR;  // All input will be used
+    } while (flush != Z_FINISH);
+    // Clean up and return
+    (void)deflateEnd(&strm);
+    return ((ret == Z_STREAM_END) ? Z_OK : Z_STREAM_ERROR);
+}
+
+
+/* REUSABLE CONTEXTS */
+
+
+/** Create a reusable compression context; Returns NULL for ZLEVEL_AUTO (a context keeps one level) or if zlib cannot allocate its state */
+zlib_ctx *zlib_ctx_create(const int level) {
+    if (level == ZLEVEL_AUTO) return (zlib_ctx *)NULL;
+    zlib_ctx *ctx = (zlib_ctx *)calloc(0x01, sizeof(zlib_ctx));
+    if (ctx == (zlib_ctx *)NULL) return (zlib_ctx *)NULL;
+    ctx->level = level;
+    ctx->deflater.zalloc = ctx->inflater.zalloc = Z_NULL;
+    ctx->deflater.zfree = ctx->inflater.zfree = Z_NULL;
+    ctx->deflater.opaque = ctx->inflater.opaque = Z_NULL;
+    if (deflateInit(&ctx->deflater, level) != Z_OK) {
+        free(ctx);
+        return (zlib_ctx *)NULL;
+    }
+    ctx->has_deflater = 0x01;
+    return ctx;
+}
+
+
+/** Reset a context without releasing zlib's state (`zlib_ctx_compress()` and `zlib_ctx_decompress()` do this themselves) */
+int zlib_ctx_reset(zlib_ctx *ctx) {
+    int ret = Z_OK;
+    if (ctx->has_deflater) ret = deflateReset(&ctx->deflater);
+    if (ctx->has_inflater && ret == Z_OK) ret = inflateReset(&ctx->inflater);
+    return ret;
+}
+
+
+/** Return the largest output that `zlib_ctx_compress()` can produce for `source_len` bytes */
+size_t zlib_ctx_bound(zlib_ctx *ctx, const size_t source_len) {
+    return (size_t)deflateBound(&ctx->deflater, (uLong)source_len);
+}
+
+
+/** Compress a buffer into a caller-provided buffer with a reusable context; `dest_len` holds the capacity of `dest` and receives the compressed size */
+int zlib_ctx_compress(zlib_ctx *ctx, const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len) {
+    if (source_len > (size_t)UINT_MAX) return Z_STREAM_ERROR;
+    int ret = deflateReset(&ctx->deflater);
+    if (ret == Z_OK && ctx->dict != (const uint8_t *)NULL) ret = deflateSetDictionary(&ctx->deflater, ctx->dict, ctx->dict_len);
+    if (ret != Z_OK) return ret;
+    ctx->deflater.next_in = (Bytef *)(uintptr_t)source;
+    ctx->deflater.avail_in = (uInt)source_len;
+    ctx->deflater.next_out = dest;
+    ctx->deflater.avail_out = (uInt)((*dest_len > (size_t)UINT_MAX) ? UINT_MAX : *dest_len);
+    ret = deflate(&ctx->deflater, Z_FINISH);
+    if (ret != Z_STREAM_END) return ((ret == Z_OK) ? Z_BUF_ERROR : ret);  // Output did not fit
+    *dest_len = (size_t)ctx->deflater.total_out;
+    return Z_OK;
+}
+
+
+/** Decompress a zlib buffer into a caller-provided buffer with a reusable context; `dest_len` holds the capacity of `dest` and receives the decompressed size */
+int zlib_ctx_decompress(zlib_ctx *ctx, const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len) {
+    int ret;
+    if (source_len > (size_t)UINT_MAX) return Z_STREAM_ERROR;
+    if (!ctx->has_inflater) {  // Most contexts only compress, so inflate state is made on demand
+        ctx->inflater.next_in = Z_NULL;
+        ctx->inflater.avail_in = 0x00;
+        ret = inflateInit(&ctx->inflater);
+        if (ret != Z_OK) return ret;
+        ctx->has_inflater = 0x01;
+    } else {
+        ret = inflateReset(&ctx->inflater);
+        if (ret != Z_OK) return ret;
+    }
+    ctx->inflater.next_in = (Bytef *)(uintptr_t)source;
+    ctx->inflater.avail_in = (uInt)source_len;
+    ctx->inflater.next_out = dest;
+    ctx->inflater.avail_out = (uInt)((*dest_len > (size_t)UINT_MAX) ? UINT_MAX : *dest_len);
+    ret = inflate(&ctx->inflater, Z_FINISH);
+    if (ret == Z_NEED_DICT && ctx->dict != (const uint8_t *)NULL) {  // Stream was made with a preset dictionary
+        ret = inflateSetDictionary(&ctx->inflater, ctx->dict, ctx->dict_len);
+        if (ret == Z_OK) ret = inflate(&ctx->inflater, Z_FINISH);
+    }
+    switch (ret) {
+        case Z_STREAM_END:
+            *dest_len = (size_t)ctx->inflater.total_out;
+            return Z_OK;
+        case Z_NEED_DICT:
+            return Z_DATA_ERROR;
+        case Z_BUF_ERROR:  // Output is full or input is truncated
+            return ((ctx->inflater.avail_out == 0x00) ? Z_BUF_ERROR : Z_DATA_ERROR);
+        case Z_OK:
+            return Z_BUF_ERROR;
+        default:
+            return ret;
+    }
+}
+
+
+/** Attach a preset dictionary (kept by reference, not copied) to a context, or detach it with NULL; Both sides of a stream must use the same dictionary */
+int zlib_ctx_set_dictionary(zlib_ctx *ctx, const uint8_t *dict, const size_t dict_len) {
+    if (dict == (const uint8_t *)NULL || dict_len == 0x00) {
+        ctx->dict = (const uint8_t *)NULL;
+        ctx->dict_len = 0x00;
+        return Z_OK;
+    }
+    // zlib only uses the last ZWINDOW bytes of a dictionary
+    ctx->dict = ((dict_len > ZWINDOW) ? (dict + dict_len - ZWINDOW) : dict);
+    ctx->dict_len = (uInt)((dict_len > ZWINDOW) ? ZWINDOW : dict_len);
+    return Z_OK;
+}
+
+
+/** Release a context made by `zlib_ctx_create()` */
+void zlib_ctx_destroy(zlib_ctx *ctx) {
+    if (ctx == (zlib_ctx *)NULL) return;
+    if (ctx->has_deflater) (void)deflateEnd(&ctx->deflater);
+    if (ctx->has_inflater) (void)inflateEnd(&ctx->inflater);
+    free(ctx);
+}
+
+
+/** Create a pool that keeps up to `size` idle contexts of one compression level; Returns NULL for ZLEVEL_AUTO, like `zlib_ctx_create()` */
+zlib_pool *zlib_pool_create(const unsigned int size, const int level) {
+    if (level == ZLEVEL_AUTO) return (zlib_pool *)NULL;
+    zlib_pool *pool = (zlib_pool *)calloc(0x01, sizeof(zlib_pool));
+    if (pool == (zlib_pool *)NULL) return (zlib_pool *)NULL;
+    pool->size = ((size == 0x00) ? 0x01 : size);
+    pool->level = level;
+    pool->idle = (zlib_ctx **)calloc((size_t)pool->size, sizeof(zlib_ctx *));
+    if (pool->idle == (zlib_ctx **)NULL) {
+        free(pool);
+        return (zlib_pool *)NULL;
+    }
+#ifdef __PTHREAD_ENABLED__
+    if (pthread_mutex_init(&pool->lock, NULL) != 0x00) {
+        free(pool->idle);
+        free(pool);
+        return (zlib_pool *)NULL;
+    }
+#endif
+    return pool;
+}
+
+
+/** Take an idle context from the pool, creating one if none is idle; Returns NULL if a new context cannot be made */
+zlib_ctx *zlib_pool_acquire(zlib_pool *pool) {
+    zlib_ctx *ctx = (zlib_ctx *)NULL;
+#ifdef __PTHREAD_ENABLED__
+    (void)pthread_mutex_lock(&pool->lock);
+#endif
+    if (pool->count != 0x00) ctx = pool->idle[--pool->count];
+#ifdef __PTHREAD_ENABLED__
+    (void)pthread_mutex_unlock(&pool->lock);
+#endif
+    return ((ctx != (zlib_ctx *)NULL) ? ctx : zlib_ctx_create(pool->level));
+}
+
+
+/** Return a context to the pool; It is destroyed if the pool is already full */
+void zlib_pool_release(zlib_pool *pool, zlib_ctx *ctx) {
+#ifdef __PTHREAD_ENABLED__
+    (void)pthread_mutex_lock(&pool->lock);
+#endif
+    if (pool->count < pool->size) {
+        pool->idle[pool->count++] = ctx;
+        ctx = (zlib_ctx *)NULL;
+    }
+#ifdef __PTHREAD_ENABLED__
+    (void)pthread_mutex_unlock(&pool->lock);
+#endif
+    zlib_ctx_destroy(ctx);
+}
+
+
+/** Destroy a pool and its idle contexts; Contexts still acquired must be released with `zlib_ctx_destroy()` */
+void zlib_pool_destroy(zlib_pool *pool) {
+    if (pool == (zlib_pool *)NULL) return;
+    while (pool->count != 0x00) zlib_ctx_destroy(pool->idle[--pool->count]);
+#ifdef __PTHREAD_ENABLED__
+    (void)pthread_mutex_destroy(&pool->lock);
+#endif
+    free(pool->idle);
+    free(pool);
+}
+
+
+/* PRESET DICTIONARIES */
+
+
+/** Private Function: Hash the ZDICT_KMER bytes at `src` into ZDICT_HASH_LOG bits */
+static uint32_t zdict_hash(const uint8_t *src) {
+    uint64_t val;
+    memcpy(&val, src, ZDICT_KMER);
+    return (uint32_t)((val * 0x9E3779B97F4A7C15ULL) >> (64 - ZDICT_HASH_LOG));
+}
+
+
+/** Private Function: Order dictionary segments by ascending score; qsort() callback */
+static int zdict_segment_cmp(const void *a, const void *b) {
+    const uint64_t x = ((const zdict_segment *)a)->score, y = ((const zdict_segment *)b)->score;
+    return ((x > y) - (x < y));
+}
+
+
+/** Train a preset dictionary from concatenated sample records; `dict_len` holds the capacity of `dict` (at most ZWINDOW is used) and receives the dictionary size */
+int zlib_train_dictionary(const uint8_t *samples, const size_t samples_len, uint8_t *dict, size_t *dict_len) {
+    const size_t capacity = ((*dict_len > ZWINDOW) ? ZWINDOW : *dict_len);
+    register size_t i, j;
+    if (samples_len <= capacity || capacity < ZDICT_SEGMENT) {  // Nothing to choose from; Use the newest samples as they are
+        const size_t len = ((samples_len < capacity) ? samples_len : capacity);
+        memcpy(dict, (samples + samples_len - len), len);
+        *dict_len = len;
+        return Z_OK;
+    }
+    const size_t last = (samples_len - ZDICT_SEGMENT);  // Last possible segment start
+    const size_t nsegments = (capacity / ZDICT_SEGMENT);
+    const size_t epoch = ((last + 1) / nsegments);
+    size_t picked = 0x00;
+    uint32_t *counts = (uint32_t *)calloc((size_t)0x01 << ZDICT_HASH_LOG, sizeof(uint32_t));
+    zdict_segment *chosen = (zdict_segment *)calloc(nsegments, sizeof(zdict_segment));
+    if (counts == (uint32_t *)NULL || chosen == (zdict_segment *)NULL) {
+        free(counts);
+        free(chosen);
+        return Z_MEM_ERROR;
+    }
+    // Count every substring of the samples
+    for (i = 0x00; (i + ZDICT_KMER) <= samples_len; i++) counts[zdict_hash(samples + i)]++;
+    // Take the best segment of each epoch, then forget its substrings so that later segments add new content
+    for (j = 0x00; j < nsegments; j++) {
+        const size_t begin = (j * epoch), end = ((j == nsegments - 1) ? (last + 1) : (begin + epoch));
+        register size_t k;
+        uint64_t score = 0x00, best;
+        size_t best_pos = begin;
+        for (k = 0x00; k <= (ZDICT_SEGMENT - ZDICT_KMER); k++) score += counts[zdict_hash(samples + begin + k)];
+        best = score;
+        for (i = (begin + 1); i < end; i++) {  // Slide the segment one byte at a time
+            score -= counts[zdict_hash(samples + i - 1)];
+            score += counts[zdict_hash(samples + i + ZDICT_SEGMENT - ZDICT_KMER)];
+            if (score > best) {
+                best = score;
+                best_pos = i;
+            }
+        }
+        if (best == 0x00) continue;
+        for (k = 0x00; k <= (ZDICT_SEGMENT - ZDICT_KMER); k++) counts[zdict_hash(samples + best_pos + k)] = 0x00;
+        chosen[picked].pos = best_pos;
+        chosen[picked].score = best;
+        picked++;
+    }
+    // deflate reaches nearby data most cheaply, so the most valuable segments go last
+    qsort(chosen, picked, sizeof(zdict_segment), zdict_segment_cmp);
+    for (i = 0x00; i < picked; i++) memcpy((dict + (i * ZDICT_SEGMENT)), (samples + chosen[i].pos), ZDICT_SEGMENT);
+    *dict_len = (picked * ZDICT_SEGMENT);
+    free(counts);
+    free(chosen);
+    return Z_OK;
+}
+
+
+/** Save a preset dictionary to a file */
+int zlib_save_dictionary(const uint8_t *dict, const size_t dict_len, char *dict_filename) {
+    FILE *dest = fopen(dict_filename, "wb");
+    if (dest == (FILE *)NULL) return Z_ERRNO;
+    int ret = ((fwrite(dict, 0x01, dict_len, dest) != dict_len) ? Z_ERRNO : Z_OK);
+    if (fclose(dest) != 0x00) ret = Z_ERRNO;
+    return ret;
+}
+
+
+/** Load a preset dictionary from a file; `dict_len` holds the capacity of `dict` and receives the dictionary size */
+int zlib_load_dictionary(char *dict_filename, uint8_t *dict, size_t *dict_len) {
+    FILE *source = fopen(dict_filename, "rb");
+    if (source == (FILE *)NULL) return Z_ERRNO;
+    const size_t capacity = ((*dict_len > ZWINDOW) ? ZWINDOW : *dict_len);
+    *dict_len = fread(dict, 0x01, capacity, source);
+    const int ret = (ferror(source) ? Z_ERRNO : Z_OK);
+    fclose(source);
+    return ret;
+}
+
+
+/** Compress a buffer with a preset dictionary; `dest_len` holds the capacity of `dest` and receives the compressed size; ZLEVEL_AUTO is rejected with Z_STREAM_ERROR */
+int zlib_compress_dict(const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len, const int level, const uint8_t *dict, const size_t dict_len) {
+    int ret;
+    z_stream strm;
+    if (source_len > (size_t)UINT_MAX) return Z_STREAM_ERROR;
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    ret = deflateInit(&strm, level);
+    if (ret != Z_OK) return ret;
+    ret = deflateSetDictionary(&strm, ((dict_len > ZWINDOW) ? (dict + dict_len - ZWINDOW) : dict), (uInt)((dict_len > ZWINDOW) ? ZWINDOW : dict_len));
+    if (ret == Z_OK) {
+        strm.next_in = (Bytef *)(uintptr_t)source;
+        strm.avail_in = (uInt)source_len;
+        strm.next_out = dest;
+        strm.avail_out = (uInt)((*dest_len > (size_t)UINT_MAX) ? UINT_MAX : *dest_len);
+        ret = deflate(&strm, Z_FINISH);
+        if (ret == Z_STREAM_END) {
+            *dest_len = (size_t)strm.total_out;
+            ret = Z_OK;
+        } else if (ret == Z_OK) ret = Z_BUF_ERROR;  // Output did not fit
+    }
+    (void)deflateEnd(&strm);
+    return ret;
+}
+
+
+/** Decompress a buffer made with a preset dictionary; `dest_len` holds the capacity of `dest` and receives the decompressed size */
+int zlib_decompress_dict(const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len, const uint8_t *dict, const size_t dict_len) {
+    int ret;
+    z_stream strm;
+    if (source_len > (size_t)UINT_MAX) return Z_STREAM_ERROR;
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    strm.next_in = (Bytef *)(uintptr_t)source;
+    strm.avail_in = (uInt)source_len;
+    ret = inflateInit(&strm);
+    if (ret != Z_OK) return ret;
+    strm.next_out = dest;
+    strm.avail_out = (uInt)((*dest_len > (size_t)UINT_MAX) ? UINT_MAX : *dest_len);
+    ret = inflate(&strm, Z_FINISH);
+    if (ret == Z_NEED_DICT) {
+        ret = inflateSetDictionary(&strm, ((dict_len > ZWINDOW) ? (dict + dict_len - ZWINDOW) : dict), (uInt)((dict_len > ZWINDOW) ? ZWINDOW : dict_len));
+        if (ret == Z_OK) ret = inflate(&strm, Z_FINISH);
+        else ret = Z_DATA_ERROR;  // Wrong dictionary
+    }
+    if (ret == Z_STREAM_END) {
+        *dest_len = (size_t)strm.total_out;
+        ret = Z_OK;
+    } else if (ret == Z_OK || (ret == Z_BUF_ERROR && strm.avail_out == 0x00)) ret = Z_BUF_ERROR;
+    else if (ret == Z_BUF_ERROR || ret == Z_NEED_DICT) ret = Z_DATA_ERROR;
+    (void)inflateEnd(&strm);
+    return ret;
+}
+
+
+#ifdef OSPOSIX
+/** Private Function: Run deflate() or inflate() over a file that is memory-mapped one window at a time; Output goes through a fixed CHUNK-sized buffer */
+static int zlib_mmap_run(const int fd, const ulint source_size, z_stream *strm, FILE *dest, const int deflating) {
+    unsigned char out[CHUNK];
+    unsigned have;
+    int ret = Z_OK, flush = Z_NO_FLUSH;
+    ulint offset = 0x00;
+    do {  // Map, consume, and unmap each window of the source
+        const size_t window = (size_t)(((source_size - offset) < ZMAP_WINDOW) ? (source_size - offset) : ZMAP_WINDOW);
+        void *map = NULL;
+        if (window != 0x00) {
+            map = mmap(NULL, window, PROT_READ, MAP_PRIVATE, fd, (off_t)offset);
+            if (map == MAP_FAILED) return Z_ERRNO;
+            (void)madvise(map, window, MADV_SEQUENTIAL);
+        }
+        offset += (ulint)window;
+        if (deflating && offset == source_size) flush = Z_FINISH;
+        strm->next_in = (Bytef *)map;
+        strm->avail_in = (uInt)window;
+        do {  // Drain the output buffer until the window is consumed
+            strm->avail_out = CHUNK;
+            strm->next_out = out;
+            ret = (deflating ? deflate(strm, flush) : inflate(strm, Z_NO_FLUSH));
+            switch (ret) {
+                case Z_NEED_DICT:
+                    ret = Z_DATA_ERROR;  // Fall through
+                case Z_STREAM_ERROR:
+                case Z_DATA_ERROR:
+                case Z_MEM_ERROR:
+                    if (map != NULL) (void)munmap(map, window);
+                    return ret;
+                default: break;
+            }
+            have = (CHUNK - strm->avail_out);
+            if ((fwrite(out, sizeof(char), have, dest)) != have || ferror(dest)) {
+                if (map != NULL) (void)munmap(map, window);
+                return Z_ERRNO;
+            }
+        } while (strm->avail_out == 0x00 && ret != Z_STREAM_END);
+        if (map != NULL) (void)munmap(map, window);
+    } while (offset < source_size && ret != Z_STREAM_END);
+    return ((ret == Z_STREAM_END) ? Z_OK : (deflating ? Z_STREAM_ERROR : Z_DATA_ERROR));
+}
+#endif
+
+
+/** zlib file compression with constant memory use; POSIX systems map the source with mmap() and stream the output through a fixed-size buffer; ZLEVEL_AUTO goes through `zlib_compress_stream_auto()` instead; Return Z_ERRNO when a file cannot be opened */
+int zlib_compress_file_mmap(char *source_filename, char *dest_filename, const int level) {
+    int ret;
+#ifdef OSPOSIX
+    if (level != ZLEVEL_AUTO) {
+        const int fd = open(source_filename, O_RDONLY);
+        if (fd < 0x00) return Z_ERRNO;
+        FILE *dest = fopen(dest_filename, "wb");
+        if (dest == (FILE *)NULL) {
+            close(fd);
+            return Z_ERRNO;
+        }
+        z_stream strm;
+        strm.zalloc = Z_NULL;
+        strm.zfree = Z_NULL;
+        strm.opaque = Z_NULL;
+        ret = deflateInit(&strm, level);
+        if (ret == Z_OK) {
+            ret = zlib_mmap_run(fd, getfilesize(source_filename), &strm, dest, 0x01);
+            (void)deflateEnd(&strm);
+        }
+        close(fd);
+        if (fclose(dest) != 0x00 && ret == Z_OK) ret = Z_ERRNO;
+        return ret;
+    }
+#endif
+    FILE *source = fopen(source_filename, "rb");
+    if (source == (FILE *)NULL) return Z_ERRNO;
+    FILE *dest = fopen(dest_filename, "wb");
+    if (dest == (FILE *)NULL) {
+        fclose(source);
+        return Z_ERRNO;
+    }
+    ret = ((level == ZLEVEL_AUTO) ? zlib_compress_stream_auto(source, dest, 0.0) : zlib_compress_stream(source, dest, level));
+    fclose(source);
+    if (fclose(dest) != 0x00 && ret == Z_OK) ret = Z_ERRNO;
+    return ret;
+}
+
+
+/** zlib file decompression with constant memory use; POSIX systems map the source with mmap() and stream the output through a fixed-size buffer; Return Z_ERRNO when a file cannot be opened */
+int zlib_decompress_file_mmap(char *source_filename, char *dest_filename) {
+    int ret;
+#ifdef OSPOSIX
+    const int fd = open(source_filename, O_RDONLY);
+    if (fd < 0x00) return Z_ERRNO;
+    FILE *dest = fopen(dest_filename, "wb");
+    if (dest == (FILE *)NULL) {
+        close(fd);
+        return Z_ERRNO;
+    }
+    z_stream strm;
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    strm.avail_in = 0x00;
+    strm.next_in = Z_NULL;
+    ret = inflateInit(&strm);
+    if (ret == Z_OK) {
+        ret = zlib_mmap_run(fd, getfilesize(source_filename), &strm, dest, 0x00);
+        (void)inflateEnd(&strm);
+    }
+    close(fd);
+#else
+    FILE *source = fopen(source_filename, "rb");
+    if (source == (FILE *)NULL) return Z_ERRNO;
+    FILE *dest = fopen(dest_filename, "wb");
+    if (dest == (FILE *)NULL) {
+        fclose(source);
+        return Z_ERRNO;
+    }
+    ret = zlib_decompress_stream(source, dest);
+    fclose(source);
+#endif
+    if (fclose(dest) != 0x00 && ret == Z_OK) ret = Z_ERRNO;
+    return ret;
+}
+
+
+/* LZ CODEC */
+
+
+/** Private Function: Unaligned 32-bit load */
+static uint32_t lz_read32(const uint8_t *src) {
+    uint32_t val;
+    memcpy(&val, src, sizeof(uint32_t));
+    return val;
+}
+
+
+/** Private Function: Unaligned 64-bit load */
+static uint64_t lz_read64(const uint8_t *src) {
+    uint64_t val;
+    memcpy(&val, src, sizeof(uint64_t));
+    return val;
+}
+
+
+/** Private Function: Store a 32-bit value in little-endian byte order */
+static void lz_put32(uint8_t *dst, const uint32_t val) {
+    dst[0] = (uint8_t)val;
+    dst[1] = (uint8_t)(val >> 8);
+    dst[2] = (uint8_t)(val >> 16);
+    dst[3] = (uint8_t)(val >> 24);
+}
+
+
+/** Private Function: Load a little-endian 32-bit value */
+static uint32_t lz_get32(const uint8_t *src) {
+    return ((uint32_t)src[0] | ((uint32_t)src[1] << 8) | ((uint32_t)src[2] << 16) | ((uint32_t)src[3] << 24));
+}
+
+
+/** Private Function: Multiplicative hash of a 4-byte sequence into the LZ match table */
+static uint32_t lz_hash(const uint32_t sequence) {
+    return (uint32_t)((sequence * 2654435761U) >> (32 - LZ_HASH_LOG));
+}
+
+
+/** Private Function: Write the 255-run extension bytes of a literal or match length */
+static uint8_t *lz_put_length(uint8_t *dest, size_t len) {
+    while (len >= 255) {
+        *dest++ = 0xFF;
+        len -= 255;
+    }
+    *dest++ = (uint8_t)len;
+    return dest;
+}
+
+
+/** Worst-case size of an LZ block holding `source_len` bytes */
+size_t lz_compress_bound(const size_t source_len) {
+    return LZ_COMPRESS_BOUND(source_len);
+}
+
+
+/** Compress a buffer into one LZ4-style block (greedy single-probe matcher, 64KiB window); `dest_len` holds the capacity of `dest` and receives the compressed size */
+int lz_compress_block(const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len) {
+    uint32_t table[1 << LZ_HASH_LOG];
+    const uint8_t *ip = source, *anchor = source;
+    const uint8_t *const iend = source + source_len;
+    uint8_t *op = dest, *token;
+    uint8_t *const oend = dest + *dest_len;
+    size_t lit;
+    if (source_len > (size_t)UINT32_MAX) return Z_STREAM_ERROR;
+    if (source_len > LZ_MF_LIMIT) {
+        const uint8_t *const mflimit = iend - LZ_MF_LIMIT;
+        const uint8_t *const matchlimit = iend - LZ_LAST_LITERALS;
+        memset(table, 0x00, sizeof(table));
+        while (ip < mflimit) {
+            const uint32_t sequence = lz_read32(ip);
+            const uint32_t h = lz_hash(sequence);
+            const uint8_t *ref = source + table[h];
+            table[h] = (uint32_t)(ip - source);
+            if (ref >= ip || (size_t)(ip - ref) > LZ_MAX_DISTANCE || lz_read32(ref) != sequence) {
+                ip += 1 + ((size_t)(ip - anchor) >> 6);  // Skip faster through incompressible data
+                continue;
+            }
+            while (ip > anchor && ref > source && ip[-1] == ref[-1]) {  // Extend the match backwards over pending literals
+                --ip;
+                --ref;
+            }
+            const uint8_t *mp = ip + LZ_MIN_MATCH, *rp = ref + LZ_MIN_MATCH;
+            while ((mp + 8) <= matchlimit && lz_read64(mp) == lz_read64(rp)) {
+                mp += 8;
+                rp += 8;
+            }
+            while (mp < matchlimit && *mp == *rp) {
+                ++mp;
+                ++rp;
+            }
+            lit = (size_t)(ip - anchor);
+            const size_t mlen = (size_t)(mp - ip) - LZ_MIN_MATCH;
+            const size_t offset = (size_t)(ip - ref);
+            if ((size_t)(oend - op) < (lit + (lit / 255) + (mlen / 255) + 5)) return Z_BUF_ERROR;
+            token = op++;
+            *token = (uint8_t)((lit >= 15) ? 0xF0 : (lit << 4));
+            if (lit >= 15) op = lz_put_length(op, lit - 15);
+            memcpy(op, anchor, lit);
+            op += lit;
+            *op++ = (uint8_t)(offset & 0xFF);
+            *op++ = (uint8_t)(offset >> 8);
+            *token |= (uint8_t)((mlen >= 15) ? 0x0F : mlen);
+            if (mlen >= 15) op = lz_put_length(op, mlen - 15);
+            ip = mp;
+            anchor = ip;
+            if (ip < mflimit) table[lz_hash(lz_read32(ip - 2))] = (uint32_t)(ip - 2 - source);  // Seed the table from the end of the match
+        }
+    }
+    lit = (size_t)(iend - anchor);  // The block always ends with a literal-only sequence
+    if ((size_t)(oend - op) < (lit + (lit / 255) + 2)) return Z_BUF_ERROR;
+    token = op++;
+    *token = (uint8_t)((lit >= 15) ? 0xF0 : (lit << 4));
+    if (lit >= 15) op = lz_put_length(op, lit - 15);
+    memcpy(op, anchor, lit);
+    op += lit;
+    *dest_len = (size_t)(op - dest);
+    return Z_OK;
+}
+
+
+/** Decompress one LZ block; `dest_len` holds the capacity of `dest` and receives the decompressed size; Malformed input never reads or writes out of bounds */
+int lz_decompress_block(const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len) {
+    const uint8_t *ip = source;
+    const uint8_t *const iend = source + source_len;
+    uint8_t *op = dest;
+    uint8_t *const oend = dest + *dest_len;
+    while (ip < iend) {
+        const unsigned int token = *ip++;
+        size_t len = (size_t)(token >> 4), offset;
+        if (len == 15) {
+            unsigned int byte;
+            do {
+                if (ip >= iend) return Z_DATA_ERROR;
+                byte = *ip++;
+                len += byte;
+            } while (byte == 255);
+        }
+        if ((size_t)(iend - ip) < len) return Z_DATA_ERROR;
+        if ((size_t)(oend - op) < len) return Z_BUF_ERROR;
+        memcpy(op, ip, len);
+        ip += len;
+        op += len;
+        if (ip == iend) break;  // The last sequence has no match
+        if ((iend - ip) < 2) return Z_DATA_ERROR;
+        offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+        ip += 2;
+        if (offset == 0x00 || offset > (size_t)(op - dest)) return Z_DATA_ERROR;
+        len = (size_t)(token & 0x0F);
+        if (len == 15) {
+            unsigned int byte;
+            do {
+                if (ip >= iend) return Z_DATA_ERROR;
+                byte = *ip++;
+                len += byte;
+            } while (byte == 255);
+        }
+        len += LZ_MIN_MATCH;
+        if ((size_t)(oend - op) < len) return Z_BUF_ERROR;
+        const uint8_t *ref = op - offset;
+        if (offset >= 8 && (size_t)(oend - op) >= (len + 8)) {  // Copy whole words; The overshoot is rewritten by the next sequence
+            uint8_t *const end = op + len;
+            do {
+                memcpy(op, ref, 8);
+                op += 8;
+                ref += 8;
+            } while (op < end);
+            op = end;
+        } else if (offset >= len) {
+            memcpy(op, ref, len);
+            op += len;
+        } else {
+            while (len--) *op++ = *ref++;  // Overlapping copy repeats the last `offset` bytes
+        }
+    }
+    *dest_len = (size_t)(op - dest);
+    return Z_OK;
+}
+
+
+/** LZ stream compression; The stream is LZ_MAGIC followed by independent CHUNK-sized blocks, each with a little-endian header of raw size and stored size, and ends with a zero raw size */
+int lz_compress_stream(FILE *source, FILE *dest) {
+    unsigned char in[CHUNK];
+    unsigned char out[LZ_COMPRESS_BOUND(CHUNK)];
+    unsigned char header[8];
+    if (fwrite(LZ_MAGIC, sizeof(char), 4, dest) != 4) return Z_ERRNO;
+    for (;;) {
+        const size_t have = fread(in, sizeof(char), CHUNK, source);
+        if (ferror(source)) return Z_ERRNO;
+        if (have == 0x00) break;
+        size_t out_len = sizeof(out);
+        int ret = lz_compress_block(in, have, out, &out_len);
+        if (ret != Z_OK) return ret;
+        const int stored = (out_len >= have);  // Incompressible blocks are kept as they are
+        const uint32_t size = (stored ? ((uint32_t)have | LZ_STORED) : (uint32_t)out_len);
+        lz_put32(header, (uint32_t)have);
+        lz_put32(header + 4, size);
+        if (fwrite(header, sizeof(char), 8, dest) != 8) return Z_ERRNO;
+        if (stored) {
+            if (fwrite(in, sizeof(char), have, dest) != have) return Z_ERRNO;
+        } else if (fwrite(out, sizeof(char), out_len, dest) != out_len) return Z_ERRNO;
+    }
+    memset(header, 0x00, 4);
+    if (fwrite(header, sizeof(char), 4, dest) != 4 || ferror(dest)) return Z_ERRNO;
+    return Z_OK;
+}
+
+
+/** LZ stream decompression */
+int lz_decompress_stream(FILE *source, FILE *dest) {
+    unsigned char in[LZ_COMPRESS_BOUND(CHUNK)];
+    unsigned char out[CHUNK];
+    unsigned char header[8];
+    if (fread(header, sizeof(char), 4, source) != 4) return (ferror(source) ? Z_ERRNO : Z_DATA_ERROR);
+    if (memcmp(header, LZ_MAGIC, 4) != 0x00) return Z_DATA_ERROR;
+    for (;;) {
+        if (fread(header, sizeof(char), 4, source) != 4) return (ferror(source) ? Z_ERRNO : Z_DATA_ERROR);
+        const size_t raw_len = (size_t)lz_get32(header);
+        if (raw_len == 0x00) break;
+        if (raw_len > CHUNK) return Z_DATA_ERROR;
+        if (fread(header + 4, sizeof(char), 4, source) != 4) return (ferror(source) ? Z_ERRNO : Z_DATA_ERROR);
+        const uint32_t size = lz_get32(header + 4);
+        const size_t len = (size_t)(size & ~LZ_STORED);
+        if (len > sizeof(in) || ((size & LZ_STORED) && len != raw_len)) return Z_DATA_ERROR;
+        if (fread(in, sizeof(char), len, source) != len) return (ferror(source) ? Z_ERRNO : Z_DATA_ERROR);
+        if (size & LZ_STORED) {
+            if (fwrite(in, sizeof(char), len, dest) != len) return Z_ERRNO;
+            continue;
+        }
+        size_t out_len = raw_len;
+        if (lz_decompress_block(in, len, out, &out_len) != Z_OK || out_len != raw_len) return Z_DATA_ERROR;
+        if (fwrite(out, sizeof(char), out_len, dest) != out_len) return Z_ERRNO;
+    }
+    return (ferror(dest) ? Z_ERRNO : Z_OK);
+}
+
+
+/** LZ file compression; Return Z_ERRNO when a file cannot be opened */
+int lz_compress_file(char *source_filename, char *dest_filename) {
+    FILE *source = fopen(source_filename, "rb");
+    if (source == (FILE *)NULL) return Z_ERRNO;
+    FILE *dest = fopen(dest_filename, "wb");
+    if (dest == (FILE *)NULL) {
+        fclose(source);
+        return Z_ERRNO;
+    }
+    int ret = lz_compress_stream(source, dest);
+    fclose(source);
+    if (fclose(dest) != 0x00 && ret == Z_OK) ret = Z_ERRNO;
+    return ret;
+}
+
+
+/** LZ file decompression; Return Z_ERRNO when a file cannot be opened */
+int lz_decompress_file(char *source_filename, char *dest_filename) {
+    FILE *source = fopen(source_filename, "rb");
+    if (source == (FILE *)NULL) return Z_ERRNO;
+    FILE *dest = fopen(dest_filename, "wb");
+    if (dest == (FILE *)NULL) {
+        fclose(source);
+        return Z_ERRNO;
+    }
+    int ret = lz_decompress_stream(source, dest);
+    fclose(source);
+    if (fclose(dest) != 0x00 && ret == Z_OK) ret = Z_ERRNO;
+    return ret;
+}
+
+
+/* CODEC SELECTION */
+
+
+/** Worst-case compressed size of `source_len` bytes for the chosen codec */
+size_t codec_compress_bound(const int codec, const size_t source_len) {
+    return ((codec == CODEC_LZ) ? LZ_COMPRESS_BOUND(source_len) : (size_t)compressBound((uLong)source_len));
+}
+
+
+/** Compress a buffer with the chosen codec (`level` only applies to CODEC_ZLIB); `dest_len` holds the capacity of `dest` and receives the compressed size */
+int codec_compress_block(const int codec, const int level, const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len) {
+    switch (codec) {
+        case CODEC_ZLIB: return zlib_compress_buffer(source, source_len, dest, dest_len, level);
+        case CODEC_LZ: return lz_compress_block(source, source_len, dest, dest_len);
+        default: return Z_STREAM_ERROR;
+    }
+}
+
+
+/** Decompress a buffer made with the chosen codec; `dest_len` holds the capacity of `dest` and receives the decompressed size */
+int codec_decompress_block(const int codec, const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len) {
+    switch (codec) {
+        case CODEC_ZLIB: {
+            uLongf out_len = (uLongf)*dest_len;
+            const int ret = uncompress(dest, &out_len, source, (uLong)source_len);
+            if (ret == Z_OK) *dest_len = (size_t)out_len;
+            return ret;
+        }
+        case CODEC_LZ: return lz_decompress_block(source, source_len, dest, dest_len);
+        default: return Z_STREAM_ERROR;
+    }
+}
+
+
+/** Stream compression with the chosen codec (`level` only applies to CODEC_ZLIB) */
+int codec_compress_stream(FILE *source, FILE *dest, const int codec, const int level) {
+    switch (codec) {
+        case CODEC_ZLIB: return zlib_compress_stream(source, dest, level);
+        case CODEC_LZ: return lz_compress_stream(source, dest);
+        default: return Z_STREAM_ERROR;
+    }
+}
+
+
+/** Stream decompression with the chosen codec */
+int codec_decompress_stream(FILE *source, FILE *dest, const int codec) {
+    switch (codec) {
+        case CODEC_ZLIB: return zlib_decompress_stream(source, dest);
+        case CODEC_LZ: return lz_decompress_stream(source, dest);
+        default: return Z_STREAM_ERROR;
+    }
+}
+
+
+/** File compression with the chosen codec (`level` only applies to CODEC_ZLIB) */
+int codec_compress_file(char *source_filename, char *dest_filename, const int codec, const int level) {
+    switch (codec) {
+        case CODEC_ZLIB: return zlib_compress_file_mmap(source_filename, dest_filename, level);
+        case CODEC_LZ: return lz_compress_file(source_filename, dest_filename);
+        default: return Z_STREAM_ERROR;
+    }
+}
+
+
+/** File decompression with the chosen codec */
+int codec_decompress_file(char *source_filename, char *dest_filename, const int codec) {
+    switch (codec) {
+        case CODEC_ZLIB: return zlib_decompress_file_mmap(source_filename, dest_filename);
+        case CODEC_LZ: return lz_decompress_file(source_filename, dest_filename);
+        default: return Z_STREAM_ERROR;
+    }
+}
+
+
+/* RANDOM ACCESS */
+
+
+/** Private Function: Store a 64-bit integer as little-endian bytes */
+static void zindex_put64(uint8_t *dst, uint64_t val) {
+    register uint_fast8_t i;
+    for (i = 0x00; i < 0x08; i++) {
+        dst[i] = (uint8_t)val;
+        val >>= 8;
+    }
+}
+
+
+/** Private Function: Load a 64-bit integer from little-endian bytes */
+static uint64_t zindex_get64(const uint8_t *src) {
+    register uint64_t val = 0x00;
+    register int_fast8_t i;
+    for (i = 0x07; i >= 0x00; i--) val = ((val << 8) | (uint64_t)src[i]);
+    return val;
+}
+
+
+/** Private Function: Append a checkpoint to an index; `window` is the circular output buffer and `left` is its unused space */
+static int zlib_index_addpoint(zindex *index, const int bits, const uint64_t in, const uint64_t out, const unsigned int left, const unsigned char *window) {
+    if (index->have == index->size) {  // Grow the checkpoint list
+        const size_t size = ((index->size == 0x00) ? 0x08 : (index->size << 1));
+        zindex_point *list = (zindex_point *)realloc(index->list, size * sizeof(zindex_point));
+        if (list == (zindex_point *)NULL) return Z_MEM_ERROR;
+        index->list = list;
+        index->size = size;
+    }
+    zindex_point *next = (index->list + index->have);
+    next->bits = bits;
+    next->in = in;
+    next->out = out;
+    if (left) memcpy(next->window, (window + ZWINDOW - left), left);
+    if (left < ZWINDOW) memcpy((next->window + left), window, (ZWINDOW - left));
+    index->have++;
+    return Z_OK;
+}
+
+
+/** Build a random-access index of a zlib or gzip stream with a checkpoint about every `span` uncompressed bytes */
+int zlib_build_index(FILE *source, const uint64_t span, zindex **built) {
+    int ret;
+    uint64_t totin = 0x00, totout = 0x00, last = 0x00;
+    unsigned char input[CHUNK];
+    unsigned char window[ZWINDOW];
+    z_stream strm;
+    zindex *index = (zindex *)calloc(0x01, sizeof(zindex));
+    if (index == (zindex *)NULL) return Z_MEM_ERROR;
+    // Allocate inflate state (automatic zlib/gzip header detection)
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    strm.avail_in = 0x00;
+    strm.next_in = Z_NULL;
+    strm.avail_out = 0x00;
+    ret = inflateInit2(&strm, (MAX_WBITS + 32));
+    if (ret != Z_OK) {
+        free(index);
+        return ret;
+    }
+    do {  // Inflate the input, stopping at each deflate block boundary
+        strm.avail_in = (unsigned int)fread(input, 0x01, CHUNK, source);
+        if (ferror(source)) {
+            ret = Z_ERRNO;
+            break;
+        }
+        if (strm.avail_in == 0x00) {
+            ret = Z_DATA_ERROR;
+            break;
+        }
+        strm.next_in = input;
+        do {
+            if (strm.avail_out == 0x00) {  // Reuse the circular window
+                strm.avail_out = ZWINDOW;
+                strm.next_out = window;
+            }
+            totin += strm.avail_in;
+            totout += strm.avail_out;
+            ret = inflate(&strm, Z_BLOCK);
+            totin -= strm.avail_in;
+            totout -= strm.avail_out;
+            if (ret == Z_NEED_DICT) ret = Z_DATA_ERROR;
+            if (ret == Z_MEM_ERROR || ret == Z_DATA_ERROR || ret == Z_STREAM_END) break;
+            // Record a checkpoint at the end of a non-final block once `span` bytes have passed
+            if ((strm.data_type & 128) && !(strm.data_type & 64) && (totout == 0x00 || (totout - last) > span)) {
+                ret = zlib_index_addpoint(index, (strm.data_type & 7), totin, totout, strm.avail_out, window);
+                if (ret != Z_OK) break;
+                last = totout;
+            }
+        } while (strm.avail_in != 0x00);
+    } while (ret == Z_OK || ret == Z_BUF_ERROR);
+    (void)inflateEnd(&strm);
+    if (ret != Z_STREAM_END) {
+        zlib_free_index(index);
+        return ret;
+    }
+    index->length = totout;
+    *built = index;
+    return Z_OK;
+}
+
+
+/** Free an index made by `zlib_build_index()` or `zlib_load_index()` */
+void zlib_free_index(zindex *index) {
+    if (index == (zindex *)NULL) return;
+    free(index->list);
+    free(index);
+}
+
+
+/** Save an index to a sidecar file; Checkpoint windows are stored deflated */
+int zlib_save_index(const zindex *index, char *index_filename) {
+    FILE *dest = fopen(index_filename, "wb");
+    if (dest == (FILE *)NULL) return Z_ERRNO;
+    int ret = Z_OK;
+    register size_t i;
+    uint8_t header[0x18];
+    Bytef packed[ZWINDOW + 0x40];
+    memcpy(header, ZINDEX_MAGIC, 0x04);
+    header[4] = 0x01;  // Format version
+    header[5] = header[6] = header[7] = 0x00;
+    zindex_put64((header + 0x08), (uint64_t)index->have);
+    zindex_put64((header + 0x10), index->length);
+    if (fwrite(header, 0x01, 0x18, dest) != 0x18) ret = Z_ERRNO;
+    for (i = 0x00; i < index->have && ret == Z_OK; i++) {  // Per point: out, in, bits, packed length, packed window
+        const zindex_point *point = (index->list + i);
+        uLongf packed_len = (uLongf)sizeof(packed);
+        ret = compress2(packed, &packed_len, point->window, ZWINDOW, Z_BEST_COMPRESSION);
+        if (ret != Z_OK) break;
+        zindex_put64(header, point->out);
+        zindex_put64((header + 0x08), point->in);
+        zindex_put64((header + 0x10), (((uint64_t)packed_len << 8) | (uint64_t)point->bits));
+        if (fwrite(header, 0x01, 0x18, dest) != 0x18 || fwrite(packed, 0x01, (size_t)packed_len, dest) != (size_t)packed_len) ret = Z_ERRNO;
+    }
+    if (fclose(dest) != 0x00 && ret == Z_OK) ret = Z_ERRNO;
+    return ret;
+}
+
+
+/** Load an index from a sidecar file written by `zlib_save_index()` */
+int zlib_load_index(char *index_filename, zindex **loaded) {
+    FILE *source = fopen(index_filename, "rb");
+    if (source == (FILE *)NULL) return Z_ERRNO;
+    int ret = Z_OK;
+    register size_t i;
+    uint8_t header[0x18];
+    Bytef packed[ZWINDOW + 0x40];
+    zindex *index = (zindex *)calloc(0x01, sizeof(zindex));
+    if (index == (zindex *)NULL) {
+        fclose(source);
+        return Z_MEM_ERROR;
+    }
+    if (fread(header, 0x01, 0x18, source) != 0x18 || memcmp(header, ZINDEX_MAGIC, 0x04) != 0x00 || header[4] != 0x01) ret = Z_DATA_ERROR;
+    else {
+        // Every point takes at least 0x18 bytes, so the bytes left in the file bound the point count before anything is allocated
+        const long start = ftell(source);
+        long end = -1L;
+        if (start >= 0x00L && fseek(source, 0x00L, SEEK_END) == 0x00) end = ftell(source);
+        const uint64_t count = zindex_get64(header + 0x08);
+        index->length = zindex_get64(header + 0x10);
+        if (end < start || fseek(source, start, SEEK_SET) != 0x00) ret = Z_ERRNO;
+        else if (count == 0x00 || count > ((uint64_t)(end - start) / 0x18)) ret = Z_DATA_ERROR;
+        else {
+            index->size = (size_t)count;
+            index->list = (zindex_point *)calloc(index->size, sizeof(zindex_point));
+            if (index->list == (zindex_point *)NULL) ret = Z_MEM_ERROR;
+        }
+    }
+    for (i = 0x00; i < index->size && ret == Z_OK; i++) {
+        zindex_point *point = (index->list + i);
+        if (fread(header, 0x01, 0x18, source) != 0x18) {
+            ret = Z_DATA_ERROR;
+            break;
+        }
+        point->out = zindex_get64(header);
+        point->in = zindex_get64(header + 0x08);
+        const uint64_t word = zindex_get64(header + 0x10);
+        const size_t packed_len = (size_t)(word >> 8);
+        point->bits = (int)(word & 0x07);
+        if (packed_len > sizeof(packed) || fread(packed, 0x01, packed_len, source) != packed_len) {
+            ret = Z_DATA_ERROR;
+            break;
+        }
+        uLongf window_len = ZWINDOW;
+        ret = uncompress(point->window, &window_len, packed, (uLong)packed_len);
+        if (ret == Z_OK && window_len != ZWINDOW) ret = Z_DATA_ERROR;
+        else if (ret == Z_BUF_ERROR) ret = Z_DATA_ERROR;
+        index->have++;
+    }
+    fclose(source);
+    if (ret != Z_OK) {
+        zlib_free_index(index);
+        return ret;
+    }
+    *loaded = index;
+    return Z_OK;
+}
+
+
+/** Build a random-access index of a compressed file and save it to a sidecar file */
+int zlib_index_file(char *source_filename, char *index_filename, const uint64_t span) {
+    FILE *source = fopen(source_filename, "rb");
+    if (source == (FILE *)NULL) return Z_ERRNO;
+    zindex *index = NULL;
+    int ret = zlib_build_index(source, span, &index);
+    fclose(source);
+    if (ret != Z_OK) return ret;
+    ret = zlib_save_index(index, index_filename);
+    zlib_free_index(index);
+    return ret;
+}
+
+
+/** Read `len` uncompressed bytes at `offset` into `buf`, resuming at the nearest checkpoint; Returns the number of bytes read or a negative zlib error */
+slint zlib_read_range(FILE *source, const zindex *index, uint64_t offset, unsigned char *buf, const size_t len) {
+    int ret, skip = 0x01;
+    unsigned char input[CHUNK];
+    unsigned char discard[ZWINDOW];
+    z_stream strm;
+    const uInt want = (uInt)((len > (size_t)UINT_MAX) ? UINT_MAX : len);
+    if (len == 0x00 || offset >= index->length) return 0x00;
+    if (index->have == 0x00) return Z_DATA_ERROR;
+    // Find the last checkpoint at or before the offset
+    const zindex_point *here = index->list;
+    register size_t remaining = index->have;
+    while (--remaining && here[1].out <= offset) here++;
+    // Allocate a raw inflate state and position it at the checkpoint
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    strm.avail_in = 0x00;
+    strm.next_in = Z_NULL;
+    ret = inflateInit2(&strm, -MAX_WBITS);
+    if (ret != Z_OK) return ret;
+#ifdef OSPOSIX
+    ret = fseeko(source, (off_t)(here->in - (here->bits ? 0x01 : 0x00)), SEEK_SET);
+#else
+    ret = fseek(source, (slint)(here->in - (here->bits ? 0x01 : 0x00)), SEEK_SET);
+#endif
+    if (ret == -1) {
+        (void)inflateEnd(&strm);
+        return Z_ERRNO;
+    }
+    if (here->bits) {
+        ret = getc(source);
+        if (ret == -1) {
+            ret = (ferror(source) ? Z_ERRNO : Z_DATA_ERROR);
+            (void)inflateEnd(&strm);
+            return ret;
+        }
+        (void)inflatePrime(&strm, here->bits, (ret >> (8 - here->bits)));
+    }
+    (void)inflateSetDictionary(&strm, here->window, ZWINDOW);
+    // Inflate and discard up to the offset, then inflate into the caller's buffer
+    offset -= here->out;
+    do {
+        if (offset == 0x00 && skip) {
+            strm.avail_out = want;
+            strm.next_out = buf;
+            skip = 0x00;
+        }
+        if (offset > ZWINDOW) {
+            strm.avail_out = ZWINDOW;
+            strm.next_out = discard;
+            offset -= ZWINDOW;
+        } else if (offset != 0x00) {
+            strm.avail_out = (uInt)offset;
+            strm.next_out = discard;
+            offset = 0x00;
+        }
+        do {  // Inflate until the output buffer is full
+            if (strm.avail_in == 0x00) {
+                strm.avail_in = (unsigned int)fread(input, 0x01, CHUNK, source);
+                if (ferror(source)) {
+                    (void)inflateEnd(&strm);
+                    return Z_ERRNO;
+                }
+                if (strm.avail_in == 0x00) {
+                    (void)inflateEnd(&strm);
+                    return Z_DATA_ERROR;
+                }
+                strm.next_in = input;
+            }
+            ret = inflate(&strm, Z_NO_FLUSH);
+            if (ret == Z_NEED_DICT) ret = Z_DATA_ERROR;
+            if (ret == Z_MEM_ERROR || ret == Z_DATA_ERROR) {
+                (void)inflateEnd(&strm);
+                return ret;
+            }
+            if (ret == Z_STREAM_END) break;
+        } while (strm.avail_out != 0x00);
+        if (ret == Z_STREAM_END) break;
+    } while (skip);
+    // Clean up and return the number of bytes read
+    (void)inflateEnd(&strm);
+    return (skip ? 0x00 : (slint)(want - strm.avail_out));
+}
+
+
+/* PARALLEL DECOMPRESSION */
+
+
+/** Private Function: Load a whole file for random access into `*src`; POSIX systems map it read-only instead of copying it; Return Z_OK, Z_ERRNO when the file cannot be opened or sized, Z_DATA_ERROR for an empty file, or Z_MEM_ERROR */
+static int zlib_map_source(const char *filename, const Bytef **src, size_t *len) {
+    *src = (const Bytef *)NULL;
+    *len = 0x00;
+#ifdef OSPOSIX
+    struct stat sb;
+    const int fd = open(filename, O_RDONLY);
+    if (fd < 0x00) return Z_ERRNO;
+    if (fstat(fd, &sb) != 0x00) {
+        close(fd);
+        return Z_ERRNO;
+    }
+    *len = (size_t)sb.st_size;
+    if (*len == 0x00) {
+        close(fd);
+        return Z_DATA_ERROR;
+    }
+    void *map = mmap(NULL, *len, PROT_READ, MAP_PRIVATE, fd, 0x00);
+    close(fd);
+    if (map == MAP_FAILED) return Z_MEM_ERROR;
+    (void)madvise(map, *len, MADV_WILLNEED);
+    *src = (const Bytef *)map;
+    return Z_OK;
+#else
+    FILE *source = fopen(filename, "rb");
+    if (source == (FILE *)NULL) return Z_ERRNO;
+    if (fseek(source, 0x00, SEEK_END) != 0x00) {
+        fclose(source);
+        return Z_ERRNO;
+    }
+    const long size = ftell(source);
+    rewind(source);
+    if (size <= 0x00L) {
+        fclose(source);
+        return ((size == 0x00L) ? Z_DATA_ERROR : Z_ERRNO);
+    }
+    *len = (size_t)size;
+    Bytef *buf = (Bytef *)malloc(*len);
+    int ret = ((buf == (Bytef *)NULL) ? Z_MEM_ERROR : Z_OK);
+    if (ret == Z_OK && fread(buf, 0x01, *len, source) != *len) {
+        free(buf);
+        ret = Z_ERRNO;
+    }
+    fclose(source);
+    if (ret == Z_OK) *src = buf;
+    return ret;
+#endif
+}
+
+
+/** Private Function: Release a file loaded by `zlib_map_source()` */
+static void zlib_unmap_source(const Bytef *src, const size_t len) {
+#ifdef OSPOSIX
+    (void)munmap((void *)(uintptr_t)src, len);
+#else
+    (void)len;
+    free((void *)(uintptr_t)src);
+#endif
+}
+
+
+/** Private Function: Inflate one gzip member, or one indexed span, into memory; Worker for the parallel decompressor */
+static void *zlib_inflate_job(void *arg) {
+    zinflate_job *job = (zinflate_job *)arg;
+    const Bytef *next = job->in;
+    size_t left = job->in_len;
+    z_stream strm;
+    int ret;
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    strm.avail_in = 0x00;
+    strm.next_in = Z_NULL;
+    job->out_len = 0x00;
+    job->consumed = 0x00;
+    ret = inflateInit2(&strm, ((job->point == (const zindex_point *)NULL) ? (MAX_WBITS + 16) : -MAX_WBITS));
+    if (ret != Z_OK) {
+        job->ret = ret;
+        return NULL;
+    }
+    if (job->point != (const zindex_point *)NULL) {  // Resume from the checkpoint (as zlib_read_range() does)
+        if (job->point->bits) ret = inflatePrime(&strm, job->point->bits, (int)(job->in[-1] >> (8 - job->point->bits)));
+        if (ret == Z_OK) ret = inflateSetDictionary(&strm, job->point->window, ZWINDOW);
+    }
+    while (ret == Z_OK) {
+        if (job->out_len == job->out_size) {
+            if (job->point != (const zindex_point *)NULL) {
+                if (job->last) ret = Z_DATA_ERROR;  // The stream holds more data than the index recorded
+                break;  // The span is complete
+            }
+            if (job->out_size >= ZINFLATE_JOB_MAX) {
+                ret = Z_BUF_ERROR;  // Too long to buffer; The caller streams this member instead
+                break;
+            }
+            const size_t grown_size = (((job->out_size * 2) < ZINFLATE_JOB_MAX) ? (job->out_size * 2) : ZINFLATE_JOB_MAX);
+            Bytef *grown = (Bytef *)realloc(job->out, grown_size);  // Members do not record their size up front
+            if (grown == (Bytef *)NULL) {
+                ret = Z_MEM_ERROR;
+                break;
+            }
+            job->out = grown;
+            job->out_size = grown_size;
+        }
+        if (strm.avail_in == 0x00) {
+            if (left == 0x00) {
+                ret = Z_DATA_ERROR;  // Truncated input
+                break;
+            }
+            strm.next_in = (Bytef *)(uintptr_t)next;
+            strm.avail_in = (uInt)((left > (size_t)UINT_MAX) ? UINT_MAX : left);
+            next += strm.avail_in;
+            left -= strm.avail_in;
+        }
+        const size_t room = (job->out_size - job->out_len);
+        strm.next_out = (job->out + job->out_len);
+        strm.avail_out = (uInt)((room > (size_t)UINT_MAX) ? UINT_MAX : room);
+        const uInt before = strm.avail_out;
+        ret = inflate(&strm, Z_NO_FLUSH);
+        job->out_len += (size_t)(before - strm.avail_out);
+        if (ret == Z_NEED_DICT || ret == Z_BUF_ERROR) ret = Z_DATA_ERROR;
+    }
+    if (ret == Z_STREAM_END) {
+        job->consumed = ((size_t)(next - job->in) - strm.avail_in);
+        // The final span is given one byte of slack, so extra data shows up instead of being cut off
+        ret = (((job->point == (const zindex_point *)NULL) || job->out_len == (job->out_size - (job->last ? 0x01 : 0x00))) ? Z_OK : Z_DATA_ERROR);
+    }
+    job->ret = ret;
+    (void)inflateEnd(&strm);
+    return NULL;
+}
+
+
+/** Private Function: Start a decompression job on its own thread, or run it on the calling thread if none can be spawned */
+static void zlib_start_inflate_job(zinflate_job *job) {
+    job->spawned = 0x00;
+#ifdef __PTHREAD_ENABLED__
+    job->spawned = (pthread_create(&job->thread, NULL, zlib_inflate_job, job) == 0x00);
+    if (job->spawned) return;
+#endif
+    (void)zlib_inflate_job(job);
+}
+
+
+/** Private Function: Wait for a job started by `zlib_start_inflate_job()` */
+static void zlib_finish_inflate_job(zinflate_job *job) {
+#ifdef __PTHREAD_ENABLED__
+    if (job->spawned) (void)pthread_join(job->thread, NULL);
+#endif
+    job->spawned = 0x00;
+}
+
+
+/** Private Function: Inflate consecutive zlib/gzip streams (or only the first one) from memory on the calling thread, streaming the output through a CHUNK-sized buffer; Trailing non-gzip data is ignored; `consumed` receives the compressed bytes used */
+static int zlib_inflate_members(const Bytef *src, const size_t len, FILE *dest, const int first_only, size_t *consumed) {
+    unsigned char out[CHUNK];
+    size_t left = len;
+    unsigned have;
+    z_stream strm;
+    *consumed = 0x00;
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    strm.avail_in = 0x00;
+    strm.next_in = Z_NULL;
+    int ret = inflateInit2(&strm, (MAX_WBITS + 32));
+    if (ret != Z_OK) return ret;
+    strm.next_in = (Bytef *)(uintptr_t)src;
+    do {
+        if (strm.avail_in == 0x00) {
+            if (left == 0x00) {
+                ret = Z_DATA_ERROR;  // Truncated input
+                break;
+            }
+            strm.avail_in = (uInt)((left > (size_t)UINT_MAX) ? UINT_MAX : left);
+            left -= strm.avail_in;
+        }
+        strm.avail_out = CHUNK;
+        strm.next_out = out;
+        ret = inflate(&strm, Z_NO_FLUSH);
+        if (ret == Z_NEED_DICT || ret == Z_BUF_ERROR) ret = Z_DATA_ERROR;
+        have = (CHUNK - strm.avail_out);
+        if (fwrite(out, sizeof(char), have, dest) != have || ferror(dest)) ret = Z_ERRNO;
+        if (ret == Z_STREAM_END) {  // Continue with the next member, if there is one
+            const size_t rest = (strm.avail_in + left);
+            *consumed = (len - rest);
+            if (first_only || rest < 0x02 || strm.next_in[0] != 0x1F || strm.next_in[1] != 0x8B) break;
+            ret = inflateReset(&strm);
+        }
+    } while (ret == Z_OK);
+    (void)inflateEnd(&strm);
+    return ((ret == Z_STREAM_END) ? Z_OK : ret);
+}
+
+
+/** Decompress a zlib/gzip file on `num_threads` threads (zero selects one per processor) and write the output in order;
+With an index (see `zlib_build_index()`), the spans between checkpoints are inflated concurrently, and any gzip members after the indexed stream follow;
+Without one, gzip members (as written by bgzip or by concatenating gzip files) are located by their headers and inflated concurrently;
+Up to `num_threads` jobs are kept in flight, and the oldest one is written as soon as it finishes, so a long member only holds back the output after it;
+A header match only counts once the member before it ends there, so jobs started at false matches inside a member are discarded;
+Each job buffers at most ZINFLATE_JOB_MAX bytes; Longer members are streamed on the calling thread; Return Z_ERRNO when a file cannot be opened */
+int zlib_decompress_file_parallel(char *source_filename, char *dest_filename, const zindex *index, const unsigned int num_threads) {
+#ifdef __PTHREAD_ENABLED__
+    const unsigned int nthreads = zlib_thread_count(num_threads);
+#else
+    const unsigned int nthreads = 0x01;  // Jobs would run one at a time anyway
+    (void)num_threads;
+#endif
+    unsigned int head = 0x00, count = 0x00;  // In-flight jobs are jobs[head], jobs[(head + 1) % nthreads], ..., oldest first
+    size_t len, pos = 0x00, next = 0x00, ncand = 0x00, cand_size = 0x00, c = 0x00, done;
+    size_t *cand = (size_t *)NULL;
+    zinflate_job *job;
+    int ret = Z_OK;
+    const Bytef *src;
+    ret = zlib_map_source(source_filename, &src, &len);
+    if (ret != Z_OK) return ret;
+    FILE *dest = fopen(dest_filename, "wb");
+    if (dest == (FILE *)NULL) {
+        zlib_unmap_source(src, len);
+        return Z_ERRNO;
+    }
+    zinflate_job *jobs = (zinflate_job *)calloc((size_t)nthreads, sizeof(zinflate_job));
+    if (jobs == (zinflate_job *)NULL) ret = Z_MEM_ERROR;
+    if (ret == Z_OK && index != (const zindex *)NULL) {  // Indexed spans
+        if (index->have == 0x00 || index->list[0].out != 0x00) ret = Z_DATA_ERROR;
+        while (ret == Z_OK && (next < index->have || count > 0x00)) {
+            while (ret == Z_OK && next < index->have && count < nthreads) {  // Keep every thread busy
+                const zindex_point *point = &index->list[next];
+                const uint64_t end = (((next + 1) < index->have) ? index->list[next + 1].out : index->length);
+                if (point->in > (uint64_t)len || point->in < (uint64_t)(point->bits ? 0x01 : 0x00) || end < point->out) {
+                    ret = Z_DATA_ERROR;
+                    break;
+                }
+                job = &jobs[(head + count) % nthreads];
+                job->point = point;
+                job->last = ((next + 1) == index->have);
+                job->in = (src + point->in);
+                job->in_len = (size_t)(len - point->in);
+                job->out_size = ((size_t)(end - point->out) + (size_t)job->last);
+                job->out = (Bytef *)malloc(job->out_size + 0x01);
+                if (job->out == (Bytef *)NULL) {
+                    ret = Z_MEM_ERROR;
+                    break;
+                }
+                zlib_start_inflate_job(job);
+                next++;
+                count++;
+            }
+            if (ret != Z_OK) break;
+            job = &jobs[head];  // Write the oldest span once it is done
+            zlib_finish_inflate_job(job);
+            if (job->ret != Z_OK) ret = job->ret;
+            else if (fwrite(job->out, 0x01, job->out_len, dest) != job->out_len) ret = Z_ERRNO;
+            else if (job->last) pos = ((size_t)job->point->in + job->consumed);
+            free(job->out);
+            job->out = (Bytef *)NULL;
+            head = ((head + 1) % nthreads);
+            count--;
+        }
+        // The index stops at the end of the first stream; Skip its trailer so any later members are decompressed too
+        if (ret == Z_OK) pos += ((len >= 0x02 && src[0] == 0x1F && src[1] == 0x8B) ? 0x08 : 0x04);
+        if (ret == Z_OK && pos > len) ret = Z_DATA_ERROR;  // Truncated trailer
+    }
+    if (ret == Z_OK && pos < len) {  // Gzip members
+        // Every member starts with ID1, ID2, CM=8, and a FLG byte whose reserved bits are clear; Matches inside compressed data are weeded out below
+        for (size_t off = pos; (off + 0x04) <= len; off++) {
+            const Bytef *hit = (const Bytef *)memchr((src + off), 0x1F, (len - off - 0x03));
+            if (hit == (const Bytef *)NULL) break;
+            off = (size_t)(hit - src);
+            if (hit[1] != 0x8B || hit[2] != 0x08 || (hit[3] & 0xE0)) continue;
+            if (ncand == cand_size) {
+                size_t *grown = (size_t *)realloc(cand, ((cand_size ? cand_size * 2 : 0x40) * sizeof(size_t)));
+                if (grown == (size_t *)NULL) {
+                    ret = Z_MEM_ERROR;
+                    break;
+                }
+                cand = grown;
+                cand_size = (cand_size ? cand_size * 2 : 0x40);
+            }
+            cand[ncand++] = off;
+        }
+        if (ret == Z_OK && index == (const zindex *)NULL && (nthreads == 0x01 || ncand < 0x02 || cand[0] != 0x00)) {
+            ret = zlib_inflate_members(src, len, dest, 0x00, &done);  // Nothing to split
+            pos = len;
+        }
+        while (ret == Z_OK && pos < len) {
+            while (ret == Z_OK && c < ncand && count < nthreads) {  // Start the next candidates speculatively
+                const size_t start = cand[c++];
+                if (start < pos) continue;  // Inside a member that has already been written
+                const size_t span = ((c < ncand) ? (cand[c] - start) : (len - start));
+                job = &jobs[(head + count) % nthreads];
+                job->point = (const zindex_point *)NULL;
+                job->last = 0x00;
+                job->in = (src + start);
+                job->in_len = (len - start);
+                job->out_size = ((span < (CHUNK / 4)) ? CHUNK : ((span < (ZINFLATE_JOB_MAX / 4)) ? (span * 4) : ZINFLATE_JOB_MAX));  // Grown by the worker up to ZINFLATE_JOB_MAX
+                job->out = (Bytef *)malloc(job->out_size);
+                if (job->out == (Bytef *)NULL) {
+                    ret = Z_MEM_ERROR;
+                    break;
+                }
+                zlib_start_inflate_job(job);
+                count++;
+            }
+            if (ret != Z_OK || count == 0x00) break;  // With nothing left to start, the data at `pos` is not a gzip member and is ignored
+            job = &jobs[head];
+            zlib_finish_inflate_job(job);
+            const size_t start = (size_t)(job->in - src);
+            if (start > pos) break;  // No member starts where the last one ended; Trailing non-gzip data is ignored
+            if (start == pos) {  // Keep only the members that follow on from each other; Jobs started at false headers inside a member are discarded
+                if (job->ret == Z_BUF_ERROR) {  // Outgrew its buffer; Stream it instead
+                    ret = zlib_inflate_members((src + pos), (len - pos), dest, 0x01, &done);
+                    pos += done;
+                } else if (job->ret != Z_OK) {
+                    ret = job->ret;
+                } else if (fwrite(job->out, 0x01, job->out_len, dest) != job->out_len) {
+                    ret = Z_ERRNO;
+                } else {
+                    pos += job->consumed;
+                }
+            }
+            free(job->out);
+            job->out = (Bytef *)NULL;
+            head = ((head + 1) % nthreads);
+            count--;
+        }
+    }
+    for (; count > 0x00; count--) {  // Wait for the jobs left in flight after an error or trailing data
+        zlib_finish_inflate_job(&jobs[head]);
+        free(jobs[head].out);
+        head = ((head + 1) % nthreads);
+    }
+    // Clean up and return
+    free(cand);
+    free(jobs);
+    zlib_unmap_source(src, len);
+    if (fclose(dest) != 0x00 && ret == Z_OK) ret = Z_ERRNO;
+    return ret;
+}
+
+
 /** Zlib error reporting */
 void zlib_err(const int ret) {
     fputs("zlib: ", stderr);
@@ -34,11 +34,16 @@ License along with this library.
 #define FILE_COMPRESSION_SEEN
 
 
+#include <stddef.h>  // Must precede MACROS.h, which redefines ptrdiff_t before <zlib.h> can typedef it
 #include "MACROS.h"
 
 #ifdef OSPOSIX
+#   include <fcntl.h>
+#   include <sys/mman.h>
 #   include <sys/stat.h>
 #endif
+#include <math.h>
+#include <time.h>
 #ifdef __has_include
 #   if __has_include(<zlib.h>)
 #      include <zlib.h>
@@ -48,12 +53,45 @@ License along with this library.
 #else
 #   include <zlib.h>
 #endif
+#ifdef __PTHREAD_ENABLED__
+#   include <pthread.h>
+#endif
 #if (defined(MSDOS) || defined(OS2) || defined(OSWINDOWS) || defined(__CYGWIN__))
 #  define SET_BINARY_MODE(file)   setmode(fileno((file)), O_BINARY)
 #else
 #  define SET_BINARY_MODE(file)
 #endif
 #define CHUNK   (262144)  // 2^18
+#define ZBLOCK   (1048576)  // 2^20; Input block size used by the parallel compressor
+#define ZWINDOW   (32768)  // 2^15; Size of the deflate history window
+#define ZMAP_WINDOW   (8388608)  // 2^23; Bytes of the source file mapped at once by the mmap functions
+#define ZINFLATE_JOB_MAX   (16777216)  // 2^24; Output one in-flight parallel decompression job may buffer; Longer gzip members are streamed on the calling thread
+#define ZRING_SLOTS   (4)  // Number of CHUNK-sized buffers in each ring of the pipelined stream functions
+#define ZRING_CLOSED   (-1)  // Returned by the ring functions once the producer is done and every slot is drained
+#define ZRING_STOPPED   (-2)  // Returned by the ring functions after a pipeline stage failed
+#define ZDICT_KMER   (8)  // Length of the substrings counted by the dictionary trainer
+#define ZDICT_SEGMENT   (64)  // Length of the pieces the trainer copies into a dictionary
+#define ZDICT_HASH_LOG   (20)  // log2 of the number of substring counters used by the trainer
+#define ZLEVEL_AUTO   (-2)  // Pick the level of each block from its content (see `zlib_auto_level()`); Taken by the zlib stream, file, buffer, and codec compressors; `zlib_ctx_create()` and `zlib_pool_create()` return NULL for it and `zlib_compress_dict()` rejects it with Z_STREAM_ERROR
+#define ZLEVEL_FAST   (1)  // Level picked for data that is only mildly compressible or must be compressed quickly
+#define ZLEVEL_STRONG   (6)  // Level picked for data that rewards extra effort
+#define ZAUTO_SAMPLE   (8192)  // Bytes sampled from each block by `zlib_auto_level()`
+#define ZAUTO_SLICES   (4)  // Number of evenly spaced slices that make up the sample
+#define ZAUTO_STORE_ENTROPY   (7.85)  // Blocks at or above this entropy (bits per byte) are stored
+#define ZAUTO_STORE_RATIO   (1.05)  // Blocks whose fast trial ratio is below this are stored
+#define ZAUTO_STRONG_GAIN   (1.03)  // The strong level must improve on the fast trial ratio by this factor
+#define LZ_HASH_LOG   (14)  // log2 of the number of entries in the LZ match table
+#define LZ_MIN_MATCH   (4)  // Shortest LZ match
+#define LZ_LAST_LITERALS   (5)  // The last bytes of an LZ block are always literals
+#define LZ_MF_LIMIT   (12)  // No LZ match may start in the last LZ_MF_LIMIT bytes of a block
+#define LZ_MAX_DISTANCE   (65535)  // LZ window size
+#define LZ_MAGIC   "PBLZ"  // Magic number of LZ streams
+#define LZ_STORED   (0x80000000U)  // Block-header flag for LZ blocks that are stored uncompressed
+#define LZ_COMPRESS_BOUND(n)   ((n) + ((n) / 255) + 16)  // Largest LZ block for `n` input bytes
+#define CODEC_ZLIB   (0)  // Codec flag for zlib (deflate)
+#define CODEC_LZ   (1)  // Codec flag for the built-in LZ4-style codec
+#define ZINDEX_SPAN   (1048576)  // 2^20; Default distance (in uncompressed bytes) between random-access checkpoints
+#define ZINDEX_MAGIC   "ZIDX"  // Magic number of index sidecar files
 //#define Z_NO_COMPRESSION   0
 //#define Z_BEST_SPEED   1
 //#define Z_BEST_COMPRESSION   (
@@ -61,20 +99,227 @@ License along with this library.
 //#define zlib_version    zlibVersion()
 
 
+/* DATATYPES */
+
+
+/** One input block of the parallel compressor and its raw-deflate output */
+typedef struct zblock_job {
+    const Bytef *in;  // Block data
+    const Bytef *dict;  // History window preceding the block (may be NULL)
+    Bytef *out;  // Raw deflate output (ends on a byte boundary)
+    uLong check;  // Adler-32 of the block
+    uInt in_len;
+    uInt dict_len;
+    uInt out_len;
+    uInt out_size;
+    int level;
+    int last;  // Non-zero for the final block of the stream
+    int ret;
+    int reserved;  // Rounds the struct up to pointer alignment
+} zblock_job;
+
+
+#ifdef __PTHREAD_ENABLED__
+/** Bounded ring of CHUNK-sized buffers handed from one pipeline stage to the next */
+typedef struct zring {
+    unsigned char *mem;  // ZRING_SLOTS * CHUNK bytes
+    size_t len[ZRING_SLOTS];  // Bytes held by each filled slot
+    unsigned int head;  // Next slot to fill
+    unsigned int tail;  // Next slot to drain
+    unsigned int count;  // Filled slots
+    int done;  // The producer will not fill any more slots
+    int stop;  // A stage failed (or the consumer finished early); Wake everyone up
+    int reserved;  // Keeps `lock` 8-byte aligned
+    pthread_mutex_t lock;
+    pthread_cond_t filled;
+    pthread_cond_t drained;
+} zring;
+
+
+/** Reader -> (de)compressor -> writer pipeline state */
+typedef struct zpipeline {
+    FILE *source;
+    FILE *dest;
+    zring in;  // Reader -> (de)compressor
+    zring out;  // (De)compressor -> writer
+    int read_error;  // Z_ERRNO if the reader failed
+    int write_error;  // Z_ERRNO if the writer failed
+} zpipeline;
+#endif
+
+
+/** Reusable deflate/inflate state for compressing many small buffers; Use one context per thread at a time */
+typedef struct zlib_ctx {
+    z_stream deflater;
+    z_stream inflater;
+    const uint8_t *dict;  // Preset dictionary (owned by the caller) or NULL
+    uInt dict_len;
+    int level;
+    int has_deflater;  // `deflater` was initialized
+    int has_inflater;  // `inflater` was initialized (lazily, by the first decompression)
+} zlib_ctx;
+
+
+/** Dictionary segment picked by the trainer */
+typedef struct zdict_segment {
+    size_t pos;  // Offset of the segment in the samples
+    uint64_t score;  // Sum of the counts of the substrings that it covers
+} zdict_segment;
+
+
+/** Thread-safe stack of idle contexts that share one compression level */
+typedef struct zlib_pool {
+    zlib_ctx **idle;
+    unsigned int count;  // Idle contexts on the stack
+    unsigned int size;  // Capacity of the stack
+    int level;
+    int reserved;  // Keeps `lock` (and the struct size) 8-byte aligned
+#ifdef __PTHREAD_ENABLED__
+    pthread_mutex_t lock;
+#endif
+} zlib_pool;
+
+
+/** Random-access checkpoint inside a zlib/gzip stream (see zlib's zran.c) */
+typedef struct zindex_point {
+    uint64_t out;  // Offset in the uncompressed data
+    uint64_t in;  // Offset in the compressed file of the first full byte
+    int bits;  // Number of bits (1-7) taken from the byte at `in - 1`, or zero
+    int reserved;  // Keeps `window` 8-byte aligned so the struct needs no tail padding
+    unsigned char window[ZWINDOW];  // Uncompressed data preceding the checkpoint
+} zindex_point;
+
+
+/** Random-access index of a zlib/gzip file */
+typedef struct zindex {
+    size_t have;  // Number of checkpoints in `list`
+    size_t size;  // Number of checkpoints allocated
+    uint64_t length;  // Total length of the uncompressed data
+    zindex_point *list;
+} zindex;
+
+
+/** One unit of work for the parallel decompressor: a whole gzip member, or the span after an index checkpoint */
+typedef struct zinflate_job {
+    const Bytef *in;  // Compressed data at the member header or checkpoint
+    size_t in_len;  // Bytes from `in` to the end of the source
+    const zindex_point *point;  // Checkpoint to resume from, or NULL for a gzip member
+    Bytef *out;  // Decompressed data
+    size_t out_len;
+    size_t out_size;  // Capacity of `out` (the exact span length for checkpoints)
+    size_t consumed;  // Compressed bytes used by the member (including its trailer) or by the final span (up to the end of the deflate data)
+    int last;  // Final indexed span: inflate on to the end of the deflate data, so `consumed` locates whatever follows it
+    int ret;  // Z_BUF_ERROR when a member outgrows ZINFLATE_JOB_MAX
+    int spawned;  // Set while the job runs on `thread` and still has to be joined
+    int reserved;  // Keeps `thread` 8-byte aligned
+#ifdef __PTHREAD_ENABLED__
+    pthread_t thread;
+#endif
+} zinflate_job;
+
+
 /* FUNCTIONS */
 #ifdef __GNUC__
-static ulint getfilesize(const char *filename) __attribute__((flatten));
 int zlib_compress_stream(FILE *source, FILE *dest, const int level) __attribute__((flatten));
-int zlib_compress_file(char *source_filename, char *dest_filename, const int level) __attribute__((flatten));
+int zlib_compress_file(char *source_filename, char *dest_filename, const int level, const unsigned int num_threads) __attribute__((flatten));
 int zlib_decompress_stream(FILE *source, FILE *dest) __attribute__((flatten));
 int zlib_decompress_file(char *source_filename, char *dest_filename) __attribute__((flatten));
+int zlib_compress_stream_pipelined(FILE *source, FILE *dest, const int level) __attribute__((flatten));
+int zlib_decompress_stream_pipelined(FILE *source, FILE *dest) __attribute__((flatten));
+int zlib_auto_level(const uint8_t *block, const size_t len, const double budget_mbps) __attribute__((flatten, nonnull));
+int zlib_compress_stream_auto(FILE *source, FILE *dest, const double budget_mbps) __attribute__((flatten));
+int zlib_compress_buffer(const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len, const int level) __attribute__((flatten, nonnull));
+int zlib_decompress_buffer(const uint8_t *source, const size_t source_len, uint8_t **dest, size_t *dest_len) __attribute__((flatten, nonnull));
+zlib_ctx *zlib_ctx_create(const int level) __attribute__((flatten));
+int zlib_ctx_reset(zlib_ctx *ctx) __attribute__((flatten, nonnull));
+size_t zlib_ctx_bound(zlib_ctx *ctx, const size_t source_len) __attribute__((flatten, nonnull));
+int zlib_ctx_compress(zlib_ctx *ctx, const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len) __attribute__((flatten, nonnull));
+int zlib_ctx_decompress(zlib_ctx *ctx, const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len) __attribute__((flatten, nonnull));
+int zlib_ctx_set_dictionary(zlib_ctx *ctx, const uint8_t *dict, const size_t dict_len) __attribute__((nonnull(1)));
+void zlib_ctx_destroy(zlib_ctx *ctx);
+zlib_pool *zlib_pool_create(const unsigned int size, const int level) __attribute__((flatten));
+zlib_ctx *zlib_pool_acquire(zlib_pool *pool) __attribute__((flatten, nonnull));
+void zlib_pool_release(zlib_pool *pool, zlib_ctx *ctx) __attribute__((flatten, nonnull));
+void zlib_pool_destroy(zlib_pool *pool);
+int zlib_train_dictionary(const uint8_t *samples, const size_t samples_len, uint8_t *dict, size_t *dict_len) __attribute__((flatten, nonnull));
+int zlib_save_dictionary(const uint8_t *dict, const size_t dict_len, char *dict_filename) __attribute__((flatten, nonnull));
+int zlib_load_dictionary(char *dict_filename, uint8_t *dict, size_t *dict_len) __attribute__((flatten, nonnull));
+int zlib_compress_dict(const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len, const int level, const uint8_t *dict, const size_t dict_len) __attribute__((flatten, nonnull));
+int zlib_decompress_dict(const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len, const uint8_t *dict, const size_t dict_len) __attribute__((flatten, nonnull));
+size_t lz_compress_bound(const size_t source_len) __attribute__((const));
+int lz_compress_block(const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len) __attribute__((flatten, nonnull));
+int lz_decompress_block(const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len) __attribute__((flatten, nonnull));
+int lz_compress_stream(FILE *source, FILE *dest) __attribute__((flatten));
+int lz_decompress_stream(FILE *source, FILE *dest) __attribute__((flatten));
+int lz_compress_file(char *source_filename, char *dest_filename) __attribute__((flatten));
+int lz_decompress_file(char *source_filename, char *dest_filename) __attribute__((flatten));
+size_t codec_compress_bound(const int codec, const size_t source_len) __attribute__((const));
+int codec_compress_block(const int codec, const int level, const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len) __attribute__((flatten, nonnull));
+int codec_decompress_block(const int codec, const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len) __attribute__((flatten, nonnull));
+int codec_compress_stream(FILE *source, FILE *dest, const int codec, const int level) __attribute__((flatten));
+int codec_decompress_stream(FILE *source, FILE *dest, const int codec) __attribute__((flatten));
+int codec_compress_file(char *source_filename, char *dest_filename, const int codec, const int level) __attribute__((flatten));
+int codec_decompress_file(char *source_filename, char *dest_filename, const int codec) __attribute__((flatten));
+int zlib_compress_file_mmap(char *source_filename, char *dest_filename, const int level) __attribute__((flatten));
+int zlib_decompress_file_mmap(char *source_filename, char *dest_filename) __attribute__((flatten));
+int zlib_build_index(FILE *source, const uint64_t span, zindex **built) __attribute__((flatten, nonnull));
+void zlib_free_index(zindex *index);
+int zlib_save_index(const zindex *index, char *index_filename) __attribute__((flatten, nonnull));
+int zlib_load_index(char *index_filename, zindex **loaded) __attribute__((flatten, nonnull));
+int zlib_index_file(char *source_filename, char *index_filename, const uint64_t span) __attribute__((flatten, nonnull));
+slint zlib_read_range(FILE *source, const zindex *index, uint64_t offset, unsigned char *buf, const size_t len) __attribute__((flatten, nonnull));
+int zlib_decompress_file_parallel(char *source_filename, char *dest_filename, const zindex *index, const unsigned int num_threads) __attribute__((flatten));
 void zlib_err(const int ret) __attribute__((flatten));
 #else
-static ulint getfilesize(const char *filename);
 int zlib_compress_stream(FILE *source, FILE *dest, const int level);
-int zlib_compress_file(char *source_filename, char *dest_filename, const int level);
+int zlib_compress_file(char *source_filename, char *dest_filename, const int level, const unsigned int num_threads);
 int zlib_decompress_stream(FILE *source, FILE *dest);
 int zlib_decompress_file(char *source_filename, char *dest_filename);
+int zlib_compress_stream_pipelined(FILE *source, FILE *dest, const int level);
+int zlib_decompress_stream_pipelined(FILE *source, FILE *dest);
+int zlib_auto_level(const uint8_t *block, const size_t len, const double budget_mbps);
+int zlib_compress_stream_auto(FILE *source, FILE *dest, const double budget_mbps);
+int zlib_compress_buffer(const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len, const int level);
+int zlib_decompress_buffer(const uint8_t *source, const size_t source_len, uint8_t **dest, size_t *dest_len);
+zlib_ctx *zlib_ctx_create(const int level);
+int zlib_ctx_reset(zlib_ctx *ctx);
+size_t zlib_ctx_bound(zlib_ctx *ctx, const size_t source_len);
+int zlib_ctx_compress(zlib_ctx *ctx, const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len);
+int zlib_ctx_decompress(zlib_ctx *ctx, const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len);
+int zlib_ctx_set_dictionary(zlib_ctx *ctx, const uint8_t *dict, const size_t dict_len);
+void zlib_ctx_destroy(zlib_ctx *ctx);
+zlib_pool *zlib_pool_create(const unsigned int size, const int level);
+zlib_ctx *zlib_pool_acquire(zlib_pool *pool);
+void zlib_pool_release(zlib_pool *pool, zlib_ctx *ctx);
+void zlib_pool_destroy(zlib_pool *pool);
+int zlib_train_dictionary(const uint8_t *samples, const size_t samples_len, uint8_t *dict, size_t *dict_len);
+int zlib_save_dictionary(const uint8_t *dict, const size_t dict_len, char *dict_filename);
+int zlib_load_dictionary(char *dict_filename, uint8_t *dict, size_t *dict_len);
+int zlib_compress_dict(const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len, const int level, const uint8_t *dict, const size_t dict_len);
+int zlib_decompress_dict(const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len, const uint8_t *dict, const size_t dict_len);
+size_t lz_compress_bound(const size_t source_len);
+int lz_compress_block(const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len);
+int lz_decompress_block(const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len);
+int lz_compress_stream(FILE *source, FILE *dest);
+int lz_decompress_stream(FILE *source, FILE *dest);
+int lz_compress_file(char *source_filename, char *dest_filename);
+int lz_decompress_file(char *source_filename, char *dest_filename);
+size_t codec_compress_bound(const int codec, const size_t source_len);
+int codec_compress_block(const int codec, const int level, const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len);
+int codec_decompress_block(const int codec, const uint8_t *source, const size_t source_len, uint8_t *dest, size_t *dest_len);
+int codec_compress_stream(FILE *source, FILE *dest, const int codec, const int level);
+int codec_decompress_stream(FILE *source, FILE *dest, const int codec);
+int codec_compress_file(char *source_filename, char *dest_filename, const int codec, const int level);
+int codec_decompress_file(char *source_filename, char *dest_filename, const int codec);
+int zlib_compress_file_mmap(char *source_filename, char *dest_filename, const int level);
+int zlib_decompress_file_mmap(char *source_filename, char *dest_filename);
+int zlib_build_index(FILE *source, const uint64_t span, zindex **built);
+void zlib_free_index(zindex *index);
+int zlib_save_index(const zindex *index, char *index_filename);
+int zlib_load_index(char *index_filename, zindex **loaded);
+int zlib_index_file(char *source_filename, char *index_filename, const uint64_t span);
+slint zlib_read_range(FILE *source, const zindex *index, uint64_t offset, unsigned char *buf, const size_t len);
+int zlib_decompress_file_parallel(char *source_filename, char *dest_filename, const zindex *index, const unsigned int num_threads);
 void zlib_err(const int ret);
 #endif
 
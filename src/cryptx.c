@@ -39,9 +39,75 @@ License along with this library.
 #ifdef __GNUC__
 static size_t strlenx(const char *__restrict__ str) __attribute__((const, flatten));
 static size_t strlenx_uint8(const uint8_t *__restrict__ str) __attribute__((const, flatten));
+static uint32_t crc32_multmodp(const uint32_t a, uint32_t b) __attribute__((const));
+static uint32_t crc32c_shift(const uint32_t table[4][256], const uint32_t crc) __attribute__((pure));
+static uint32_t crc32c_multmodp(const uint32_t a, uint32_t b) __attribute__((const));
+static uint64_t splitmix64(uint64_t *__restrict__ x) __attribute__((nonnull));
+static void prng_apply_jump(prng_state *__restrict__ state, const uint64_t jump[4]) __attribute__((nonnull));
+static char *random_charset(const size_t length, const size_t size, const char *__restrict__ charset, const uint32_t setsize) __attribute__((nonnull, malloc));
+static void fisher_yates_uint32(uint32_t *__restrict__ array, const size_t num_items, prng_state *__restrict__ state) __attribute__((nonnull));
+static void merge_shuffle_merge(uint32_t *__restrict__ array, const size_t mid, const size_t num_items, prng_state *__restrict__ state) __attribute__((nonnull));
+static void *shuffle_worker(void *arg) __attribute__((nonnull));
+static void keystream_xor(uint8_t *dest, const uint8_t *src, const uint8_t *__restrict__ stream, const size_t len);
+#   ifdef CRYPTX_X86_DISPATCH
+static void tea_blocks_sse2(uint32_t *__restrict__ v, const size_t nblocks, const uint32_t *__restrict__ k, const int decrypt) __attribute__((nonnull(3)));
+static void tea_blocks_avx2(uint32_t *__restrict__ v, const size_t nblocks, const uint32_t *__restrict__ k, const int decrypt) __attribute__((nonnull(3)));
+static void xtea_blocks_sse2(const uint32_t num_rounds, uint32_t *__restrict__ v, const size_t nblocks, const uint32_t key[4], const int decrypt) __attribute__((nonnull(4)));
+static void xtea_blocks_avx2(const uint32_t num_rounds, uint32_t *__restrict__ v, const size_t nblocks, const uint32_t key[4], const int decrypt) __attribute__((nonnull(4)));
+static void xxtea_blocks_avx2(uint32_t *__restrict__ v, const size_t nblocks, const int32_t num_items, const uint32_t key[4]) __attribute__((nonnull(4)));
+#   endif
+static size_t xor_pattern_words(uint8_t *__restrict__ data, const size_t len, const uint8_t *__restrict__ pattern, const size_t keylen, size_t *__restrict__ phase) __attribute__((hot, nonnull(3, 5)));
+#   ifdef CRYPTX_X86_DISPATCH
+static size_t xor_pattern_avx2(uint8_t *__restrict__ data, const size_t len, const uint8_t *__restrict__ pattern, const size_t keylen, size_t *__restrict__ phase) __attribute__((hot, nonnull(3, 5)));
+static size_t xor_pattern_avx512(uint8_t *__restrict__ data, const size_t len, const uint8_t *__restrict__ pattern, const size_t keylen, size_t *__restrict__ phase) __attribute__((hot, nonnull(3, 5)));
+#   endif
+static void xor_pattern_buf(uint8_t *__restrict__ data, const size_t len, const uint8_t *__restrict__ key, const size_t keylen, const uint8_t invert) __attribute__((nonnull(3)));
+static void tea_blocks(uint32_t *__restrict__ v, size_t nblocks, const uint32_t *__restrict__ k, const int decrypt) __attribute__((nonnull(3)));
+static void xtea_blocks(const uint32_t num_rounds, uint32_t *__restrict__ v, size_t nblocks, const uint32_t key[4], const int decrypt) __attribute__((nonnull(4)));
+static uint32_t anubis_load(const uint8_t *__restrict__ bytes) __attribute__((nonnull, pure));
+static void anubis_store(uint8_t *__restrict__ bytes, const uint32_t word) __attribute__((nonnull));
+static void anubis_crypt_blocks(const uint32_t key[ANUBIS_MAX_ROUNDS + 1][4], const int rounds, uint32_t state[][4], const size_t nblocks) __attribute__((hot, noinline, nonnull));  // Inlined into `anubis_ctr()`, GCC stops interleaving the blocks
+static void adler_sums_scalar(const uint8_t *__restrict__ data, const size_t len, uint32_t *__restrict__ sum, uint32_t *__restrict__ weighted) __attribute__((nonnull(3, 4)));
+#   ifdef CRYPTX_X86_DISPATCH
+static void adler_sums_ssse3(const uint8_t *__restrict__ data, const size_t len, uint32_t *__restrict__ sum, uint32_t *__restrict__ weighted) __attribute__((nonnull(3, 4)));
+static void adler_sums_avx2(const uint8_t *__restrict__ data, const size_t len, uint32_t *__restrict__ sum, uint32_t *__restrict__ weighted) __attribute__((nonnull(3, 4)));
+static void fletcher_sums_avx2(const void *__restrict__ data, const size_t count, const size_t width, uint64_t *__restrict__ sum, uint64_t *__restrict__ weighted) __attribute__((nonnull(4, 5)));
+#   endif
+static void fletcher_sums_scalar(const void *__restrict__ data, const size_t count, const size_t width, uint64_t *__restrict__ sum, uint64_t *__restrict__ weighted) __attribute__((nonnull(4, 5)));
+static void fletcher_sums(const void *__restrict__ data, const size_t count, const size_t width, uint64_t *__restrict__ sum, uint64_t *__restrict__ weighted) __attribute__((nonnull(4, 5)));
+static void fletcher_accumulate(uint64_t *__restrict__ sum1, uint64_t *__restrict__ sum2, const void *__restrict__ data, size_t count, const size_t width, const uint64_t modulus) __attribute__((nonnull(1, 2)));
+static uint64_t fletcher_reduce(const void *__restrict__ data, size_t count, const size_t width, const uint64_t modulus) __attribute__((pure));
+static uint8_t crc8_feed(register uint8_t crc, const uint8_t *__restrict__ data, size_t len) __attribute__((pure));
+static uint16_t crc16_feed(register uint16_t crc, const uint8_t *__restrict__ data, size_t len) __attribute__((pure));
+static uint64_t checksum_params(const unsigned int algorithm, size_t *__restrict__ width, unsigned int *__restrict__ shift, uint64_t *__restrict__ start) __attribute__((nonnull));
 #else
 static size_t strlenx(const char *__restrict__ str);
 static size_t strlenx_uint8(const uint8_t *__restrict__ str);
+static uint32_t crc32_multmodp(const uint32_t a, uint32_t b);
+static uint32_t crc32c_shift(const uint32_t table[4][256], const uint32_t crc);
+static uint32_t crc32c_multmodp(const uint32_t a, uint32_t b);
+static uint64_t splitmix64(uint64_t *__restrict__ x);
+static void prng_apply_jump(prng_state *__restrict__ state, const uint64_t jump[4]);
+static char *random_charset(const size_t length, const size_t size, const char *__restrict__ charset, const uint32_t setsize);
+static void fisher_yates_uint32(uint32_t *__restrict__ array, const size_t num_items, prng_state *__restrict__ state);
+static void merge_shuffle_merge(uint32_t *__restrict__ array, const size_t mid, const size_t num_items, prng_state *__restrict__ state);
+static void *shuffle_worker(void *arg);
+static void keystream_xor(uint8_t *dest, const uint8_t *src, const uint8_t *__restrict__ stream, const size_t len);
+static size_t xor_pattern_words(uint8_t *__restrict__ data, const size_t len, const uint8_t *__restrict__ pattern, const size_t keylen, size_t *__restrict__ phase);
+static void xor_pattern_buf(uint8_t *__restrict__ data, const size_t len, const uint8_t *__restrict__ key, const size_t keylen, const uint8_t invert);
+static void tea_blocks(uint32_t *__restrict__ v, size_t nblocks, const uint32_t *__restrict__ k, const int decrypt);
+static void xtea_blocks(const uint32_t num_rounds, uint32_t *__restrict__ v, size_t nblocks, const uint32_t key[4], const int decrypt);
+static uint32_t anubis_load(const uint8_t *__restrict__ bytes);
+static void anubis_store(uint8_t *__restrict__ bytes, const uint32_t word);
+static void anubis_crypt_blocks(const uint32_t key[ANUBIS_MAX_ROUNDS + 1][4], const int rounds, uint32_t state[][4], const size_t nblocks);
+static void adler_sums_scalar(const uint8_t *__restrict__ data, const size_t len, uint32_t *__restrict__ sum, uint32_t *__restrict__ weighted);
+static void fletcher_sums_scalar(const void *__restrict__ data, const size_t count, const size_t width, uint64_t *__restrict__ sum, uint64_t *__restrict__ weighted);
+static void fletcher_sums(const void *__restrict__ data, const size_t count, const size_t width, uint64_t *__restrict__ sum, uint64_t *__restrict__ weighted);
+static void fletcher_accumulate(uint64_t *__restrict__ sum1, uint64_t *__restrict__ sum2, const void *__restrict__ data, size_t count, const size_t width, const uint64_t modulus);
+static uint64_t fletcher_reduce(const void *__restrict__ data, size_t count, const size_t width, const uint64_t modulus);
+static uint8_t crc8_feed(register uint8_t crc, const uint8_t *__restrict__ data, size_t len);
+static uint16_t crc16_feed(register uint16_t crc, const uint8_t *__restrict__ data, size_t len);
+static uint64_t checksum_params(const unsigned int algorithm, size_t *__restrict__ width, unsigned int *__restrict__ shift, uint64_t *__restrict__ start);
 #endif
 /** Private Function: Returns the length of a string */
 static size_t strlenx(const char *__restrict__ str) {
@@ -168,6 +234,2179 @@ const uint32_t crc32_table[256] = {
 };
 
 
+/** Slicing-by-16 tables for CRC32: Row `k` holds the CRC32 of each byte followed by `k` zero bytes (row 0 is `crc32_table`); Generated from the polynomial 0x04C11DB7 */
+const uint32_t crc32_slice_table[16][256] = {
+    {
+        0x00000000U,0x04C11DB7U,0x09823B6EU,0x0D4326D9U,
+        0x130476DCU,0x17C56B6BU,0x1A864DB2U,0x1E475005U,
+        0x2608EDB8U,0x22C9F00FU,0x2F8AD6D6U,0x2B4BCB61U,
+        0x350C9B64U,0x31CD86D3U,0x3C8EA00AU,0x384FBDBDU,
+        0x4C11DB70U,0x48D0C6C7U,0x4593E01EU,0x4152FDA9U,
+        0x5F15ADACU,0x5BD4B01BU,0x569796C2U,0x52568B75U,
+        0x6A1936C8U,0x6ED82B7FU,0x639B0DA6U,0x675A1011U,
+        0x791D4014U,0x7DDC5DA3U,0x709F7B7AU,0x745E66CDU,
+        0x9823B6E0U,0x9CE2AB57U,0x91A18D8EU,0x95609039U,
+        0x8B27C03CU,0x8FE6DD8BU,0x82A5FB52U,0x8664E6E5U,
+        0xBE2B5B58U,0xBAEA46EFU,0xB7A96036U,0xB3687D81U,
+        0xAD2F2D84U,0xA9EE3033U,0xA4AD16EAU,0xA06C0B5DU,
+        0xD4326D90U,0xD0F37027U,0xDDB056FEU,0xD9714B49U,
+        0xC7361B4CU,0xC3F706FBU,0xCEB42022U,0xCA753D95U,
+        0xF23A8028U,0xF6FB9D9FU,0xFBB8BB46U,0xFF79A6F1U,
+        0xE13EF6F4U,0xE5FFEB43U,0xE8BCCD9AU,0xEC7DD02DU,
+        0x34867077U,0x30476DC0U,0x3D044B19U,0x39C556AEU,
+        0x278206ABU,0x23431B1CU,0x2E003DC5U,0x2AC12072U,
+        0x128E9DCFU,0x164F8078U,0x1B0CA6A1U,0x1FCDBB16U,
+        0x018AEB13U,0x054BF6A4U,0x0808D07DU,0x0CC9CDCAU,
+        0x7897AB07U,0x7C56B6B0U,0x71159069U,0x75D48DDEU,
+        0x6B93DDDBU,0x6F52C06CU,0x6211E6B5U,0x66D0FB02U,
+        0x5E9F46BFU,0x5A5E5B08U,0x571D7DD1U,0x53DC6066U,
+        0x4D9B3063U,0x495A2DD4U,0x44190B0DU,0x40D816BAU,
+        0xACA5C697U,0xA864DB20U,0xA527FDF9U,0xA1E6E04EU,
+        0xBFA1B04BU,0xBB60ADFCU,0xB6238B25U,0xB2E29692U,
+        0x8AAD2B2FU,0x8E6C3698U,0x832F1041U,0x87EE0DF6U,
+        0x99A95DF3U,0x9D684044U,0x902B669DU,0x94EA7B2AU,
+        0xE0B41DE7U,0xE4750050U,0xE9362689U,0xEDF73B3EU,
+        0xF3B06B3BU,0xF771768CU,0xFA325055U,0xFEF34DE2U,
+        0xC6BCF05FU,0xC27DEDE8U,0xCF3ECB31U,0xCBFFD686U,
+        0xD5B88683U,0xD1799B34U,0xDC3ABDEDU,0xD8FBA05AU,
+        0x690CE0EEU,0x6DCDFD59U,0x608EDB80U,0x644FC637U,
+        0x7A089632U,0x7EC98B85U,0x738AAD5CU,0x774BB0EBU,
+        0x4F040D56U,0x4BC510E1U,0x46863638U,0x42472B8FU,
+        0x5C007B8AU,0x58C1663DU,0x558240E4U,0x51435D53U,
+        0x251D3B9EU,0x21DC2629U,0x2C9F00F0U,0x285E1D47U,
+        0x36194D42U,0x32D850F5U,0x3F9B762CU,0x3B5A6B9BU,
+        0x0315D626U,0x07D4CB91U,0x0A97ED48U,0x0E56F0FFU,
+        0x1011A0FAU,0x14D0BD4DU,0x19939B94U,0x1D528623U,
+        0xF12F560EU,0xF5EE4BB9U,0xF8AD6D60U,0xFC6C70D7U,
+        0xE22B20D2U,0xE6EA3D65U,0xEBA91BBCU,0xEF68060BU,
+        0xD727BBB6U,0xD3E6A601U,0xDEA580D8U,0xDA649D6FU,
+        0xC423CD6AU,0xC0E2D0DDU,0xCDA1F604U,0xC960EBB3U,
+        0xBD3E8D7EU,0xB9FF90C9U,0xB4BCB610U,0xB07DABA7U,
+        0xAE3AFBA2U,0xAAFBE615U,0xA7B8C0CCU,0xA379DD7BU,
+        0x9B3660C6U,0x9FF77D71U,0x92B45BA8U,0x9675461FU,
+        0x8832161AU,0x8CF30BADU,0x81B02D74U,0x857130C3U,
+        0x5D8A9099U,0x594B8D2EU,0x5408ABF7U,0x50C9B640U,
+        0x4E8EE645U,0x4A4FFBF2U,0x470CDD2BU,0x43CDC09CU,
+        0x7B827D21U,0x7F436096U,0x7200464FU,0x76C15BF8U,
+        0x68860BFDU,0x6C47164AU,0x61043093U,0x65C52D24U,
+        0x119B4BE9U,0x155A565EU,0x18197087U,0x1CD86D30U,
+        0x029F3D35U,0x065E2082U,0x0B1D065BU,0x0FDC1BECU,
+        0x3793A651U,0x3352BBE6U,0x3E119D3FU,0x3AD08088U,
+        0x2497D08DU,0x2056CD3AU,0x2D15EBE3U,0x29D4F654U,
+        0xC5A92679U,0xC1683BCEU,0xCC2B1D17U,0xC8EA00A0U,
+        0xD6AD50A5U,0xD26C4D12U,0xDF2F6BCBU,0xDBEE767CU,
+        0xE3A1CBC1U,0xE760D676U,0xEA23F0AFU,0xEEE2ED18U,
+        0xF0A5BD1DU,0xF464A0AAU,0xF9278673U,0xFDE69BC4U,
+        0x89B8FD09U,0x8D79E0BEU,0x803AC667U,0x84FBDBD0U,
+        0x9ABC8BD5U,0x9E7D9662U,0x933EB0BBU,0x97FFAD0CU,
+        0xAFB010B1U,0xAB710D06U,0xA6322BDFU,0xA2F33668U,
+        0xBCB4666DU,0xB8757BDAU,0xB5365D03U,0xB1F740B4U
+    },
+    {
+        0x00000000U,0xD219C1DCU,0xA0F29E0FU,0x72EB5FD3U,
+        0x452421A9U,0x973DE075U,0xE5D6BFA6U,0x37CF7E7AU,
+        0x8A484352U,0x5851828EU,0x2ABADD5DU,0xF8A31C81U,
+        0xCF6C62FBU,0x1D75A327U,0x6F9EFCF4U,0xBD873D28U,
+        0x10519B13U,0xC2485ACFU,0xB0A3051CU,0x62BAC4C0U,
+        0x5575BABAU,0x876C7B66U,0xF58724B5U,0x279EE569U,
+        0x9A19D841U,0x4800199DU,0x3AEB464EU,0xE8F28792U,
+        0xDF3DF9E8U,0x0D243834U,0x7FCF67E7U,0xADD6A63BU,
+        0x20A33626U,0xF2BAF7FAU,0x8051A829U,0x524869F5U,
+        0x6587178FU,0xB79ED653U,0xC5758980U,0x176C485CU,
+        0xAAEB7574U,0x78F2B4A8U,0x0A19EB7BU,0xD8002AA7U,
+        0xEFCF54DDU,0x3DD69501U,0x4F3DCAD2U,0x9D240B0EU,
+        0x30F2AD35U,0xE2EB6CE9U,0x9000333AU,0x4219F2E6U,
+        0x75D68C9CU,0xA7CF4D40U,0xD5241293U,0x073DD34FU,
+        0xBABAEE67U,0x68A32FBBU,0x1A487068U,0xC851B1B4U,
+        0xFF9ECFCEU,0x2D870E12U,0x5F6C51C1U,0x8D75901DU,
+        0x41466C4CU,0x935FAD90U,0xE1B4F243U,0x33AD339FU,
+        0x04624DE5U,0xD67B8C39U,0xA490D3EAU,0x76891236U,
+        0xCB0E2F1EU,0x1917EEC2U,0x6BFCB111U,0xB9E570CDU,
+        0x8E2A0EB7U,0x5C33CF6BU,0x2ED890B8U,0xFCC15164U,
+        0x5117F75FU,0x830E3683U,0xF1E56950U,0x23FCA88CU,
+        0x1433D6F6U,0xC62A172AU,0xB4C148F9U,0x66D88925U,
+        0xDB5FB40DU,0x094675D1U,0x7BAD2A02U,0xA9B4EBDEU,
+        0x9E7B95A4U,0x4C625478U,0x3E890BABU,0xEC90CA77U,
+        0x61E55A6AU,0xB3FC9BB6U,0xC117C465U,0x130E05B9U,
+        0x24C17BC3U,0xF6D8BA1FU,0x8433E5CCU,0x562A2410U,
+        0xEBAD1938U,0x39B4D8E4U,0x4B5F8737U,0x994646EBU,
+        0xAE893891U,0x7C90F94DU,0x0E7BA69EU,0xDC626742U,
+        0x71B4C179U,0xA3AD00A5U,0xD1465F76U,0x035F9EAAU,
+        0x3490E0D0U,0xE689210CU,0x94627EDFU,0x467BBF03U,
+        0xFBFC822BU,0x29E543F7U,0x5B0E1C24U,0x8917DDF8U,
+        0xBED8A382U,0x6CC1625EU,0x1E2A3D8DU,0xCC33FC51U,
+        0x828CD898U,0x50951944U,0x227E4697U,0xF067874BU,
+        0xC7A8F931U,0x15B138EDU,0x675A673EU,0xB543A6E2U,
+        0x08C49BCAU,0xDADD5A16U,0xA83605C5U,0x7A2FC419U,
+        0x4DE0BA63U,0x9FF97BBFU,0xED12246CU,0x3F0BE5B0U,
+        0x92DD438BU,0x40C48257U,0x322FDD84U,0xE0361C58U,
+        0xD7F96222U,0x05E0A3FEU,0x770BFC2DU,0xA5123DF1U,
+        0x189500D9U,0xCA8CC105U,0xB8679ED6U,0x6A7E5F0AU,
+        0x5DB12170U,0x8FA8E0ACU,0xFD43BF7FU,0x2F5A7EA3U,
+        0xA22FEEBEU,0x70362F62U,0x02DD70B1U,0xD0C4B16DU,
+        0xE70BCF17U,0x35120ECBU,0x47F95118U,0x95E090C4U,
+        0x2867ADECU,0xFA7E6C30U,0x889533E3U,0x5A8CF23FU,
+        0x6D438C45U,0xBF5A4D99U,0xCDB1124AU,0x1FA8D396U,
+        0xB27E75ADU,0x6067B471U,0x128CEBA2U,0xC0952A7EU,
+        0xF75A5404U,0x254395D8U,0x57A8CA0BU,0x85B10BD7U,
+        0x383636FFU,0xEA2FF723U,0x98C4A8F0U,0x4ADD692CU,
+        0x7D121756U,0xAF0BD68AU,0xDDE08959U,0x0FF94885U,
+        0xC3CAB4D4U,0x11D37508U,0x63382ADBU,0xB121EB07U,
+        0x86EE957DU,0x54F754A1U,0x261C0B72U,0xF405CAAEU,
+        0x4982F786U,0x9B9B365AU,0xE9706989U,0x3B69A855U,
+        0x0CA6D62FU,0xDEBF17F3U,0xAC544820U,0x7E4D89FCU,
+        0xD39B2FC7U,0x0182EE1BU,0x7369B1C8U,0xA1707014U,
+        0x96BF0E6EU,0x44A6CFB2U,0x364D9061U,0xE45451BDU,
+        0x59D36C95U,0x8BCAAD49U,0xF921F29AU,0x2B383346U,
+        0x1CF74D3CU,0xCEEE8CE0U,0xBC05D333U,0x6E1C12EFU,
+        0xE36982F2U,0x3170432EU,0x439B1CFDU,0x9182DD21U,
+        0xA64DA35BU,0x74546287U,0x06BF3D54U,0xD4A6FC88U,
+        0x6921C1A0U,0xBB38007CU,0xC9D35FAFU,0x1BCA9E73U,
+        0x2C05E009U,0xFE1C21D5U,0x8CF77E06U,0x5EEEBFDAU,
+        0xF33819E1U,0x2121D83DU,0x53CA87EEU,0x81D34632U,
+        0xB61C3848U,0x6405F994U,0x16EEA647U,0xC4F7679BU,
+        0x79705AB3U,0xAB699B6FU,0xD982C4BCU,0x0B9B0560U,
+        0x3C547B1AU,0xEE4DBAC6U,0x9CA6E515U,0x4EBF24C9U
+    },
+    {
+        0x00000000U,0x01D8AC87U,0x03B1590EU,0x0269F589U,
+        0x0762B21CU,0x06BA1E9BU,0x04D3EB12U,0x050B4795U,
+        0x0EC56438U,0x0F1DC8BFU,0x0D743D36U,0x0CAC91B1U,
+        0x09A7D624U,0x087F7AA3U,0x0A168F2AU,0x0BCE23ADU,
+        0x1D8AC870U,0x1C5264F7U,0x1E3B917EU,0x1FE33DF9U,
+        0x1AE87A6CU,0x1B30D6EBU,0x19592362U,0x18818FE5U,
+        0x134FAC48U,0x129700CFU,0x10FEF546U,0x112659C1U,
+        0x142D1E54U,0x15F5B2D3U,0x179C475AU,0x1644EBDDU,
+        0x3B1590E0U,0x3ACD3C67U,0x38A4C9EEU,0x397C6569U,
+        0x3C7722FCU,0x3DAF8E7BU,0x3FC67BF2U,0x3E1ED775U,
+        0x35D0F4D8U,0x3408585FU,0x3661ADD6U,0x37B90151U,
+        0x32B246C4U,0x336AEA43U,0x31031FCAU,0x30DBB34DU,
+        0x269F5890U,0x2747F417U,0x252E019EU,0x24F6AD19U,
+        0x21FDEA8CU,0x2025460BU,0x224CB382U,0x23941F05U,
+        0x285A3CA8U,0x2982902FU,0x2BEB65A6U,0x2A33C921U,
+        0x2F388EB4U,0x2EE02233U,0x2C89D7BAU,0x2D517B3DU,
+        0x762B21C0U,0x77F38D47U,0x759A78CEU,0x7442D449U,
+        0x714993DCU,0x70913F5BU,0x72F8CAD2U,0x73206655U,
+        0x78EE45F8U,0x7936E97FU,0x7B5F1CF6U,0x7A87B071U,
+        0x7F8CF7E4U,0x7E545B63U,0x7C3DAEEAU,0x7DE5026DU,
+        0x6BA1E9B0U,0x6A794537U,0x6810B0BEU,0x69C81C39U,
+        0x6CC35BACU,0x6D1BF72BU,0x6F7202A2U,0x6EAAAE25U,
+        0x65648D88U,0x64BC210FU,0x66D5D486U,0x670D7801U,
+        0x62063F94U,0x63DE9313U,0x61B7669AU,0x606FCA1DU,
+        0x4D3EB120U,0x4CE61DA7U,0x4E8FE82EU,0x4F5744A9U,
+        0x4A5C033CU,0x4B84AFBBU,0x49ED5A32U,0x4835F6B5U,
+        0x43FBD518U,0x4223799FU,0x404A8C16U,0x41922091U,
+        0x44996704U,0x4541CB83U,0x47283E0AU,0x46F0928DU,
+        0x50B47950U,0x516CD5D7U,0x5305205EU,0x52DD8CD9U,
+        0x57D6CB4CU,0x560E67CBU,0x54679242U,0x55BF3EC5U,
+        0x5E711D68U,0x5FA9B1EFU,0x5DC04466U,0x5C18E8E1U,
+        0x5913AF74U,0x58CB03F3U,0x5AA2F67AU,0x5B7A5AFDU,
+        0xEC564380U,0xED8EEF07U,0xEFE71A8EU,0xEE3FB609U,
+        0xEB34F19CU,0xEAEC5D1BU,0xE885A892U,0xE95D0415U,
+        0xE29327B8U,0xE34B8B3FU,0xE1227EB6U,0xE0FAD231U,
+        0xE5F195A4U,0xE4293923U,0xE640CCAAU,0xE798602DU,
+        0xF1DC8BF0U,0xF0042777U,0xF26DD2FEU,0xF3B57E79U,
+        0xF6BE39ECU,0xF766956BU,0xF50F60E2U,0xF4D7CC65U,
+        0xFF19EFC8U,0xFEC1434FU,0xFCA8B6C6U,0xFD701A41U,
+        0xF87B5DD4U,0xF9A3F153U,0xFBCA04DAU,0xFA12A85DU,
+        0xD743D360U,0xD69B7FE7U,0xD4F28A6EU,0xD52A26E9U,
+        0xD021617CU,0xD1F9CDFBU,0xD3903872U,0xD24894F5U,
+        0xD986B758U,0xD85E1BDFU,0xDA37EE56U,0xDBEF42D1U,
+        0xDEE40544U,0xDF3CA9C3U,0xDD555C4AU,0xDC8DF0CDU,
+        0xCAC91B10U,0xCB11B797U,0xC978421EU,0xC8A0EE99U,
+        0xCDABA90CU,0xCC73058BU,0xCE1AF002U,0xCFC25C85U,
+        0xC40C7F28U,0xC5D4D3AFU,0xC7BD2626U,0xC6658AA1U,
+        0xC36ECD34U,0xC2B661B3U,0xC0DF943AU,0xC10738BDU,
+        0x9A7D6240U,0x9BA5CEC7U,0x99CC3B4EU,0x981497C9U,
+        0x9D1FD05CU,0x9CC77CDBU,0x9EAE8952U,0x9F7625D5U,
+        0x94B80678U,0x9560AAFFU,0x97095F76U,0x96D1F3F1U,
+        0x93DAB464U,0x920218E3U,0x906BED6AU,0x91B341EDU,
+        0x87F7AA30U,0x862F06B7U,0x8446F33EU,0x859E5FB9U,
+        0x8095182CU,0x814DB4ABU,0x83244122U,0x82FCEDA5U,
+        0x8932CE08U,0x88EA628FU,0x8A839706U,0x8B5B3B81U,
+        0x8E507C14U,0x8F88D093U,0x8DE1251AU,0x8C39899DU,
+        0xA168F2A0U,0xA0B05E27U,0xA2D9ABAEU,0xA3010729U,
+        0xA60A40BCU,0xA7D2EC3BU,0xA5BB19B2U,0xA463B535U,
+        0xAFAD9698U,0xAE753A1FU,0xAC1CCF96U,0xADC46311U,
+        0xA8CF2484U,0xA9178803U,0xAB7E7D8AU,0xAAA6D10DU,
+        0xBCE23AD0U,0xBD3A9657U,0xBF5363DEU,0xBE8BCF59U,
+        0xBB8088CCU,0xBA58244BU,0xB831D1C2U,0xB9E97D45U,
+        0xB2275EE8U,0xB3FFF26FU,0xB19607E6U,0xB04EAB61U,
+        0xB545ECF4U,0xB49D4073U,0xB6F4B5FAU,0xB72C197DU
+    },
+    {
+        0x00000000U,0xDC6D9AB7U,0xBC1A28D9U,0x6077B26EU,
+        0x7CF54C05U,0xA098D6B2U,0xC0EF64DCU,0x1C82FE6BU,
+        0xF9EA980AU,0x258702BDU,0x45F0B0D3U,0x999D2A64U,
+        0x851FD40FU,0x59724EB8U,0x3905FCD6U,0xE5686661U,
+        0xF7142DA3U,0x2B79B714U,0x4B0E057AU,0x97639FCDU,
+        0x8BE161A6U,0x578CFB11U,0x37FB497FU,0xEB96D3C8U,
+        0x0EFEB5A9U,0xD2932F1EU,0xB2E49D70U,0x6E8907C7U,
+        0x720BF9ACU,0xAE66631BU,0xCE11D175U,0x127C4BC2U,
+        0xEAE946F1U,0x3684DC46U,0x56F36E28U,0x8A9EF49FU,
+        0x961C0AF4U,0x4A719043U,0x2A06222DU,0xF66BB89AU,
+        0x1303DEFBU,0xCF6E444CU,0xAF19F622U,0x73746C95U,
+        0x6FF692FEU,0xB39B0849U,0xD3ECBA27U,0x0F812090U,
+        0x1DFD6B52U,0xC190F1E5U,0xA1E7438BU,0x7D8AD93CU,
+        0x61082757U,0xBD65BDE0U,0xDD120F8EU,0x017F9539U,
+        0xE417F358U,0x387A69EFU,0x580DDB81U,0x84604136U,
+        0x98E2BF5DU,0x448F25EAU,0x24F89784U,0xF8950D33U,
+        0xD1139055U,0x0D7E0AE2U,0x6D09B88CU,0xB164223BU,
+        0xADE6DC50U,0x718B46E7U,0x11FCF489U,0xCD916E3EU,
+        0x28F9085FU,0xF49492E8U,0x94E32086U,0x488EBA31U,
+        0x540C445AU,0x8861DEEDU,0xE8166C83U,0x347BF634U,
+        0x2607BDF6U,0xFA6A2741U,0x9A1D952FU,0x46700F98U,
+        0x5AF2F1F3U,0x869F6B44U,0xE6E8D92AU,0x3A85439DU,
+        0xDFED25FCU,0x0380BF4BU,0x63F70D25U,0xBF9A9792U,
+        0xA31869F9U,0x7F75F34EU,0x1F024120U,0xC36FDB97U,
+        0x3BFAD6A4U,0xE7974C13U,0x87E0FE7DU,0x5B8D64CAU,
+        0x470F9AA1U,0x9B620016U,0xFB15B278U,0x277828CFU,
+        0xC2104EAEU,0x1E7DD419U,0x7E0A6677U,0xA267FCC0U,
+        0xBEE502ABU,0x6288981CU,0x02FF2A72U,0xDE92B0C5U,
+        0xCCEEFB07U,0x108361B0U,0x70F4D3DEU,0xAC994969U,
+        0xB01BB702U,0x6C762DB5U,0x0C019FDBU,0xD06C056CU,
+        0x3504630DU,0xE969F9BAU,0x891E4BD4U,0x5573D163U,
+        0x49F12F08U,0x959CB5BFU,0xF5EB07D1U,0x29869D66U,
+        0xA6E63D1DU,0x7A8BA7AAU,0x1AFC15C4U,0xC6918F73U,
+        0xDA137118U,0x067EEBAFU,0x660959C1U,0xBA64C376U,
+        0x5F0CA517U,0x83613FA0U,0xE3168DCEU,0x3F7B1779U,
+        0x23F9E912U,0xFF9473A5U,0x9FE3C1CBU,0x438E5B7CU,
+        0x51F210BEU,0x8D9F8A09U,0xEDE83867U,0x3185A2D0U,
+        0x2D075CBBU,0xF16AC60CU,0x911D7462U,0x4D70EED5U,
+        0xA81888B4U,0x74751203U,0x1402A06DU,0xC86F3ADAU,
+        0xD4EDC4B1U,0x08805E06U,0x68F7EC68U,0xB49A76DFU,
+        0x4C0F7BECU,0x9062E15BU,0xF0155335U,0x2C78C982U,
+        0x30FA37E9U,0xEC97AD5EU,0x8CE01F30U,0x508D8587U,
+        0xB5E5E3E6U,0x69887951U,0x09FFCB3FU,0xD5925188U,
+        0xC910AFE3U,0x157D3554U,0x750A873AU,0xA9671D8DU,
+        0xBB1B564FU,0x6776CCF8U,0x07017E96U,0xDB6CE421U,
+        0xC7EE1A4AU,0x1B8380FDU,0x7BF43293U,0xA799A824U,
+        0x42F1CE45U,0x9E9C54F2U,0xFEEBE69CU,0x22867C2BU,
+        0x3E048240U,0xE26918F7U,0x821EAA99U,0x5E73302EU,
+        0x77F5AD48U,0xAB9837FFU,0xCBEF8591U,0x17821F26U,
+        0x0B00E14DU,0xD76D7BFAU,0xB71AC994U,0x6B775323U,
+        0x8E1F3542U,0x5272AFF5U,0x32051D9BU,0xEE68872CU,
+        0xF2EA7947U,0x2E87E3F0U,0x4EF0519EU,0x929DCB29U,
+        0x80E180EBU,0x5C8C1A5CU,0x3CFBA832U,0xE0963285U,
+        0xFC14CCEEU,0x20795659U,0x400EE437U,0x9C637E80U,
+        0x790B18E1U,0xA5668256U,0xC5113038U,0x197CAA8FU,
+        0x05FE54E4U,0xD993CE53U,0xB9E47C3DU,0x6589E68AU,
+        0x9D1CEBB9U,0x4171710EU,0x2106C360U,0xFD6B59D7U,
+        0xE1E9A7BCU,0x3D843D0BU,0x5DF38F65U,0x819E15D2U,
+        0x64F673B3U,0xB89BE904U,0xD8EC5B6AU,0x0481C1DDU,
+        0x18033FB6U,0xC46EA501U,0xA419176FU,0x78748DD8U,
+        0x6A08C61AU,0xB6655CADU,0xD612EEC3U,0x0A7F7474U,
+        0x16FD8A1FU,0xCA9010A8U,0xAAE7A2C6U,0x768A3871U,
+        0x93E25E10U,0x4F8FC4A7U,0x2FF876C9U,0xF395EC7EU,
+        0xEF171215U,0x337A88A2U,0x530D3ACCU,0x8F60A07BU
+    },
+    {
+        0x00000000U,0x490D678DU,0x921ACF1AU,0xDB17A897U,
+        0x20F48383U,0x69F9E40EU,0xB2EE4C99U,0xFBE32B14U,
+        0x41E90706U,0x08E4608BU,0xD3F3C81CU,0x9AFEAF91U,
+        0x611D8485U,0x2810E308U,0xF3074B9FU,0xBA0A2C12U,
+        0x83D20E0CU,0xCADF6981U,0x11C8C116U,0x58C5A69BU,
+        0xA3268D8FU,0xEA2BEA02U,0x313C4295U,0x78312518U,
+        0xC23B090AU,0x8B366E87U,0x5021C610U,0x192CA19DU,
+        0xE2CF8A89U,0xABC2ED04U,0x70D54593U,0x39D8221EU,
+        0x036501AFU,0x4A686622U,0x917FCEB5U,0xD872A938U,
+        0x2391822CU,0x6A9CE5A1U,0xB18B4D36U,0xF8862ABBU,
+        0x428C06A9U,0x0B816124U,0xD096C9B3U,0x999BAE3EU,
+        0x6278852AU,0x2B75E2A7U,0xF0624A30U,0xB96F2DBDU,
+        0x80B70FA3U,0xC9BA682EU,0x12ADC0B9U,0x5BA0A734U,
+        0xA0438C20U,0xE94EEBADU,0x3259433AU,0x7B5424B7U,
+        0xC15E08A5U,0x88536F28U,0x5344C7BFU,0x1A49A032U,
+        0xE1AA8B26U,0xA8A7ECABU,0x73B0443CU,0x3ABD23B1U,
+        0x06CA035EU,0x4FC764D3U,0x94D0CC44U,0xDDDDABC9U,
+        0x263E80DDU,0x6F33E750U,0xB4244FC7U,0xFD29284AU,
+        0x47230458U,0x0E2E63D5U,0xD539CB42U,0x9C34ACCFU,
+        0x67D787DBU,0x2EDAE056U,0xF5CD48C1U,0xBCC02F4CU,
+        0x85180D52U,0xCC156ADFU,0x1702C248U,0x5E0FA5C5U,
+        0xA5EC8ED1U,0xECE1E95CU,0x37F641CBU,0x7EFB2646U,
+        0xC4F10A54U,0x8DFC6DD9U,0x56EBC54EU,0x1FE6A2C3U,
+        0xE40589D7U,0xAD08EE5AU,0x761F46CDU,0x3F122140U,
+        0x05AF02F1U,0x4CA2657CU,0x97B5CDEBU,0xDEB8AA66U,
+        0x255B8172U,0x6C56E6FFU,0xB7414E68U,0xFE4C29E5U,
+        0x444605F7U,0x0D4B627AU,0xD65CCAEDU,0x9F51AD60U,
+        0x64B28674U,0x2DBFE1F9U,0xF6A8496EU,0xBFA52EE3U,
+        0x867D0CFDU,0xCF706B70U,0x1467C3E7U,0x5D6AA46AU,
+        0xA6898F7EU,0xEF84E8F3U,0x34934064U,0x7D9E27E9U,
+        0xC7940BFBU,0x8E996C76U,0x558EC4E1U,0x1C83A36CU,
+        0xE7608878U,0xAE6DEFF5U,0x757A4762U,0x3C7720EFU,
+        0x0D9406BCU,0x44996131U,0x9F8EC9A6U,0xD683AE2BU,
+        0x2D60853FU,0x646DE2B2U,0xBF7A4A25U,0xF6772DA8U,
+        0x4C7D01BAU,0x05706637U,0xDE67CEA0U,0x976AA92DU,
+        0x6C898239U,0x2584E5B4U,0xFE934D23U,0xB79E2AAEU,
+        0x8E4608B0U,0xC74B6F3DU,0x1C5CC7AAU,0x5551A027U,
+        0xAEB28B33U,0xE7BFECBEU,0x3CA84429U,0x75A523A4U,
+        0xCFAF0FB6U,0x86A2683BU,0x5DB5C0ACU,0x14B8A721U,
+        0xEF5B8C35U,0xA656EBB8U,0x7D41432FU,0x344C24A2U,
+        0x0EF10713U,0x47FC609EU,0x9CEBC809U,0xD5E6AF84U,
+        0x2E058490U,0x6708E31DU,0xBC1F4B8AU,0xF5122C07U,
+        0x4F180015U,0x06156798U,0xDD02CF0FU,0x940FA882U,
+        0x6FEC8396U,0x26E1E41BU,0xFDF64C8CU,0xB4FB2B01U,
+        0x8D23091FU,0xC42E6E92U,0x1F39C605U,0x5634A188U,
+        0xADD78A9CU,0xE4DAED11U,0x3FCD4586U,0x76C0220BU,
+        0xCCCA0E19U,0x85C76994U,0x5ED0C103U,0x17DDA68EU,
+        0xEC3E8D9AU,0xA533EA17U,0x7E244280U,0x3729250DU,
+        0x0B5E05E2U,0x4253626FU,0x9944CAF8U,0xD049AD75U,
+        0x2BAA8661U,0x62A7E1ECU,0xB9B0497BU,0xF0BD2EF6U,
+        0x4AB702E4U,0x03BA6569U,0xD8ADCDFEU,0x91A0AA73U,
+        0x6A438167U,0x234EE6EAU,0xF8594E7DU,0xB15429F0U,
+        0x888C0BEEU,0xC1816C63U,0x1A96C4F4U,0x539BA379U,
+        0xA878886DU,0xE175EFE0U,0x3A624777U,0x736F20FAU,
+        0xC9650CE8U,0x80686B65U,0x5B7FC3F2U,0x1272A47FU,
+        0xE9918F6BU,0xA09CE8E6U,0x7B8B4071U,0x328627FCU,
+        0x083B044DU,0x413663C0U,0x9A21CB57U,0xD32CACDAU,
+        0x28CF87CEU,0x61C2E043U,0xBAD548D4U,0xF3D82F59U,
+        0x49D2034BU,0x00DF64C6U,0xDBC8CC51U,0x92C5ABDCU,
+        0x692680C8U,0x202BE745U,0xFB3C4FD2U,0xB231285FU,
+        0x8BE90A41U,0xC2E46DCCU,0x19F3C55BU,0x50FEA2D6U,
+        0xAB1D89C2U,0xE210EE4FU,0x390746D8U,0x700A2155U,
+        0xCA000D47U,0x830D6ACAU,0x581AC25DU,0x1117A5D0U,
+        0xEAF48EC4U,0xA3F9E949U,0x78EE41DEU,0x31E32653U
+    },
+    {
+        0x00000000U,0x1B280D78U,0x36501AF0U,0x2D781788U,
+        0x6CA035E0U,0x77883898U,0x5AF02F10U,0x41D82268U,
+        0xD9406BC0U,0xC26866B8U,0xEF107130U,0xF4387C48U,
+        0xB5E05E20U,0xAEC85358U,0x83B044D0U,0x989849A8U,
+        0xB641CA37U,0xAD69C74FU,0x8011D0C7U,0x9B39DDBFU,
+        0xDAE1FFD7U,0xC1C9F2AFU,0xECB1E527U,0xF799E85FU,
+        0x6F01A1F7U,0x7429AC8FU,0x5951BB07U,0x4279B67FU,
+        0x03A19417U,0x1889996FU,0x35F18EE7U,0x2ED9839FU,
+        0x684289D9U,0x736A84A1U,0x5E129329U,0x453A9E51U,
+        0x04E2BC39U,0x1FCAB141U,0x32B2A6C9U,0x299AABB1U,
+        0xB102E219U,0xAA2AEF61U,0x8752F8E9U,0x9C7AF591U,
+        0xDDA2D7F9U,0xC68ADA81U,0xEBF2CD09U,0xF0DAC071U,
+        0xDE0343EEU,0xC52B4E96U,0xE853591EU,0xF37B5466U,
+        0xB2A3760EU,0xA98B7B76U,0x84F36CFEU,0x9FDB6186U,
+        0x0743282EU,0x1C6B2556U,0x311332DEU,0x2A3B3FA6U,
+        0x6BE31DCEU,0x70CB10B6U,0x5DB3073EU,0x469B0A46U,
+        0xD08513B2U,0xCBAD1ECAU,0xE6D50942U,0xFDFD043AU,
+        0xBC252652U,0xA70D2B2AU,0x8A753CA2U,0x915D31DAU,
+        0x09C57872U,0x12ED750AU,0x3F956282U,0x24BD6FFAU,
+        0x65654D92U,0x7E4D40EAU,0x53355762U,0x481D5A1AU,
+        0x66C4D985U,0x7DECD4FDU,0x5094C375U,0x4BBCCE0DU,
+        0x0A64EC65U,0x114CE11DU,0x3C34F695U,0x271CFBEDU,
+        0xBF84B245U,0xA4ACBF3DU,0x89D4A8B5U,0x92FCA5CDU,
+        0xD32487A5U,0xC80C8ADDU,0xE5749D55U,0xFE5C902DU,
+        0xB8C79A6BU,0xA3EF9713U,0x8E97809BU,0x95BF8DE3U,
+        0xD467AF8BU,0xCF4FA2F3U,0xE237B57BU,0xF91FB803U,
+        0x6187F1ABU,0x7AAFFCD3U,0x57D7EB5BU,0x4CFFE623U,
+        0x0D27C44BU,0x160FC933U,0x3B77DEBBU,0x205FD3C3U,
+        0x0E86505CU,0x15AE5D24U,0x38D64AACU,0x23FE47D4U,
+        0x622665BCU,0x790E68C4U,0x54767F4CU,0x4F5E7234U,
+        0xD7C63B9CU,0xCCEE36E4U,0xE196216CU,0xFABE2C14U,
+        0xBB660E7CU,0xA04E0304U,0x8D36148CU,0x961E19F4U,
+        0xA5CB3AD3U,0xBEE337ABU,0x939B2023U,0x88B32D5BU,
+        0xC96B0F33U,0xD243024BU,0xFF3B15C3U,0xE41318BBU,
+        0x7C8B5113U,0x67A35C6BU,0x4ADB4BE3U,0x51F3469BU,
+        0x102B64F3U,0x0B03698BU,0x267B7E03U,0x3D53737BU,
+        0x138AF0E4U,0x08A2FD9CU,0x25DAEA14U,0x3EF2E76CU,
+        0x7F2AC504U,0x6402C87CU,0x497ADFF4U,0x5252D28CU,
+        0xCACA9B24U,0xD1E2965CU,0xFC9A81D4U,0xE7B28CACU,
+        0xA66AAEC4U,0xBD42A3BCU,0x903AB434U,0x8B12B94CU,
+        0xCD89B30AU,0xD6A1BE72U,0xFBD9A9FAU,0xE0F1A482U,
+        0xA12986EAU,0xBA018B92U,0x97799C1AU,0x8C519162U,
+        0x14C9D8CAU,0x0FE1D5B2U,0x2299C23AU,0x39B1CF42U,
+        0x7869ED2AU,0x6341E052U,0x4E39F7DAU,0x5511FAA2U,
+        0x7BC8793DU,0x60E07445U,0x4D9863CDU,0x56B06EB5U,
+        0x17684CDDU,0x0C4041A5U,0x2138562DU,0x3A105B55U,
+        0xA28812FDU,0xB9A01F85U,0x94D8080DU,0x8FF00575U,
+        0xCE28271DU,0xD5002A65U,0xF8783DEDU,0xE3503095U,
+        0x754E2961U,0x6E662419U,0x431E3391U,0x58363EE9U,
+        0x19EE1C81U,0x02C611F9U,0x2FBE0671U,0x34960B09U,
+        0xAC0E42A1U,0xB7264FD9U,0x9A5E5851U,0x81765529U,
+        0xC0AE7741U,0xDB867A39U,0xF6FE6DB1U,0xEDD660C9U,
+        0xC30FE356U,0xD827EE2EU,0xF55FF9A6U,0xEE77F4DEU,
+        0xAFAFD6B6U,0xB487DBCEU,0x99FFCC46U,0x82D7C13EU,
+        0x1A4F8896U,0x016785EEU,0x2C1F9266U,0x37379F1EU,
+        0x76EFBD76U,0x6DC7B00EU,0x40BFA786U,0x5B97AAFEU,
+        0x1D0CA0B8U,0x0624ADC0U,0x2B5CBA48U,0x3074B730U,
+        0x71AC9558U,0x6A849820U,0x47FC8FA8U,0x5CD482D0U,
+        0xC44CCB78U,0xDF64C600U,0xF21CD188U,0xE934DCF0U,
+        0xA8ECFE98U,0xB3C4F3E0U,0x9EBCE468U,0x8594E910U,
+        0xAB4D6A8FU,0xB06567F7U,0x9D1D707FU,0x86357D07U,
+        0xC7ED5F6FU,0xDCC55217U,0xF1BD459FU,0xEA9548E7U,
+        0x720D014FU,0x69250C37U,0x445D1BBFU,0x5F7516C7U,
+        0x1EAD34AFU,0x058539D7U,0x28FD2E5FU,0x33D52327U
+    },
+    {
+        0x00000000U,0x4F576811U,0x9EAED022U,0xD1F9B833U,
+        0x399CBDF3U,0x76CBD5E2U,0xA7326DD1U,0xE86505C0U,
+        0x73397BE6U,0x3C6E13F7U,0xED97ABC4U,0xA2C0C3D5U,
+        0x4AA5C615U,0x05F2AE04U,0xD40B1637U,0x9B5C7E26U,
+        0xE672F7CCU,0xA9259FDDU,0x78DC27EEU,0x378B4FFFU,
+        0xDFEE4A3FU,0x90B9222EU,0x41409A1DU,0x0E17F20CU,
+        0x954B8C2AU,0xDA1CE43BU,0x0BE55C08U,0x44B23419U,
+        0xACD731D9U,0xE38059C8U,0x3279E1FBU,0x7D2E89EAU,
+        0xC824F22FU,0x87739A3EU,0x568A220DU,0x19DD4A1CU,
+        0xF1B84FDCU,0xBEEF27CDU,0x6F169FFEU,0x2041F7EFU,
+        0xBB1D89C9U,0xF44AE1D8U,0x25B359EBU,0x6AE431FAU,
+        0x8281343AU,0xCDD65C2BU,0x1C2FE418U,0x53788C09U,
+        0x2E5605E3U,0x61016DF2U,0xB0F8D5C1U,0xFFAFBDD0U,
+        0x17CAB810U,0x589DD001U,0x89646832U,0xC6330023U,
+        0x5D6F7E05U,0x12381614U,0xC3C1AE27U,0x8C96C636U,
+        0x64F3C3F6U,0x2BA4ABE7U,0xFA5D13D4U,0xB50A7BC5U,
+        0x9488F9E9U,0xDBDF91F8U,0x0A2629CBU,0x457141DAU,
+        0xAD14441AU,0xE2432C0BU,0x33BA9438U,0x7CEDFC29U,
+        0xE7B1820FU,0xA8E6EA1EU,0x791F522DU,0x36483A3CU,
+        0xDE2D3FFCU,0x917A57EDU,0x4083EFDEU,0x0FD487CFU,
+        0x72FA0E25U,0x3DAD6634U,0xEC54DE07U,0xA303B616U,
+        0x4B66B3D6U,0x0431DBC7U,0xD5C863F4U,0x9A9F0BE5U,
+        0x01C375C3U,0x4E941DD2U,0x9F6DA5E1U,0xD03ACDF0U,
+        0x385FC830U,0x7708A021U,0xA6F11812U,0xE9A67003U,
+        0x5CAC0BC6U,0x13FB63D7U,0xC202DBE4U,0x8D55B3F5U,
+        0x6530B635U,0x2A67DE24U,0xFB9E6617U,0xB4C90E06U,
+        0x2F957020U,0x60C21831U,0xB13BA002U,0xFE6CC813U,
+        0x1609CDD3U,0x595EA5C2U,0x88A71DF1U,0xC7F075E0U,
+        0xBADEFC0AU,0xF589941BU,0x24702C28U,0x6B274439U,
+        0x834241F9U,0xCC1529E8U,0x1DEC91DBU,0x52BBF9CAU,
+        0xC9E787ECU,0x86B0EFFDU,0x574957CEU,0x181E3FDFU,
+        0xF07B3A1FU,0xBF2C520EU,0x6ED5EA3DU,0x2182822CU,
+        0x2DD0EE65U,0x62878674U,0xB37E3E47U,0xFC295656U,
+        0x144C5396U,0x5B1B3B87U,0x8AE283B4U,0xC5B5EBA5U,
+        0x5EE99583U,0x11BEFD92U,0xC04745A1U,0x8F102DB0U,
+        0x67752870U,0x28224061U,0xF9DBF852U,0xB68C9043U,
+        0xCBA219A9U,0x84F571B8U,0x550CC98BU,0x1A5BA19AU,
+        0xF23EA45AU,0xBD69CC4BU,0x6C907478U,0x23C71C69U,
+        0xB89B624FU,0xF7CC0A5EU,0x2635B26DU,0x6962DA7CU,
+        0x8107DFBCU,0xCE50B7ADU,0x1FA90F9EU,0x50FE678FU,
+        0xE5F41C4AU,0xAAA3745BU,0x7B5ACC68U,0x340DA479U,
+        0xDC68A1B9U,0x933FC9A8U,0x42C6719BU,0x0D91198AU,
+        0x96CD67ACU,0xD99A0FBDU,0x0863B78EU,0x4734DF9FU,
+        0xAF51DA5FU,0xE006B24EU,0x31FF0A7DU,0x7EA8626CU,
+        0x0386EB86U,0x4CD18397U,0x9D283BA4U,0xD27F53B5U,
+        0x3A1A5675U,0x754D3E64U,0xA4B48657U,0xEBE3EE46U,
+        0x70BF9060U,0x3FE8F871U,0xEE114042U,0xA1462853U,
+        0x49232D93U,0x06744582U,0xD78DFDB1U,0x98DA95A0U,
+        0xB958178CU,0xF60F7F9DU,0x27F6C7AEU,0x68A1AFBFU,
+        0x80C4AA7FU,0xCF93C26EU,0x1E6A7A5DU,0x513D124CU,
+        0xCA616C6AU,0x8536047BU,0x54CFBC48U,0x1B98D459U,
+        0xF3FDD199U,0xBCAAB988U,0x6D5301BBU,0x220469AAU,
+        0x5F2AE040U,0x107D8851U,0xC1843062U,0x8ED35873U,
+        0x66B65DB3U,0x29E135A2U,0xF8188D91U,0xB74FE580U,
+        0x2C139BA6U,0x6344F3B7U,0xB2BD4B84U,0xFDEA2395U,
+        0x158F2655U,0x5AD84E44U,0x8B21F677U,0xC4769E66U,
+        0x717CE5A3U,0x3E2B8DB2U,0xEFD23581U,0xA0855D90U,
+        0x48E05850U,0x07B73041U,0xD64E8872U,0x9919E063U,
+        0x02459E45U,0x4D12F654U,0x9CEB4E67U,0xD3BC2676U,
+        0x3BD923B6U,0x748E4BA7U,0xA577F394U,0xEA209B85U,
+        0x970E126FU,0xD8597A7EU,0x09A0C24DU,0x46F7AA5CU,
+        0xAE92AF9CU,0xE1C5C78DU,0x303C7FBEU,0x7F6B17AFU,
+        0xE4376989U,0xAB600198U,0x7A99B9ABU,0x35CED1BAU,
+        0xDDABD47AU,0x92FCBC6BU,0x43050458U,0x0C526C49U
+    },
+    {
+        0x00000000U,0x5BA1DCCAU,0xB743B994U,0xECE2655EU,
+        0x6A466E9FU,0x31E7B255U,0xDD05D70BU,0x86A40BC1U,
+        0xD48CDD3EU,0x8F2D01F4U,0x63CF64AAU,0x386EB860U,
+        0xBECAB3A1U,0xE56B6F6BU,0x09890A35U,0x5228D6FFU,
+        0xADD8A7CBU,0xF6797B01U,0x1A9B1E5FU,0x413AC295U,
+        0xC79EC954U,0x9C3F159EU,0x70DD70C0U,0x2B7CAC0AU,
+        0x79547AF5U,0x22F5A63FU,0xCE17C361U,0x95B61FABU,
+        0x1312146AU,0x48B3C8A0U,0xA451ADFEU,0xFFF07134U,
+        0x5F705221U,0x04D18EEBU,0xE833EBB5U,0xB392377FU,
+        0x35363CBEU,0x6E97E074U,0x8275852AU,0xD9D459E0U,
+        0x8BFC8F1FU,0xD05D53D5U,0x3CBF368BU,0x671EEA41U,
+        0xE1BAE180U,0xBA1B3D4AU,0x56F95814U,0x0D5884DEU,
+        0xF2A8F5EAU,0xA9092920U,0x45EB4C7EU,0x1E4A90B4U,
+        0x98EE9B75U,0xC34F47BFU,0x2FAD22E1U,0x740CFE2BU,
+        0x262428D4U,0x7D85F41EU,0x91679140U,0xCAC64D8AU,
+        0x4C62464BU,0x17C39A81U,0xFB21FFDFU,0xA0802315U,
+        0xBEE0A442U,0xE5417888U,0x09A31DD6U,0x5202C11CU,
+        0xD4A6CADDU,0x8F071617U,0x63E57349U,0x3844AF83U,
+        0x6A6C797CU,0x31CDA5B6U,0xDD2FC0E8U,0x868E1C22U,
+        0x002A17E3U,0x5B8BCB29U,0xB769AE77U,0xECC872BDU,
+        0x13380389U,0x4899DF43U,0xA47BBA1DU,0xFFDA66D7U,
+        0x797E6D16U,0x22DFB1DCU,0xCE3DD482U,0x959C0848U,
+        0xC7B4DEB7U,0x9C15027DU,0x70F76723U,0x2B56BBE9U,
+        0xADF2B028U,0xF6536CE2U,0x1AB109BCU,0x4110D576U,
+        0xE190F663U,0xBA312AA9U,0x56D34FF7U,0x0D72933DU,
+        0x8BD698FCU,0xD0774436U,0x3C952168U,0x6734FDA2U,
+        0x351C2B5DU,0x6EBDF797U,0x825F92C9U,0xD9FE4E03U,
+        0x5F5A45C2U,0x04FB9908U,0xE819FC56U,0xB3B8209CU,
+        0x4C4851A8U,0x17E98D62U,0xFB0BE83CU,0xA0AA34F6U,
+        0x260E3F37U,0x7DAFE3FDU,0x914D86A3U,0xCAEC5A69U,
+        0x98C48C96U,0xC365505CU,0x2F873502U,0x7426E9C8U,
+        0xF282E209U,0xA9233EC3U,0x45C15B9DU,0x1E608757U,
+        0x79005533U,0x22A189F9U,0xCE43ECA7U,0x95E2306DU,
+        0x13463BACU,0x48E7E766U,0xA4058238U,0xFFA45EF2U,
+        0xAD8C880DU,0xF62D54C7U,0x1ACF3199U,0x416EED53U,
+        0xC7CAE692U,0x9C6B3A58U,0x70895F06U,0x2B2883CCU,
+        0xD4D8F2F8U,0x8F792E32U,0x639B4B6CU,0x383A97A6U,
+        0xBE9E9C67U,0xE53F40ADU,0x09DD25F3U,0x527CF939U,
+        0x00542FC6U,0x5BF5F30CU,0xB7179652U,0xECB64A98U,
+        0x6A124159U,0x31B39D93U,0xDD51F8CDU,0x86F02407U,
+        0x26700712U,0x7DD1DBD8U,0x9133BE86U,0xCA92624CU,
+        0x4C36698DU,0x1797B547U,0xFB75D019U,0xA0D40CD3U,
+        0xF2FCDA2CU,0xA95D06E6U,0x45BF63B8U,0x1E1EBF72U,
+        0x98BAB4B3U,0xC31B6879U,0x2FF90D27U,0x7458D1EDU,
+        0x8BA8A0D9U,0xD0097C13U,0x3CEB194DU,0x674AC587U,
+        0xE1EECE46U,0xBA4F128CU,0x56AD77D2U,0x0D0CAB18U,
+        0x5F247DE7U,0x0485A12DU,0xE867C473U,0xB3C618B9U,
+        0x35621378U,0x6EC3CFB2U,0x8221AAECU,0xD9807626U,
+        0xC7E0F171U,0x9C412DBBU,0x70A348E5U,0x2B02942FU,
+        0xADA69FEEU,0xF6074324U,0x1AE5267AU,0x4144FAB0U,
+        0x136C2C4FU,0x48CDF085U,0xA42F95DBU,0xFF8E4911U,
+        0x792A42D0U,0x228B9E1AU,0xCE69FB44U,0x95C8278EU,
+        0x6A3856BAU,0x31998A70U,0xDD7BEF2EU,0x86DA33E4U,
+        0x007E3825U,0x5BDFE4EFU,0xB73D81B1U,0xEC9C5D7BU,
+        0xBEB48B84U,0xE515574EU,0x09F73210U,0x5256EEDAU,
+        0xD4F2E51BU,0x8F5339D1U,0x63B15C8FU,0x38108045U,
+        0x9890A350U,0xC3317F9AU,0x2FD31AC4U,0x7472C60EU,
+        0xF2D6CDCFU,0xA9771105U,0x4595745BU,0x1E34A891U,
+        0x4C1C7E6EU,0x17BDA2A4U,0xFB5FC7FAU,0xA0FE1B30U,
+        0x265A10F1U,0x7DFBCC3BU,0x9119A965U,0xCAB875AFU,
+        0x3548049BU,0x6EE9D851U,0x820BBD0FU,0xD9AA61C5U,
+        0x5F0E6A04U,0x04AFB6CEU,0xE84DD390U,0xB3EC0F5AU,
+        0xE1C4D9A5U,0xBA65056FU,0x56876031U,0x0D26BCFBU,
+        0x8B82B73AU,0xD0236BF0U,0x3CC10EAEU,0x6760D264U
+    },
+    {
+        0x00000000U,0xF200AA66U,0xE0C0497BU,0x12C0E31DU,
+        0xC5418F41U,0x37412527U,0x2581C63AU,0xD7816C5CU,
+        0x8E420335U,0x7C42A953U,0x6E824A4EU,0x9C82E028U,
+        0x4B038C74U,0xB9032612U,0xABC3C50FU,0x59C36F69U,
+        0x18451BDDU,0xEA45B1BBU,0xF88552A6U,0x0A85F8C0U,
+        0xDD04949CU,0x2F043EFAU,0x3DC4DDE7U,0xCFC47781U,
+        0x960718E8U,0x6407B28EU,0x76C75193U,0x84C7FBF5U,
+        0x534697A9U,0xA1463DCFU,0xB386DED2U,0x418674B4U,
+        0x308A37BAU,0xC28A9DDCU,0xD04A7EC1U,0x224AD4A7U,
+        0xF5CBB8FBU,0x07CB129DU,0x150BF180U,0xE70B5BE6U,
+        0xBEC8348FU,0x4CC89EE9U,0x5E087DF4U,0xAC08D792U,
+        0x7B89BBCEU,0x898911A8U,0x9B49F2B5U,0x694958D3U,
+        0x28CF2C67U,0xDACF8601U,0xC80F651CU,0x3A0FCF7AU,
+        0xED8EA326U,0x1F8E0940U,0x0D4EEA5DU,0xFF4E403BU,
+        0xA68D2F52U,0x548D8534U,0x464D6629U,0xB44DCC4FU,
+        0x63CCA013U,0x91CC0A75U,0x830CE968U,0x710C430EU,
+        0x61146F74U,0x9314C512U,0x81D4260FU,0x73D48C69U,
+        0xA455E035U,0x56554A53U,0x4495A94EU,0xB6950328U,
+        0xEF566C41U,0x1D56C627U,0x0F96253AU,0xFD968F5CU,
+        0x2A17E300U,0xD8174966U,0xCAD7AA7BU,0x38D7001DU,
+        0x795174A9U,0x8B51DECFU,0x99913DD2U,0x6B9197B4U,
+        0xBC10FBE8U,0x4E10518EU,0x5CD0B293U,0xAED018F5U,
+        0xF713779CU,0x0513DDFAU,0x17D33EE7U,0xE5D39481U,
+        0x3252F8DDU,0xC05252BBU,0xD292B1A6U,0x20921BC0U,
+        0x519E58CEU,0xA39EF2A8U,0xB15E11B5U,0x435EBBD3U,
+        0x94DFD78FU,0x66DF7DE9U,0x741F9EF4U,0x861F3492U,
+        0xDFDC5BFBU,0x2DDCF19DU,0x3F1C1280U,0xCD1CB8E6U,
+        0x1A9DD4BAU,0xE89D7EDCU,0xFA5D9DC1U,0x085D37A7U,
+        0x49DB4313U,0xBBDBE975U,0xA91B0A68U,0x5B1BA00EU,
+        0x8C9ACC52U,0x7E9A6634U,0x6C5A8529U,0x9E5A2F4FU,
+        0xC7994026U,0x3599EA40U,0x2759095DU,0xD559A33BU,
+        0x02D8CF67U,0xF0D86501U,0xE218861CU,0x10182C7AU,
+        0xC228DEE8U,0x3028748EU,0x22E89793U,0xD0E83DF5U,
+        0x076951A9U,0xF569FBCFU,0xE7A918D2U,0x15A9B2B4U,
+        0x4C6ADDDDU,0xBE6A77BBU,0xACAA94A6U,0x5EAA3EC0U,
+        0x892B529CU,0x7B2BF8FAU,0x69EB1BE7U,0x9BEBB181U,
+        0xDA6DC535U,0x286D6F53U,0x3AAD8C4EU,0xC8AD2628U,
+        0x1F2C4A74U,0xED2CE012U,0xFFEC030FU,0x0DECA969U,
+        0x542FC600U,0xA62F6C66U,0xB4EF8F7BU,0x46EF251DU,
+        0x916E4941U,0x636EE327U,0x71AE003AU,0x83AEAA5CU,
+        0xF2A2E952U,0x00A24334U,0x1262A029U,0xE0620A4FU,
+        0x37E36613U,0xC5E3CC75U,0xD7232F68U,0x2523850EU,
+        0x7CE0EA67U,0x8EE04001U,0x9C20A31CU,0x6E20097AU,
+        0xB9A16526U,0x4BA1CF40U,0x59612C5DU,0xAB61863BU,
+        0xEAE7F28FU,0x18E758E9U,0x0A27BBF4U,0xF8271192U,
+        0x2FA67DCEU,0xDDA6D7A8U,0xCF6634B5U,0x3D669ED3U,
+        0x64A5F1BAU,0x96A55BDCU,0x8465B8C1U,0x766512A7U,
+        0xA1E47EFBU,0x53E4D49DU,0x41243780U,0xB3249DE6U,
+        0xA33CB19CU,0x513C1BFAU,0x43FCF8E7U,0xB1FC5281U,
+        0x667D3EDDU,0x947D94BBU,0x86BD77A6U,0x74BDDDC0U,
+        0x2D7EB2A9U,0xDF7E18CFU,0xCDBEFBD2U,0x3FBE51B4U,
+        0xE83F3DE8U,0x1A3F978EU,0x08FF7493U,0xFAFFDEF5U,
+        0xBB79AA41U,0x49790027U,0x5BB9E33AU,0xA9B9495CU,
+        0x7E382500U,0x8C388F66U,0x9EF86C7BU,0x6CF8C61DU,
+        0x353BA974U,0xC73B0312U,0xD5FBE00FU,0x27FB4A69U,
+        0xF07A2635U,0x027A8C53U,0x10BA6F4EU,0xE2BAC528U,
+        0x93B68626U,0x61B62C40U,0x7376CF5DU,0x8176653BU,
+        0x56F70967U,0xA4F7A301U,0xB637401CU,0x4437EA7AU,
+        0x1DF48513U,0xEFF42F75U,0xFD34CC68U,0x0F34660EU,
+        0xD8B50A52U,0x2AB5A034U,0x38754329U,0xCA75E94FU,
+        0x8BF39DFBU,0x79F3379DU,0x6B33D480U,0x99337EE6U,
+        0x4EB212BAU,0xBCB2B8DCU,0xAE725BC1U,0x5C72F1A7U,
+        0x05B19ECEU,0xF7B134A8U,0xE571D7B5U,0x17717DD3U,
+        0xC0F0118FU,0x32F0BBE9U,0x203058F4U,0xD230F292U
+    },
+    {
+        0x00000000U,0x8090A067U,0x05E05D79U,0x8570FD1EU,
+        0x0BC0BAF2U,0x8B501A95U,0x0E20E78BU,0x8EB047ECU,
+        0x178175E4U,0x9711D583U,0x1261289DU,0x92F188FAU,
+        0x1C41CF16U,0x9CD16F71U,0x19A1926FU,0x99313208U,
+        0x2F02EBC8U,0xAF924BAFU,0x2AE2B6B1U,0xAA7216D6U,
+        0x24C2513AU,0xA452F15DU,0x21220C43U,0xA1B2AC24U,
+        0x38839E2CU,0xB8133E4BU,0x3D63C355U,0xBDF36332U,
+        0x334324DEU,0xB3D384B9U,0x36A379A7U,0xB633D9C0U,
+        0x5E05D790U,0xDE9577F7U,0x5BE58AE9U,0xDB752A8EU,
+        0x55C56D62U,0xD555CD05U,0x5025301BU,0xD0B5907CU,
+        0x4984A274U,0xC9140213U,0x4C64FF0DU,0xCCF45F6AU,
+        0x42441886U,0xC2D4B8E1U,0x47A445FFU,0xC734E598U,
+        0x71073C58U,0xF1979C3FU,0x74E76121U,0xF477C146U,
+        0x7AC786AAU,0xFA5726CDU,0x7F27DBD3U,0xFFB77BB4U,
+        0x668649BCU,0xE616E9DBU,0x636614C5U,0xE3F6B4A2U,
+        0x6D46F34EU,0xEDD65329U,0x68A6AE37U,0xE8360E50U,
+        0xBC0BAF20U,0x3C9B0F47U,0xB9EBF259U,0x397B523EU,
+        0xB7CB15D2U,0x375BB5B5U,0xB22B48ABU,0x32BBE8CCU,
+        0xAB8ADAC4U,0x2B1A7AA3U,0xAE6A87BDU,0x2EFA27DAU,
+        0xA04A6036U,0x20DAC051U,0xA5AA3D4FU,0x253A9D28U,
+        0x930944E8U,0x1399E48FU,0x96E91991U,0x1679B9F6U,
+        0x98C9FE1AU,0x18595E7DU,0x9D29A363U,0x1DB90304U,
+        0x8488310CU,0x0418916BU,0x81686C75U,0x01F8CC12U,
+        0x8F488BFEU,0x0FD82B99U,0x8AA8D687U,0x0A3876E0U,
+        0xE20E78B0U,0x629ED8D7U,0xE7EE25C9U,0x677E85AEU,
+        0xE9CEC242U,0x695E6225U,0xEC2E9F3BU,0x6CBE3F5CU,
+        0xF58F0D54U,0x751FAD33U,0xF06F502DU,0x70FFF04AU,
+        0xFE4FB7A6U,0x7EDF17C1U,0xFBAFEADFU,0x7B3F4AB8U,
+        0xCD0C9378U,0x4D9C331FU,0xC8ECCE01U,0x487C6E66U,
+        0xC6CC298AU,0x465C89EDU,0xC32C74F3U,0x43BCD494U,
+        0xDA8DE69CU,0x5A1D46FBU,0xDF6DBBE5U,0x5FFD1B82U,
+        0xD14D5C6EU,0x51DDFC09U,0xD4AD0117U,0x543DA170U,
+        0x7CD643F7U,0xFC46E390U,0x79361E8EU,0xF9A6BEE9U,
+        0x7716F905U,0xF7865962U,0x72F6A47CU,0xF266041BU,
+        0x6B573613U,0xEBC79674U,0x6EB76B6AU,0xEE27CB0DU,
+        0x60978CE1U,0xE0072C86U,0x6577D198U,0xE5E771FFU,
+        0x53D4A83FU,0xD3440858U,0x5634F546U,0xD6A45521U,
+        0x581412CDU,0xD884B2AAU,0x5DF44FB4U,0xDD64EFD3U,
+        0x4455DDDBU,0xC4C57DBCU,0x41B580A2U,0xC12520C5U,
+        0x4F956729U,0xCF05C74EU,0x4A753A50U,0xCAE59A37U,
+        0x22D39467U,0xA2433400U,0x2733C91EU,0xA7A36979U,
+        0x29132E95U,0xA9838EF2U,0x2CF373ECU,0xAC63D38BU,
+        0x3552E183U,0xB5C241E4U,0x30B2BCFAU,0xB0221C9DU,
+        0x3E925B71U,0xBE02FB16U,0x3B720608U,0xBBE2A66FU,
+        0x0DD17FAFU,0x8D41DFC8U,0x083122D6U,0x88A182B1U,
+        0x0611C55DU,0x8681653AU,0x03F19824U,0x83613843U,
+        0x1A500A4BU,0x9AC0AA2CU,0x1FB05732U,0x9F20F755U,
+        0x1190B0B9U,0x910010DEU,0x1470EDC0U,0x94E04DA7U,
+        0xC0DDECD7U,0x404D4CB0U,0xC53DB1AEU,0x45AD11C9U,
+        0xCB1D5625U,0x4B8DF642U,0xCEFD0B5CU,0x4E6DAB3BU,
+        0xD75C9933U,0x57CC3954U,0xD2BCC44AU,0x522C642DU,
+        0xDC9C23C1U,0x5C0C83A6U,0xD97C7EB8U,0x59ECDEDFU,
+        0xEFDF071FU,0x6F4FA778U,0xEA3F5A66U,0x6AAFFA01U,
+        0xE41FBDEDU,0x648F1D8AU,0xE1FFE094U,0x616F40F3U,
+        0xF85E72FBU,0x78CED29CU,0xFDBE2F82U,0x7D2E8FE5U,
+        0xF39EC809U,0x730E686EU,0xF67E9570U,0x76EE3517U,
+        0x9ED83B47U,0x1E489B20U,0x9B38663EU,0x1BA8C659U,
+        0x951881B5U,0x158821D2U,0x90F8DCCCU,0x10687CABU,
+        0x89594EA3U,0x09C9EEC4U,0x8CB913DAU,0x0C29B3BDU,
+        0x8299F451U,0x02095436U,0x8779A928U,0x07E9094FU,
+        0xB1DAD08FU,0x314A70E8U,0xB43A8DF6U,0x34AA2D91U,
+        0xBA1A6A7DU,0x3A8ACA1AU,0xBFFA3704U,0x3F6A9763U,
+        0xA65BA56BU,0x26CB050CU,0xA3BBF812U,0x232B5875U,
+        0xAD9B1F99U,0x2D0BBFFEU,0xA87B42E0U,0x28EBE287U
+    },
+    {
+        0x00000000U,0xF9AC87EEU,0xF798126BU,0x0E349585U,
+        0xEBF13961U,0x125DBE8FU,0x1C692B0AU,0xE5C5ACE4U,
+        0xD3236F75U,0x2A8FE89BU,0x24BB7D1EU,0xDD17FAF0U,
+        0x38D25614U,0xC17ED1FAU,0xCF4A447FU,0x36E6C391U,
+        0xA287C35DU,0x5B2B44B3U,0x551FD136U,0xACB356D8U,
+        0x4976FA3CU,0xB0DA7DD2U,0xBEEEE857U,0x47426FB9U,
+        0x71A4AC28U,0x88082BC6U,0x863CBE43U,0x7F9039ADU,
+        0x9A559549U,0x63F912A7U,0x6DCD8722U,0x946100CCU,
+        0x41CE9B0DU,0xB8621CE3U,0xB6568966U,0x4FFA0E88U,
+        0xAA3FA26CU,0x53932582U,0x5DA7B007U,0xA40B37E9U,
+        0x92EDF478U,0x6B417396U,0x6575E613U,0x9CD961FDU,
+        0x791CCD19U,0x80B04AF7U,0x8E84DF72U,0x7728589CU,
+        0xE3495850U,0x1AE5DFBEU,0x14D14A3BU,0xED7DCDD5U,
+        0x08B86131U,0xF114E6DFU,0xFF20735AU,0x068CF4B4U,
+        0x306A3725U,0xC9C6B0CBU,0xC7F2254EU,0x3E5EA2A0U,
+        0xDB9B0E44U,0x223789AAU,0x2C031C2FU,0xD5AF9BC1U,
+        0x839D361AU,0x7A31B1F4U,0x74052471U,0x8DA9A39FU,
+        0x686C0F7BU,0x91C08895U,0x9FF41D10U,0x66589AFEU,
+        0x50BE596FU,0xA912DE81U,0xA7264B04U,0x5E8ACCEAU,
+        0xBB4F600EU,0x42E3E7E0U,0x4CD77265U,0xB57BF58BU,
+        0x211AF547U,0xD8B672A9U,0xD682E72CU,0x2F2E60C2U,
+        0xCAEBCC26U,0x33474BC8U,0x3D73DE4DU,0xC4DF59A3U,
+        0xF2399A32U,0x0B951DDCU,0x05A18859U,0xFC0D0FB7U,
+        0x19C8A353U,0xE06424BDU,0xEE50B138U,0x17FC36D6U,
+        0xC253AD17U,0x3BFF2AF9U,0x35CBBF7CU,0xCC673892U,
+        0x29A29476U,0xD00E1398U,0xDE3A861DU,0x279601F3U,
+        0x1170C262U,0xE8DC458CU,0xE6E8D009U,0x1F4457E7U,
+        0xFA81FB03U,0x032D7CEDU,0x0D19E968U,0xF4B56E86U,
+        0x60D46E4AU,0x9978E9A4U,0x974C7C21U,0x6EE0FBCFU,
+        0x8B25572BU,0x7289D0C5U,0x7CBD4540U,0x8511C2AEU,
+        0xB3F7013FU,0x4A5B86D1U,0x446F1354U,0xBDC394BAU,
+        0x5806385EU,0xA1AABFB0U,0xAF9E2A35U,0x5632ADDBU,
+        0x03FB7183U,0xFA57F66DU,0xF46363E8U,0x0DCFE406U,
+        0xE80A48E2U,0x11A6CF0CU,0x1F925A89U,0xE63EDD67U,
+        0xD0D81EF6U,0x29749918U,0x27400C9DU,0xDEEC8B73U,
+        0x3B292797U,0xC285A079U,0xCCB135FCU,0x351DB212U,
+        0xA17CB2DEU,0x58D03530U,0x56E4A0B5U,0xAF48275BU,
+        0x4A8D8BBFU,0xB3210C51U,0xBD1599D4U,0x44B91E3AU,
+        0x725FDDABU,0x8BF35A45U,0x85C7CFC0U,0x7C6B482EU,
+        0x99AEE4CAU,0x60026324U,0x6E36F6A1U,0x979A714FU,
+        0x4235EA8EU,0xBB996D60U,0xB5ADF8E5U,0x4C017F0BU,
+        0xA9C4D3EFU,0x50685401U,0x5E5CC184U,0xA7F0466AU,
+        0x911685FBU,0x68BA0215U,0x668E9790U,0x9F22107EU,
+        0x7AE7BC9AU,0x834B3B74U,0x8D7FAEF1U,0x74D3291FU,
+        0xE0B229D3U,0x191EAE3DU,0x172A3BB8U,0xEE86BC56U,
+        0x0B4310B2U,0xF2EF975CU,0xFCDB02D9U,0x05778537U,
+        0x339146A6U,0xCA3DC148U,0xC40954CDU,0x3DA5D323U,
+        0xD8607FC7U,0x21CCF829U,0x2FF86DACU,0xD654EA42U,
+        0x80664799U,0x79CAC077U,0x77FE55F2U,0x8E52D21CU,
+        0x6B977EF8U,0x923BF916U,0x9C0F6C93U,0x65A3EB7DU,
+        0x534528ECU,0xAAE9AF02U,0xA4DD3A87U,0x5D71BD69U,
+        0xB8B4118DU,0x41189663U,0x4F2C03E6U,0xB6808408U,
+        0x22E184C4U,0xDB4D032AU,0xD57996AFU,0x2CD51141U,
+        0xC910BDA5U,0x30BC3A4BU,0x3E88AFCEU,0xC7242820U,
+        0xF1C2EBB1U,0x086E6C5FU,0x065AF9DAU,0xFFF67E34U,
+        0x1A33D2D0U,0xE39F553EU,0xEDABC0BBU,0x14074755U,
+        0xC1A8DC94U,0x38045B7AU,0x3630CEFFU,0xCF9C4911U,
+        0x2A59E5F5U,0xD3F5621BU,0xDDC1F79EU,0x246D7070U,
+        0x128BB3E1U,0xEB27340FU,0xE513A18AU,0x1CBF2664U,
+        0xF97A8A80U,0x00D60D6EU,0x0EE298EBU,0xF74E1F05U,
+        0x632F1FC9U,0x9A839827U,0x94B70DA2U,0x6D1B8A4CU,
+        0x88DE26A8U,0x7172A146U,0x7F4634C3U,0x86EAB32DU,
+        0xB00C70BCU,0x49A0F752U,0x479462D7U,0xBE38E539U,
+        0x5BFD49DDU,0xA251CE33U,0xAC655BB6U,0x55C9DC58U
+    },
+    {
+        0x00000000U,0x07F6E306U,0x0FEDC60CU,0x081B250AU,
+        0x1FDB8C18U,0x182D6F1EU,0x10364A14U,0x17C0A912U,
+        0x3FB71830U,0x3841FB36U,0x305ADE3CU,0x37AC3D3AU,
+        0x206C9428U,0x279A772EU,0x2F815224U,0x2877B122U,
+        0x7F6E3060U,0x7898D366U,0x7083F66CU,0x7775156AU,
+        0x60B5BC78U,0x67435F7EU,0x6F587A74U,0x68AE9972U,
+        0x40D92850U,0x472FCB56U,0x4F34EE5CU,0x48C20D5AU,
+        0x5F02A448U,0x58F4474EU,0x50EF6244U,0x57198142U,
+        0xFEDC60C0U,0xF92A83C6U,0xF131A6CCU,0xF6C745CAU,
+        0xE107ECD8U,0xE6F10FDEU,0xEEEA2AD4U,0xE91CC9D2U,
+        0xC16B78F0U,0xC69D9BF6U,0xCE86BEFCU,0xC9705DFAU,
+        0xDEB0F4E8U,0xD94617EEU,0xD15D32E4U,0xD6ABD1E2U,
+        0x81B250A0U,0x8644B3A6U,0x8E5F96ACU,0x89A975AAU,
+        0x9E69DCB8U,0x999F3FBEU,0x91841AB4U,0x9672F9B2U,
+        0xBE054890U,0xB9F3AB96U,0xB1E88E9CU,0xB61E6D9AU,
+        0xA1DEC488U,0xA628278EU,0xAE330284U,0xA9C5E182U,
+        0xF979DC37U,0xFE8F3F31U,0xF6941A3BU,0xF162F93DU,
+        0xE6A2502FU,0xE154B329U,0xE94F9623U,0xEEB97525U,
+        0xC6CEC407U,0xC1382701U,0xC923020BU,0xCED5E10DU,
+        0xD915481FU,0xDEE3AB19U,0xD6F88E13U,0xD10E6D15U,
+        0x8617EC57U,0x81E10F51U,0x89FA2A5BU,0x8E0CC95DU,
+        0x99CC604FU,0x9E3A8349U,0x9621A643U,0x91D74545U,
+        0xB9A0F467U,0xBE561761U,0xB64D326BU,0xB1BBD16DU,
+        0xA67B787FU,0xA18D9B79U,0xA996BE73U,0xAE605D75U,
+        0x07A5BCF7U,0x00535FF1U,0x08487AFBU,0x0FBE99FDU,
+        0x187E30EFU,0x1F88D3E9U,0x1793F6E3U,0x106515E5U,
+        0x3812A4C7U,0x3FE447C1U,0x37FF62CBU,0x300981CDU,
+        0x27C928DFU,0x203FCBD9U,0x2824EED3U,0x2FD20DD5U,
+        0x78CB8C97U,0x7F3D6F91U,0x77264A9BU,0x70D0A99DU,
+        0x6710008FU,0x60E6E389U,0x68FDC683U,0x6F0B2585U,
+        0x477C94A7U,0x408A77A1U,0x489152ABU,0x4F67B1ADU,
+        0x58A718BFU,0x5F51FBB9U,0x574ADEB3U,0x50BC3DB5U,
+        0xF632A5D9U,0xF1C446DFU,0xF9DF63D5U,0xFE2980D3U,
+        0xE9E929C1U,0xEE1FCAC7U,0xE604EFCDU,0xE1F20CCBU,
+        0xC985BDE9U,0xCE735EEFU,0xC6687BE5U,0xC19E98E3U,
+        0xD65E31F1U,0xD1A8D2F7U,0xD9B3F7FDU,0xDE4514FBU,
+        0x895C95B9U,0x8EAA76BFU,0x86B153B5U,0x8147B0B3U,
+        0x968719A1U,0x9171FAA7U,0x996ADFADU,0x9E9C3CABU,
+        0xB6EB8D89U,0xB11D6E8FU,0xB9064B85U,0xBEF0A883U,
+        0xA9300191U,0xAEC6E297U,0xA6DDC79DU,0xA12B249BU,
+        0x08EEC519U,0x0F18261FU,0x07030315U,0x00F5E013U,
+        0x17354901U,0x10C3AA07U,0x18D88F0DU,0x1F2E6C0BU,
+        0x3759DD29U,0x30AF3E2FU,0x38B41B25U,0x3F42F823U,
+        0x28825131U,0x2F74B237U,0x276F973DU,0x2099743BU,
+        0x7780F579U,0x7076167FU,0x786D3375U,0x7F9BD073U,
+        0x685B7961U,0x6FAD9A67U,0x67B6BF6DU,0x60405C6BU,
+        0x4837ED49U,0x4FC10E4FU,0x47DA2B45U,0x402CC843U,
+        0x57EC6151U,0x501A8257U,0x5801A75DU,0x5FF7445BU,
+        0x0F4B79EEU,0x08BD9AE8U,0x00A6BFE2U,0x07505CE4U,
+        0x1090F5F6U,0x176616F0U,0x1F7D33FAU,0x188BD0FCU,
+        0x30FC61DEU,0x370A82D8U,0x3F11A7D2U,0x38E744D4U,
+        0x2F27EDC6U,0x28D10EC0U,0x20CA2BCAU,0x273CC8CCU,
+        0x7025498EU,0x77D3AA88U,0x7FC88F82U,0x783E6C84U,
+        0x6FFEC596U,0x68082690U,0x6013039AU,0x67E5E09CU,
+        0x4F9251BEU,0x4864B2B8U,0x407F97B2U,0x478974B4U,
+        0x5049DDA6U,0x57BF3EA0U,0x5FA41BAAU,0x5852F8ACU,
+        0xF197192EU,0xF661FA28U,0xFE7ADF22U,0xF98C3C24U,
+        0xEE4C9536U,0xE9BA7630U,0xE1A1533AU,0xE657B03CU,
+        0xCE20011EU,0xC9D6E218U,0xC1CDC712U,0xC63B2414U,
+        0xD1FB8D06U,0xD60D6E00U,0xDE164B0AU,0xD9E0A80CU,
+        0x8EF9294EU,0x890FCA48U,0x8114EF42U,0x86E20C44U,
+        0x9122A556U,0x96D44650U,0x9ECF635AU,0x9939805CU,
+        0xB14E317EU,0xB6B8D278U,0xBEA3F772U,0xB9551474U,
+        0xAE95BD66U,0xA9635E60U,0xA1787B6AU,0xA68E986CU
+    },
+    {
+        0x00000000U,0xE8A45605U,0xD589B1BDU,0x3D2DE7B8U,
+        0xAFD27ECDU,0x477628C8U,0x7A5BCF70U,0x92FF9975U,
+        0x5B65E02DU,0xB3C1B628U,0x8EEC5190U,0x66480795U,
+        0xF4B79EE0U,0x1C13C8E5U,0x213E2F5DU,0xC99A7958U,
+        0xB6CBC05AU,0x5E6F965FU,0x634271E7U,0x8BE627E2U,
+        0x1919BE97U,0xF1BDE892U,0xCC900F2AU,0x2434592FU,
+        0xEDAE2077U,0x050A7672U,0x382791CAU,0xD083C7CFU,
+        0x427C5EBAU,0xAAD808BFU,0x97F5EF07U,0x7F51B902U,
+        0x69569D03U,0x81F2CB06U,0xBCDF2CBEU,0x547B7ABBU,
+        0xC684E3CEU,0x2E20B5CBU,0x130D5273U,0xFBA90476U,
+        0x32337D2EU,0xDA972B2BU,0xE7BACC93U,0x0F1E9A96U,
+        0x9DE103E3U,0x754555E6U,0x4868B25EU,0xA0CCE45BU,
+        0xDF9D5D59U,0x37390B5CU,0x0A14ECE4U,0xE2B0BAE1U,
+        0x704F2394U,0x98EB7591U,0xA5C69229U,0x4D62C42CU,
+        0x84F8BD74U,0x6C5CEB71U,0x51710CC9U,0xB9D55ACCU,
+        0x2B2AC3B9U,0xC38E95BCU,0xFEA37204U,0x16072401U,
+        0xD2AD3A06U,0x3A096C03U,0x07248BBBU,0xEF80DDBEU,
+        0x7D7F44CBU,0x95DB12CEU,0xA8F6F576U,0x4052A373U,
+        0x89C8DA2BU,0x616C8C2EU,0x5C416B96U,0xB4E53D93U,
+        0x261AA4E6U,0xCEBEF2E3U,0xF393155BU,0x1B37435EU,
+        0x6466FA5CU,0x8CC2AC59U,0xB1EF4BE1U,0x594B1DE4U,
+        0xCBB48491U,0x2310D294U,0x1E3D352CU,0xF6996329U,
+        0x3F031A71U,0xD7A74C74U,0xEA8AABCCU,0x022EFDC9U,
+        0x90D164BCU,0x787532B9U,0x4558D501U,0xADFC8304U,
+        0xBBFBA705U,0x535FF100U,0x6E7216B8U,0x86D640BDU,
+        0x1429D9C8U,0xFC8D8FCDU,0xC1A06875U,0x29043E70U,
+        0xE09E4728U,0x083A112DU,0x3517F695U,0xDDB3A090U,
+        0x4F4C39E5U,0xA7E86FE0U,0x9AC58858U,0x7261DE5DU,
+        0x0D30675FU,0xE594315AU,0xD8B9D6E2U,0x301D80E7U,
+        0xA2E21992U,0x4A464F97U,0x776BA82FU,0x9FCFFE2AU,
+        0x56558772U,0xBEF1D177U,0x83DC36CFU,0x6B7860CAU,
+        0xF987F9BFU,0x1123AFBAU,0x2C0E4802U,0xC4AA1E07U,
+        0xA19B69BBU,0x493F3FBEU,0x7412D806U,0x9CB68E03U,
+        0x0E491776U,0xE6ED4173U,0xDBC0A6CBU,0x3364F0CEU,
+        0xFAFE8996U,0x125ADF93U,0x2F77382BU,0xC7D36E2EU,
+        0x552CF75BU,0xBD88A15EU,0x80A546E6U,0x680110E3U,
+        0x1750A9E1U,0xFFF4FFE4U,0xC2D9185CU,0x2A7D4E59U,
+        0xB882D72CU,0x50268129U,0x6D0B6691U,0x85AF3094U,
+        0x4C3549CCU,0xA4911FC9U,0x99BCF871U,0x7118AE74U,
+        0xE3E73701U,0x0B436104U,0x366E86BCU,0xDECAD0B9U,
+        0xC8CDF4B8U,0x2069A2BDU,0x1D444505U,0xF5E01300U,
+        0x671F8A75U,0x8FBBDC70U,0xB2963BC8U,0x5A326DCDU,
+        0x93A81495U,0x7B0C4290U,0x4621A528U,0xAE85F32DU,
+        0x3C7A6A58U,0xD4DE3C5DU,0xE9F3DBE5U,0x01578DE0U,
+        0x7E0634E2U,0x96A262E7U,0xAB8F855FU,0x432BD35AU,
+        0xD1D44A2FU,0x39701C2AU,0x045DFB92U,0xECF9AD97U,
+        0x2563D4CFU,0xCDC782CAU,0xF0EA6572U,0x184E3377U,
+        0x8AB1AA02U,0x6215FC07U,0x5F381BBFU,0xB79C4DBAU,
+        0x733653BDU,0x9B9205B8U,0xA6BFE200U,0x4E1BB405U,
+        0xDCE42D70U,0x34407B75U,0x096D9CCDU,0xE1C9CAC8U,
+        0x2853B390U,0xC0F7E595U,0xFDDA022DU,0x157E5428U,
+        0x8781CD5DU,0x6F259B58U,0x52087CE0U,0xBAAC2AE5U,
+        0xC5FD93E7U,0x2D59C5E2U,0x1074225AU,0xF8D0745FU,
+        0x6A2FED2AU,0x828BBB2FU,0xBFA65C97U,0x57020A92U,
+        0x9E9873CAU,0x763C25CFU,0x4B11C277U,0xA3B59472U,
+        0x314A0D07U,0xD9EE5B02U,0xE4C3BCBAU,0x0C67EABFU,
+        0x1A60CEBEU,0xF2C498BBU,0xCFE97F03U,0x274D2906U,
+        0xB5B2B073U,0x5D16E676U,0x603B01CEU,0x889F57CBU,
+        0x41052E93U,0xA9A17896U,0x948C9F2EU,0x7C28C92BU,
+        0xEED7505EU,0x0673065BU,0x3B5EE1E3U,0xD3FAB7E6U,
+        0xACAB0EE4U,0x440F58E1U,0x7922BF59U,0x9186E95CU,
+        0x03797029U,0xEBDD262CU,0xD6F0C194U,0x3E549791U,
+        0xF7CEEEC9U,0x1F6AB8CCU,0x22475F74U,0xCAE30971U,
+        0x581C9004U,0xB0B8C601U,0x8D9521B9U,0x653177BCU
+    },
+    {
+        0x00000000U,0x47F7CEC1U,0x8FEF9D82U,0xC8185343U,
+        0x1B1E26B3U,0x5CE9E872U,0x94F1BB31U,0xD30675F0U,
+        0x363C4D66U,0x71CB83A7U,0xB9D3D0E4U,0xFE241E25U,
+        0x2D226BD5U,0x6AD5A514U,0xA2CDF657U,0xE53A3896U,
+        0x6C789ACCU,0x2B8F540DU,0xE397074EU,0xA460C98FU,
+        0x7766BC7FU,0x309172BEU,0xF88921FDU,0xBF7EEF3CU,
+        0x5A44D7AAU,0x1DB3196BU,0xD5AB4A28U,0x925C84E9U,
+        0x415AF119U,0x06AD3FD8U,0xCEB56C9BU,0x8942A25AU,
+        0xD8F13598U,0x9F06FB59U,0x571EA81AU,0x10E966DBU,
+        0xC3EF132BU,0x8418DDEAU,0x4C008EA9U,0x0BF74068U,
+        0xEECD78FEU,0xA93AB63FU,0x6122E57CU,0x26D52BBDU,
+        0xF5D35E4DU,0xB224908CU,0x7A3CC3CFU,0x3DCB0D0EU,
+        0xB489AF54U,0xF37E6195U,0x3B6632D6U,0x7C91FC17U,
+        0xAF9789E7U,0xE8604726U,0x20781465U,0x678FDAA4U,
+        0x82B5E232U,0xC5422CF3U,0x0D5A7FB0U,0x4AADB171U,
+        0x99ABC481U,0xDE5C0A40U,0x16445903U,0x51B397C2U,
+        0xB5237687U,0xF2D4B846U,0x3ACCEB05U,0x7D3B25C4U,
+        0xAE3D5034U,0xE9CA9EF5U,0x21D2CDB6U,0x66250377U,
+        0x831F3BE1U,0xC4E8F520U,0x0CF0A663U,0x4B0768A2U,
+        0x98011D52U,0xDFF6D393U,0x17EE80D0U,0x50194E11U,
+        0xD95BEC4BU,0x9EAC228AU,0x56B471C9U,0x1143BF08U,
+        0xC245CAF8U,0x85B20439U,0x4DAA577AU,0x0A5D99BBU,
+        0xEF67A12DU,0xA8906FECU,0x60883CAFU,0x277FF26EU,
+        0xF479879EU,0xB38E495FU,0x7B961A1CU,0x3C61D4DDU,
+        0x6DD2431FU,0x2A258DDEU,0xE23DDE9DU,0xA5CA105CU,
+        0x76CC65ACU,0x313BAB6DU,0xF923F82EU,0xBED436EFU,
+        0x5BEE0E79U,0x1C19C0B8U,0xD40193FBU,0x93F65D3AU,
+        0x40F028CAU,0x0707E60BU,0xCF1FB548U,0x88E87B89U,
+        0x01AAD9D3U,0x465D1712U,0x8E454451U,0xC9B28A90U,
+        0x1AB4FF60U,0x5D4331A1U,0x955B62E2U,0xD2ACAC23U,
+        0x379694B5U,0x70615A74U,0xB8790937U,0xFF8EC7F6U,
+        0x2C88B206U,0x6B7F7CC7U,0xA3672F84U,0xE490E145U,
+        0x6E87F0B9U,0x29703E78U,0xE1686D3BU,0xA69FA3FAU,
+        0x7599D60AU,0x326E18CBU,0xFA764B88U,0xBD818549U,
+        0x58BBBDDFU,0x1F4C731EU,0xD754205DU,0x90A3EE9CU,
+        0x43A59B6CU,0x045255ADU,0xCC4A06EEU,0x8BBDC82FU,
+        0x02FF6A75U,0x4508A4B4U,0x8D10F7F7U,0xCAE73936U,
+        0x19E14CC6U,0x5E168207U,0x960ED144U,0xD1F91F85U,
+        0x34C32713U,0x7334E9D2U,0xBB2CBA91U,0xFCDB7450U,
+        0x2FDD01A0U,0x682ACF61U,0xA0329C22U,0xE7C552E3U,
+        0xB676C521U,0xF1810BE0U,0x399958A3U,0x7E6E9662U,
+        0xAD68E392U,0xEA9F2D53U,0x22877E10U,0x6570B0D1U,
+        0x804A8847U,0xC7BD4686U,0x0FA515C5U,0x4852DB04U,
+        0x9B54AEF4U,0xDCA36035U,0x14BB3376U,0x534CFDB7U,
+        0xDA0E5FEDU,0x9DF9912CU,0x55E1C26FU,0x12160CAEU,
+        0xC110795EU,0x86E7B79FU,0x4EFFE4DCU,0x09082A1DU,
+        0xEC32128BU,0xABC5DC4AU,0x63DD8F09U,0x242A41C8U,
+        0xF72C3438U,0xB0DBFAF9U,0x78C3A9BAU,0x3F34677BU,
+        0xDBA4863EU,0x9C5348FFU,0x544B1BBCU,0x13BCD57DU,
+        0xC0BAA08DU,0x874D6E4CU,0x4F553D0FU,0x08A2F3CEU,
+        0xED98CB58U,0xAA6F0599U,0x627756DAU,0x2580981BU,
+        0xF686EDEBU,0xB171232AU,0x79697069U,0x3E9EBEA8U,
+        0xB7DC1CF2U,0xF02BD233U,0x38338170U,0x7FC44FB1U,
+        0xACC23A41U,0xEB35F480U,0x232DA7C3U,0x64DA6902U,
+        0x81E05194U,0xC6179F55U,0x0E0FCC16U,0x49F802D7U,
+        0x9AFE7727U,0xDD09B9E6U,0x1511EAA5U,0x52E62464U,
+        0x0355B3A6U,0x44A27D67U,0x8CBA2E24U,0xCB4DE0E5U,
+        0x184B9515U,0x5FBC5BD4U,0x97A40897U,0xD053C656U,
+        0x3569FEC0U,0x729E3001U,0xBA866342U,0xFD71AD83U,
+        0x2E77D873U,0x698016B2U,0xA19845F1U,0xE66F8B30U,
+        0x6F2D296AU,0x28DAE7ABU,0xE0C2B4E8U,0xA7357A29U,
+        0x74330FD9U,0x33C4C118U,0xFBDC925BU,0xBC2B5C9AU,
+        0x5911640CU,0x1EE6AACDU,0xD6FEF98EU,0x9109374FU,
+        0x420F42BFU,0x05F88C7EU,0xCDE0DF3DU,0x8A1711FCU
+    },
+    {
+        0x00000000U,0xDD0FE172U,0xBEDEDF53U,0x63D13E21U,
+        0x797CA311U,0xA4734263U,0xC7A27C42U,0x1AAD9D30U,
+        0xF2F94622U,0x2FF6A750U,0x4C279971U,0x91287803U,
+        0x8B85E533U,0x568A0441U,0x355B3A60U,0xE854DB12U,
+        0xE13391F3U,0x3C3C7081U,0x5FED4EA0U,0x82E2AFD2U,
+        0x984F32E2U,0x4540D390U,0x2691EDB1U,0xFB9E0CC3U,
+        0x13CAD7D1U,0xCEC536A3U,0xAD140882U,0x701BE9F0U,
+        0x6AB674C0U,0xB7B995B2U,0xD468AB93U,0x09674AE1U,
+        0xC6A63E51U,0x1BA9DF23U,0x7878E102U,0xA5770070U,
+        0xBFDA9D40U,0x62D57C32U,0x01044213U,0xDC0BA361U,
+        0x345F7873U,0xE9509901U,0x8A81A720U,0x578E4652U,
+        0x4D23DB62U,0x902C3A10U,0xF3FD0431U,0x2EF2E543U,
+        0x2795AFA2U,0xFA9A4ED0U,0x994B70F1U,0x44449183U,
+        0x5EE90CB3U,0x83E6EDC1U,0xE037D3E0U,0x3D383292U,
+        0xD56CE980U,0x086308F2U,0x6BB236D3U,0xB6BDD7A1U,
+        0xAC104A91U,0x711FABE3U,0x12CE95C2U,0xCFC174B0U,
+        0x898D6115U,0x54828067U,0x3753BE46U,0xEA5C5F34U,
+        0xF0F1C204U,0x2DFE2376U,0x4E2F1D57U,0x9320FC25U,
+        0x7B742737U,0xA67BC645U,0xC5AAF864U,0x18A51916U,
+        0x02088426U,0xDF076554U,0xBCD65B75U,0x61D9BA07U,
+        0x68BEF0E6U,0xB5B11194U,0xD6602FB5U,0x0B6FCEC7U,
+        0x11C253F7U,0xCCCDB285U,0xAF1C8CA4U,0x72136DD6U,
+        0x9A47B6C4U,0x474857B6U,0x24996997U,0xF99688E5U,
+        0xE33B15D5U,0x3E34F4A7U,0x5DE5CA86U,0x80EA2BF4U,
+        0x4F2B5F44U,0x9224BE36U,0xF1F58017U,0x2CFA6165U,
+        0x3657FC55U,0xEB581D27U,0x88892306U,0x5586C274U,
+        0xBDD21966U,0x60DDF814U,0x030CC635U,0xDE032747U,
+        0xC4AEBA77U,0x19A15B05U,0x7A706524U,0xA77F8456U,
+        0xAE18CEB7U,0x73172FC5U,0x10C611E4U,0xCDC9F096U,
+        0xD7646DA6U,0x0A6B8CD4U,0x69BAB2F5U,0xB4B55387U,
+        0x5CE18895U,0x81EE69E7U,0xE23F57C6U,0x3F30B6B4U,
+        0x259D2B84U,0xF892CAF6U,0x9B43F4D7U,0x464C15A5U,
+        0x17DBDF9DU,0xCAD43EEFU,0xA90500CEU,0x740AE1BCU,
+        0x6EA77C8CU,0xB3A89DFEU,0xD079A3DFU,0x0D7642ADU,
+        0xE52299BFU,0x382D78CDU,0x5BFC46ECU,0x86F3A79EU,
+        0x9C5E3AAEU,0x4151DBDCU,0x2280E5FDU,0xFF8F048FU,
+        0xF6E84E6EU,0x2BE7AF1CU,0x4836913DU,0x9539704FU,
+        0x8F94ED7FU,0x529B0C0DU,0x314A322CU,0xEC45D35EU,
+        0x0411084CU,0xD91EE93EU,0xBACFD71FU,0x67C0366DU,
+        0x7D6DAB5DU,0xA0624A2FU,0xC3B3740EU,0x1EBC957CU,
+        0xD17DE1CCU,0x0C7200BEU,0x6FA33E9FU,0xB2ACDFEDU,
+        0xA80142DDU,0x750EA3AFU,0x16DF9D8EU,0xCBD07CFCU,
+        0x2384A7EEU,0xFE8B469CU,0x9D5A78BDU,0x405599CFU,
+        0x5AF804FFU,0x87F7E58DU,0xE426DBACU,0x39293ADEU,
+        0x304E703FU,0xED41914DU,0x8E90AF6CU,0x539F4E1EU,
+        0x4932D32EU,0x943D325CU,0xF7EC0C7DU,0x2AE3ED0FU,
+        0xC2B7361DU,0x1FB8D76FU,0x7C69E94EU,0xA166083CU,
+        0xBBCB950CU,0x66C4747EU,0x05154A5FU,0xD81AAB2DU,
+        0x9E56BE88U,0x43595FFAU,0x208861DBU,0xFD8780A9U,
+        0xE72A1D99U,0x3A25FCEBU,0x59F4C2CAU,0x84FB23B8U,
+        0x6CAFF8AAU,0xB1A019D8U,0xD27127F9U,0x0F7EC68BU,
+        0x15D35BBBU,0xC8DCBAC9U,0xAB0D84E8U,0x7602659AU,
+        0x7F652F7BU,0xA26ACE09U,0xC1BBF028U,0x1CB4115AU,
+        0x06198C6AU,0xDB166D18U,0xB8C75339U,0x65C8B24BU,
+        0x8D9C6959U,0x5093882BU,0x3342B60AU,0xEE4D5778U,
+        0xF4E0CA48U,0x29EF2B3AU,0x4A3E151BU,0x9731F469U,
+        0x58F080D9U,0x85FF61ABU,0xE62E5F8AU,0x3B21BEF8U,
+        0x218C23C8U,0xFC83C2BAU,0x9F52FC9BU,0x425D1DE9U,
+        0xAA09C6FBU,0x77062789U,0x14D719A8U,0xC9D8F8DAU,
+        0xD37565EAU,0x0E7A8498U,0x6DABBAB9U,0xB0A45BCBU,
+        0xB9C3112AU,0x64CCF058U,0x071DCE79U,0xDA122F0BU,
+        0xC0BFB23BU,0x1DB05349U,0x7E616D68U,0xA36E8C1AU,
+        0x4B3A5708U,0x9635B67AU,0xF5E4885BU,0x28EB6929U,
+        0x3246F419U,0xEF49156BU,0x8C982B4AU,0x5197CA38U
+    },
+    {
+        0x00000000U,0x2FB7BF3AU,0x5F6F7E74U,0x70D8C14EU,
+        0xBEDEFCE8U,0x916943D2U,0xE1B1829CU,0xCE063DA6U,
+        0x797CE467U,0x56CB5B5DU,0x26139A13U,0x09A42529U,
+        0xC7A2188FU,0xE815A7B5U,0x98CD66FBU,0xB77AD9C1U,
+        0xF2F9C8CEU,0xDD4E77F4U,0xAD96B6BAU,0x82210980U,
+        0x4C273426U,0x63908B1CU,0x13484A52U,0x3CFFF568U,
+        0x8B852CA9U,0xA4329393U,0xD4EA52DDU,0xFB5DEDE7U,
+        0x355BD041U,0x1AEC6F7BU,0x6A34AE35U,0x4583110FU,
+        0xE1328C2BU,0xCE853311U,0xBE5DF25FU,0x91EA4D65U,
+        0x5FEC70C3U,0x705BCFF9U,0x00830EB7U,0x2F34B18DU,
+        0x984E684CU,0xB7F9D776U,0xC7211638U,0xE896A902U,
+        0x269094A4U,0x09272B9EU,0x79FFEAD0U,0x564855EAU,
+        0x13CB44E5U,0x3C7CFBDFU,0x4CA43A91U,0x631385ABU,
+        0xAD15B80DU,0x82A20737U,0xF27AC679U,0xDDCD7943U,
+        0x6AB7A082U,0x45001FB8U,0x35D8DEF6U,0x1A6F61CCU,
+        0xD4695C6AU,0xFBDEE350U,0x8B06221EU,0xA4B19D24U,
+        0xC6A405E1U,0xE913BADBU,0x99CB7B95U,0xB67CC4AFU,
+        0x787AF909U,0x57CD4633U,0x2715877DU,0x08A23847U,
+        0xBFD8E186U,0x906F5EBCU,0xE0B79FF2U,0xCF0020C8U,
+        0x01061D6EU,0x2EB1A254U,0x5E69631AU,0x71DEDC20U,
+        0x345DCD2FU,0x1BEA7215U,0x6B32B35BU,0x44850C61U,
+        0x8A8331C7U,0xA5348EFDU,0xD5EC4FB3U,0xFA5BF089U,
+        0x4D212948U,0x62969672U,0x124E573CU,0x3DF9E806U,
+        0xF3FFD5A0U,0xDC486A9AU,0xAC90ABD4U,0x832714EEU,
+        0x279689CAU,0x082136F0U,0x78F9F7BEU,0x574E4884U,
+        0x99487522U,0xB6FFCA18U,0xC6270B56U,0xE990B46CU,
+        0x5EEA6DADU,0x715DD297U,0x018513D9U,0x2E32ACE3U,
+        0xE0349145U,0xCF832E7FU,0xBF5BEF31U,0x90EC500BU,
+        0xD56F4104U,0xFAD8FE3EU,0x8A003F70U,0xA5B7804AU,
+        0x6BB1BDECU,0x440602D6U,0x34DEC398U,0x1B697CA2U,
+        0xAC13A563U,0x83A41A59U,0xF37CDB17U,0xDCCB642DU,
+        0x12CD598BU,0x3D7AE6B1U,0x4DA227FFU,0x621598C5U,
+        0x89891675U,0xA63EA94FU,0xD6E66801U,0xF951D73BU,
+        0x3757EA9DU,0x18E055A7U,0x683894E9U,0x478F2BD3U,
+        0xF0F5F212U,0xDF424D28U,0xAF9A8C66U,0x802D335CU,
+        0x4E2B0EFAU,0x619CB1C0U,0x1144708EU,0x3EF3CFB4U,
+        0x7B70DEBBU,0x54C76181U,0x241FA0CFU,0x0BA81FF5U,
+        0xC5AE2253U,0xEA199D69U,0x9AC15C27U,0xB576E31DU,
+        0x020C3ADCU,0x2DBB85E6U,0x5D6344A8U,0x72D4FB92U,
+        0xBCD2C634U,0x9365790EU,0xE3BDB840U,0xCC0A077AU,
+        0x68BB9A5EU,0x470C2564U,0x37D4E42AU,0x18635B10U,
+        0xD66566B6U,0xF9D2D98CU,0x890A18C2U,0xA6BDA7F8U,
+        0x11C77E39U,0x3E70C103U,0x4EA8004DU,0x611FBF77U,
+        0xAF1982D1U,0x80AE3DEBU,0xF076FCA5U,0xDFC1439FU,
+        0x9A425290U,0xB5F5EDAAU,0xC52D2CE4U,0xEA9A93DEU,
+        0x249CAE78U,0x0B2B1142U,0x7BF3D00CU,0x54446F36U,
+        0xE33EB6F7U,0xCC8909CDU,0xBC51C883U,0x93E677B9U,
+        0x5DE04A1FU,0x7257F525U,0x028F346BU,0x2D388B51U,
+        0x4F2D1394U,0x609AACAEU,0x10426DE0U,0x3FF5D2DAU,
+        0xF1F3EF7CU,0xDE445046U,0xAE9C9108U,0x812B2E32U,
+        0x3651F7F3U,0x19E648C9U,0x693E8987U,0x468936BDU,
+        0x888F0B1BU,0xA738B421U,0xD7E0756FU,0xF857CA55U,
+        0xBDD4DB5AU,0x92636460U,0xE2BBA52EU,0xCD0C1A14U,
+        0x030A27B2U,0x2CBD9888U,0x5C6559C6U,0x73D2E6FCU,
+        0xC4A83F3DU,0xEB1F8007U,0x9BC74149U,0xB470FE73U,
+        0x7A76C3D5U,0x55C17CEFU,0x2519BDA1U,0x0AAE029BU,
+        0xAE1F9FBFU,0x81A82085U,0xF170E1CBU,0xDEC75EF1U,
+        0x10C16357U,0x3F76DC6DU,0x4FAE1D23U,0x6019A219U,
+        0xD7637BD8U,0xF8D4C4E2U,0x880C05ACU,0xA7BBBA96U,
+        0x69BD8730U,0x460A380AU,0x36D2F944U,0x1965467EU,
+        0x5CE65771U,0x7351E84BU,0x03892905U,0x2C3E963FU,
+        0xE238AB99U,0xCD8F14A3U,0xBD57D5EDU,0x92E06AD7U,
+        0x259AB316U,0x0A2D0C2CU,0x7AF5CD62U,0x55427258U,
+        0x9B444FFEU,0xB4F3F0C4U,0xC42B318AU,0xEB9C8EB0U
+    }
+};
+
+
+/** x^(2^k) modulo the CRC32 polynomial for k = 0..63; Used to advance a CRC32 over runs of zero bytes */
+const uint32_t crc32_x2n_table[64] = {
+    0x00000002U,0x00000004U,0x00000010U,0x00000100U,
+    0x00010000U,0x04C11DB7U,0x490D678DU,0xE8A45605U,
+    0x75BE46B7U,0xE6228B11U,0x567FDDEBU,0x88FE2237U,
+    0x0E857E71U,0x7001E426U,0x075DE2B2U,0xF12A7F90U,
+    0xF0B4A1C1U,0x58F46C0CU,0xC3395ADEU,0x96837F8CU,
+    0x544037F9U,0x23B7B136U,0xB2E16BA8U,0x725E7BFAU,
+    0xEC709B5DU,0xF77A7274U,0x2845D572U,0x034E2515U,
+    0x79695942U,0x540CB128U,0x0B65D023U,0x3C344723U,
+    0x00000002U,0x00000004U,0x00000010U,0x00000100U,
+    0x00010000U,0x04C11DB7U,0x490D678DU,0xE8A45605U,
+    0x75BE46B7U,0xE6228B11U,0x567FDDEBU,0x88FE2237U,
+    0x0E857E71U,0x7001E426U,0x075DE2B2U,0xF12A7F90U,
+    0xF0B4A1C1U,0x58F46C0CU,0xC3395ADEU,0x96837F8CU,
+    0x544037F9U,0x23B7B136U,0xB2E16BA8U,0x725E7BFAU,
+    0xEC709B5DU,0xF77A7274U,0x2845D572U,0x034E2515U,
+    0x79695942U,0x540CB128U,0x0B65D023U,0x3C344723U
+};
+
+
+/** Slicing-by-8 tables for CRC32C (Castagnoli, reflected polynomial 0x82F63B78): Row `k` holds the CRC32C of each byte followed by `k` zero bytes */
+const uint32_t crc32c_table[8][256] = {
+    {
+        0x00000000U,0xF26B8303U,0xE13B70F7U,0x1350F3F4U,
+        0xC79A971FU,0x35F1141CU,0x26A1E7E8U,0xD4CA64EBU,
+        0x8AD958CFU,0x78B2DBCCU,0x6BE22838U,0x9989AB3BU,
+        0x4D43CFD0U,0xBF284CD3U,0xAC78BF27U,0x5E133C24U,
+        0x105EC76FU,0xE235446CU,0xF165B798U,0x030E349BU,
+        0xD7C45070U,0x25AFD373U,0x36FF2087U,0xC494A384U,
+        0x9A879FA0U,0x68EC1CA3U,0x7BBCEF57U,0x89D76C54U,
+        0x5D1D08BFU,0xAF768BBCU,0xBC267848U,0x4E4DFB4BU,
+        0x20BD8EDEU,0xD2D60DDDU,0xC186FE29U,0x33ED7D2AU,
+        0xE72719C1U,0x154C9AC2U,0x061C6936U,0xF477EA35U,
+        0xAA64D611U,0x580F5512U,0x4B5FA6E6U,0xB93425E5U,
+        0x6DFE410EU,0x9F95C20DU,0x8CC531F9U,0x7EAEB2FAU,
+        0x30E349B1U,0xC288CAB2U,0xD1D83946U,0x23B3BA45U,
+        0xF779DEAEU,0x05125DADU,0x1642AE59U,0xE4292D5AU,
+        0xBA3A117EU,0x4851927DU,0x5B016189U,0xA96AE28AU,
+        0x7DA08661U,0x8FCB0562U,0x9C9BF696U,0x6EF07595U,
+        0x417B1DBCU,0xB3109EBFU,0xA0406D4BU,0x522BEE48U,
+        0x86E18AA3U,0x748A09A0U,0x67DAFA54U,0x95B17957U,
+        0xCBA24573U,0x39C9C670U,0x2A993584U,0xD8F2B687U,
+        0x0C38D26CU,0xFE53516FU,0xED03A29BU,0x1F682198U,
+        0x5125DAD3U,0xA34E59D0U,0xB01EAA24U,0x42752927U,
+        0x96BF4DCCU,0x64D4CECFU,0x77843D3BU,0x85EFBE38U,
+        0xDBFC821CU,0x2997011FU,0x3AC7F2EBU,0xC8AC71E8U,
+        0x1C661503U,0xEE0D9600U,0xFD5D65F4U,0x0F36E6F7U,
+        0x61C69362U,0x93AD1061U,0x80FDE395U,0x72966096U,
+        0xA65C047DU,0x5437877EU,0x4767748AU,0xB50CF789U,
+        0xEB1FCBADU,0x197448AEU,0x0A24BB5AU,0xF84F3859U,
+        0x2C855CB2U,0xDEEEDFB1U,0xCDBE2C45U,0x3FD5AF46U,
+        0x7198540DU,0x83F3D70EU,0x90A324FAU,0x62C8A7F9U,
+        0xB602C312U,0x44694011U,0x5739B3E5U,0xA55230E6U,
+        0xFB410CC2U,0x092A8FC1U,0x1A7A7C35U,0xE811FF36U,
+        0x3CDB9BDDU,0xCEB018DEU,0xDDE0EB2AU,0x2F8B6829U,
+        0x82F63B78U,0x709DB87BU,0x63CD4B8FU,0x91A6C88CU,
+        0x456CAC67U,0xB7072F64U,0xA457DC90U,0x563C5F93U,
+        0x082F63B7U,0xFA44E0B4U,0xE9141340U,0x1B7F9043U,
+        0xCFB5F4A8U,0x3DDE77ABU,0x2E8E845FU,0xDCE5075CU,
+        0x92A8FC17U,0x60C37F14U,0x73938CE0U,0x81F80FE3U,
+        0x55326B08U,0xA759E80BU,0xB4091BFFU,0x466298FCU,
+        0x1871A4D8U,0xEA1A27DBU,0xF94AD42FU,0x0B21572CU,
+        0xDFEB33C7U,0x2D80B0C4U,0x3ED04330U,0xCCBBC033U,
+        0xA24BB5A6U,0x502036A5U,0x4370C551U,0xB11B4652U,
+        0x65D122B9U,0x97BAA1BAU,0x84EA524EU,0x7681D14DU,
+        0x2892ED69U,0xDAF96E6AU,0xC9A99D9EU,0x3BC21E9DU,
+        0xEF087A76U,0x1D63F975U,0x0E330A81U,0xFC588982U,
+        0xB21572C9U,0x407EF1CAU,0x532E023EU,0xA145813DU,
+        0x758FE5D6U,0x87E466D5U,0x94B49521U,0x66DF1622U,
+        0x38CC2A06U,0xCAA7A905U,0xD9F75AF1U,0x2B9CD9F2U,
+        0xFF56BD19U,0x0D3D3E1AU,0x1E6DCDEEU,0xEC064EEDU,
+        0xC38D26C4U,0x31E6A5C7U,0x22B65633U,0xD0DDD530U,
+        0x0417B1DBU,0xF67C32D8U,0xE52CC12CU,0x1747422FU,
+        0x49547E0BU,0xBB3FFD08U,0xA86F0EFCU,0x5A048DFFU,
+        0x8ECEE914U,0x7CA56A17U,0x6FF599E3U,0x9D9E1AE0U,
+        0xD3D3E1ABU,0x21B862A8U,0x32E8915CU,0xC083125FU,
+        0x144976B4U,0xE622F5B7U,0xF5720643U,0x07198540U,
+        0x590AB964U,0xAB613A67U,0xB831C993U,0x4A5A4A90U,
+        0x9E902E7BU,0x6CFBAD78U,0x7FAB5E8CU,0x8DC0DD8FU,
+        0xE330A81AU,0x115B2B19U,0x020BD8EDU,0xF0605BEEU,
+        0x24AA3F05U,0xD6C1BC06U,0xC5914FF2U,0x37FACCF1U,
+        0x69E9F0D5U,0x9B8273D6U,0x88D28022U,0x7AB90321U,
+        0xAE7367CAU,0x5C18E4C9U,0x4F48173DU,0xBD23943EU,
+        0xF36E6F75U,0x0105EC76U,0x12551F82U,0xE03E9C81U,
+        0x34F4F86AU,0xC69F7B69U,0xD5CF889DU,0x27A40B9EU,
+        0x79B737BAU,0x8BDCB4B9U,0x988C474DU,0x6AE7C44EU,
+        0xBE2DA0A5U,0x4C4623A6U,0x5F16D052U,0xAD7D5351U
+    },
+    {
+        0x00000000U,0x13A29877U,0x274530EEU,0x34E7A899U,
+        0x4E8A61DCU,0x5D28F9ABU,0x69CF5132U,0x7A6DC945U,
+        0x9D14C3B8U,0x8EB65BCFU,0xBA51F356U,0xA9F36B21U,
+        0xD39EA264U,0xC03C3A13U,0xF4DB928AU,0xE7790AFDU,
+        0x3FC5F181U,0x2C6769F6U,0x1880C16FU,0x0B225918U,
+        0x714F905DU,0x62ED082AU,0x560AA0B3U,0x45A838C4U,
+        0xA2D13239U,0xB173AA4EU,0x859402D7U,0x96369AA0U,
+        0xEC5B53E5U,0xFFF9CB92U,0xCB1E630BU,0xD8BCFB7CU,
+        0x7F8BE302U,0x6C297B75U,0x58CED3ECU,0x4B6C4B9BU,
+        0x310182DEU,0x22A31AA9U,0x1644B230U,0x05E62A47U,
+        0xE29F20BAU,0xF13DB8CDU,0xC5DA1054U,0xD6788823U,
+        0xAC154166U,0xBFB7D911U,0x8B507188U,0x98F2E9FFU,
+        0x404E1283U,0x53EC8AF4U,0x670B226DU,0x74A9BA1AU,
+        0x0EC4735FU,0x1D66EB28U,0x298143B1U,0x3A23DBC6U,
+        0xDD5AD13BU,0xCEF8494CU,0xFA1FE1D5U,0xE9BD79A2U,
+        0x93D0B0E7U,0x80722890U,0xB4958009U,0xA737187EU,
+        0xFF17C604U,0xECB55E73U,0xD852F6EAU,0xCBF06E9DU,
+        0xB19DA7D8U,0xA23F3FAFU,0x96D89736U,0x857A0F41U,
+        0x620305BCU,0x71A19DCBU,0x45463552U,0x56E4AD25U,
+        0x2C896460U,0x3F2BFC17U,0x0BCC548EU,0x186ECCF9U,
+        0xC0D23785U,0xD370AFF2U,0xE797076BU,0xF4359F1CU,
+        0x8E585659U,0x9DFACE2EU,0xA91D66B7U,0xBABFFEC0U,
+        0x5DC6F43DU,0x4E646C4AU,0x7A83C4D3U,0x69215CA4U,
+        0x134C95E1U,0x00EE0D96U,0x3409A50FU,0x27AB3D78U,
+        0x809C2506U,0x933EBD71U,0xA7D915E8U,0xB47B8D9FU,
+        0xCE1644DAU,0xDDB4DCADU,0xE9537434U,0xFAF1EC43U,
+        0x1D88E6BEU,0x0E2A7EC9U,0x3ACDD650U,0x296F4E27U,
+        0x53028762U,0x40A01F15U,0x7447B78CU,0x67E52FFBU,
+        0xBF59D487U,0xACFB4CF0U,0x981CE469U,0x8BBE7C1EU,
+        0xF1D3B55BU,0xE2712D2CU,0xD69685B5U,0xC5341DC2U,
+        0x224D173FU,0x31EF8F48U,0x050827D1U,0x16AABFA6U,
+        0x6CC776E3U,0x7F65EE94U,0x4B82460DU,0x5820DE7AU,
+        0xFBC3FAF9U,0xE861628EU,0xDC86CA17U,0xCF245260U,
+        0xB5499B25U,0xA6EB0352U,0x920CABCBU,0x81AE33BCU,
+        0x66D73941U,0x7575A136U,0x419209AFU,0x523091D8U,
+        0x285D589DU,0x3BFFC0EAU,0x0F186873U,0x1CBAF004U,
+        0xC4060B78U,0xD7A4930FU,0xE3433B96U,0xF0E1A3E1U,
+        0x8A8C6AA4U,0x992EF2D3U,0xADC95A4AU,0xBE6BC23DU,
+        0x5912C8C0U,0x4AB050B7U,0x7E57F82EU,0x6DF56059U,
+        0x1798A91CU,0x043A316BU,0x30DD99F2U,0x237F0185U,
+        0x844819FBU,0x97EA818CU,0xA30D2915U,0xB0AFB162U,
+        0xCAC27827U,0xD960E050U,0xED8748C9U,0xFE25D0BEU,
+        0x195CDA43U,0x0AFE4234U,0x3E19EAADU,0x2DBB72DAU,
+        0x57D6BB9FU,0x447423E8U,0x70938B71U,0x63311306U,
+        0xBB8DE87AU,0xA82F700DU,0x9CC8D894U,0x8F6A40E3U,
+        0xF50789A6U,0xE6A511D1U,0xD242B948U,0xC1E0213FU,
+        0x26992BC2U,0x353BB3B5U,0x01DC1B2CU,0x127E835BU,
+        0x68134A1EU,0x7BB1D269U,0x4F567AF0U,0x5CF4E287U,
+        0x04D43CFDU,0x1776A48AU,0x23910C13U,0x30339464U,
+        0x4A5E5D21U,0x59FCC556U,0x6D1B6DCFU,0x7EB9F5B8U,
+        0x99C0FF45U,0x8A626732U,0xBE85CFABU,0xAD2757DCU,
+        0xD74A9E99U,0xC4E806EEU,0xF00FAE77U,0xE3AD3600U,
+        0x3B11CD7CU,0x28B3550BU,0x1C54FD92U,0x0FF665E5U,
+        0x759BACA0U,0x663934D7U,0x52DE9C4EU,0x417C0439U,
+        0xA6050EC4U,0xB5A796B3U,0x81403E2AU,0x92E2A65DU,
+        0xE88F6F18U,0xFB2DF76FU,0xCFCA5FF6U,0xDC68C781U,
+        0x7B5FDFFFU,0x68FD4788U,0x5C1AEF11U,0x4FB87766U,
+        0x35D5BE23U,0x26772654U,0x12908ECDU,0x013216BAU,
+        0xE64B1C47U,0xF5E98430U,0xC10E2CA9U,0xD2ACB4DEU,
+        0xA8C17D9BU,0xBB63E5ECU,0x8F844D75U,0x9C26D502U,
+        0x449A2E7EU,0x5738B609U,0x63DF1E90U,0x707D86E7U,
+        0x0A104FA2U,0x19B2D7D5U,0x2D557F4CU,0x3EF7E73BU,
+        0xD98EEDC6U,0xCA2C75B1U,0xFECBDD28U,0xED69455FU,
+        0x97048C1AU,0x84A6146DU,0xB041BCF4U,0xA3E32483U
+    },
+    {
+        0x00000000U,0xA541927EU,0x4F6F520DU,0xEA2EC073U,
+        0x9EDEA41AU,0x3B9F3664U,0xD1B1F617U,0x74F06469U,
+        0x38513EC5U,0x9D10ACBBU,0x773E6CC8U,0xD27FFEB6U,
+        0xA68F9ADFU,0x03CE08A1U,0xE9E0C8D2U,0x4CA15AACU,
+        0x70A27D8AU,0xD5E3EFF4U,0x3FCD2F87U,0x9A8CBDF9U,
+        0xEE7CD990U,0x4B3D4BEEU,0xA1138B9DU,0x045219E3U,
+        0x48F3434FU,0xEDB2D131U,0x079C1142U,0xA2DD833CU,
+        0xD62DE755U,0x736C752BU,0x9942B558U,0x3C032726U,
+        0xE144FB14U,0x4405696AU,0xAE2BA919U,0x0B6A3B67U,
+        0x7F9A5F0EU,0xDADBCD70U,0x30F50D03U,0x95B49F7DU,
+        0xD915C5D1U,0x7C5457AFU,0x967A97DCU,0x333B05A2U,
+        0x47CB61CBU,0xE28AF3B5U,0x08A433C6U,0xADE5A1B8U,
+        0x91E6869EU,0x34A714E0U,0xDE89D493U,0x7BC846EDU,
+        0x0F382284U,0xAA79B0FAU,0x40577089U,0xE516E2F7U,
+        0xA9B7B85BU,0x0CF62A25U,0xE6D8EA56U,0x43997828U,
+        0x37691C41U,0x92288E3FU,0x78064E4CU,0xDD47DC32U,
+        0xC76580D9U,0x622412A7U,0x880AD2D4U,0x2D4B40AAU,
+        0x59BB24C3U,0xFCFAB6BDU,0x16D476CEU,0xB395E4B0U,
+        0xFF34BE1CU,0x5A752C62U,0xB05BEC11U,0x151A7E6FU,
+        0x61EA1A06U,0xC4AB8878U,0x2E85480BU,0x8BC4DA75U,
+        0xB7C7FD53U,0x12866F2DU,0xF8A8AF5EU,0x5DE93D20U,
+        0x29195949U,0x8C58CB37U,0x66760B44U,0xC337993AU,
+        0x8F96C396U,0x2AD751E8U,0xC0F9919BU,0x65B803E5U,
+        0x1148678CU,0xB409F5F2U,0x5E273581U,0xFB66A7FFU,
+        0x26217BCDU,0x8360E9B3U,0x694E29C0U,0xCC0FBBBEU,
+        0xB8FFDFD7U,0x1DBE4DA9U,0xF7908DDAU,0x52D11FA4U,
+        0x1E704508U,0xBB31D776U,0x511F1705U,0xF45E857BU,
+        0x80AEE112U,0x25EF736CU,0xCFC1B31FU,0x6A802161U,
+        0x56830647U,0xF3C29439U,0x19EC544AU,0xBCADC634U,
+        0xC85DA25DU,0x6D1C3023U,0x8732F050U,0x2273622EU,
+        0x6ED23882U,0xCB93AAFCU,0x21BD6A8FU,0x84FCF8F1U,
+        0xF00C9C98U,0x554D0EE6U,0xBF63CE95U,0x1A225CEBU,
+        0x8B277743U,0x2E66E53DU,0xC448254EU,0x6109B730U,
+        0x15F9D359U,0xB0B84127U,0x5A968154U,0xFFD7132AU,
+        0xB3764986U,0x1637DBF8U,0xFC191B8BU,0x595889F5U,
+        0x2DA8ED9CU,0x88E97FE2U,0x62C7BF91U,0xC7862DEFU,
+        0xFB850AC9U,0x5EC498B7U,0xB4EA58C4U,0x11ABCABAU,
+        0x655BAED3U,0xC01A3CADU,0x2A34FCDEU,0x8F756EA0U,
+        0xC3D4340CU,0x6695A672U,0x8CBB6601U,0x29FAF47FU,
+        0x5D0A9016U,0xF84B0268U,0x1265C21BU,0xB7245065U,
+        0x6A638C57U,0xCF221E29U,0x250CDE5AU,0x804D4C24U,
+        0xF4BD284DU,0x51FCBA33U,0xBBD27A40U,0x1E93E83EU,
+        0x5232B292U,0xF77320ECU,0x1D5DE09FU,0xB81C72E1U,
+        0xCCEC1688U,0x69AD84F6U,0x83834485U,0x26C2D6FBU,
+        0x1AC1F1DDU,0xBF8063A3U,0x55AEA3D0U,0xF0EF31AEU,
+        0x841F55C7U,0x215EC7B9U,0xCB7007CAU,0x6E3195B4U,
+        0x2290CF18U,0x87D15D66U,0x6DFF9D15U,0xC8BE0F6BU,
+        0xBC4E6B02U,0x190FF97CU,0xF321390FU,0x5660AB71U,
+        0x4C42F79AU,0xE90365E4U,0x032DA597U,0xA66C37E9U,
+        0xD29C5380U,0x77DDC1FEU,0x9DF3018DU,0x38B293F3U,
+        0x7413C95FU,0xD1525B21U,0x3B7C9B52U,0x9E3D092CU,
+        0xEACD6D45U,0x4F8CFF3BU,0xA5A23F48U,0x00E3AD36U,
+        0x3CE08A10U,0x99A1186EU,0x738FD81DU,0xD6CE4A63U,
+        0xA23E2E0AU,0x077FBC74U,0xED517C07U,0x4810EE79U,
+        0x04B1B4D5U,0xA1F026ABU,0x4BDEE6D8U,0xEE9F74A6U,
+        0x9A6F10CFU,0x3F2E82B1U,0xD50042C2U,0x7041D0BCU,
+        0xAD060C8EU,0x08479EF0U,0xE2695E83U,0x4728CCFDU,
+        0x33D8A894U,0x96993AEAU,0x7CB7FA99U,0xD9F668E7U,
+        0x9557324BU,0x3016A035U,0xDA386046U,0x7F79F238U,
+        0x0B899651U,0xAEC8042FU,0x44E6C45CU,0xE1A75622U,
+        0xDDA47104U,0x78E5E37AU,0x92CB2309U,0x378AB177U,
+        0x437AD51EU,0xE63B4760U,0x0C158713U,0xA954156DU,
+        0xE5F54FC1U,0x40B4DDBFU,0xAA9A1DCCU,0x0FDB8FB2U,
+        0x7B2BEBDBU,0xDE6A79A5U,0x3444B9D6U,0x91052BA8U
+    },
+    {
+        0x00000000U,0xDD45AAB8U,0xBF672381U,0x62228939U,
+        0x7B2231F3U,0xA6679B4BU,0xC4451272U,0x1900B8CAU,
+        0xF64463E6U,0x2B01C95EU,0x49234067U,0x9466EADFU,
+        0x8D665215U,0x5023F8ADU,0x32017194U,0xEF44DB2CU,
+        0xE964B13DU,0x34211B85U,0x560392BCU,0x8B463804U,
+        0x924680CEU,0x4F032A76U,0x2D21A34FU,0xF06409F7U,
+        0x1F20D2DBU,0xC2657863U,0xA047F15AU,0x7D025BE2U,
+        0x6402E328U,0xB9474990U,0xDB65C0A9U,0x06206A11U,
+        0xD725148BU,0x0A60BE33U,0x6842370AU,0xB5079DB2U,
+        0xAC072578U,0x71428FC0U,0x136006F9U,0xCE25AC41U,
+        0x2161776DU,0xFC24DDD5U,0x9E0654ECU,0x4343FE54U,
+        0x5A43469EU,0x8706EC26U,0xE524651FU,0x3861CFA7U,
+        0x3E41A5B6U,0xE3040F0EU,0x81268637U,0x5C632C8FU,
+        0x45639445U,0x98263EFDU,0xFA04B7C4U,0x27411D7CU,
+        0xC805C650U,0x15406CE8U,0x7762E5D1U,0xAA274F69U,
+        0xB327F7A3U,0x6E625D1BU,0x0C40D422U,0xD1057E9AU,
+        0xABA65FE7U,0x76E3F55FU,0x14C17C66U,0xC984D6DEU,
+        0xD0846E14U,0x0DC1C4ACU,0x6FE34D95U,0xB2A6E72DU,
+        0x5DE23C01U,0x80A796B9U,0xE2851F80U,0x3FC0B538U,
+        0x26C00DF2U,0xFB85A74AU,0x99A72E73U,0x44E284CBU,
+        0x42C2EEDAU,0x9F874462U,0xFDA5CD5BU,0x20E067E3U,
+        0x39E0DF29U,0xE4A57591U,0x8687FCA8U,0x5BC25610U,
+        0xB4868D3CU,0x69C32784U,0x0BE1AEBDU,0xD6A40405U,
+        0xCFA4BCCFU,0x12E11677U,0x70C39F4EU,0xAD8635F6U,
+        0x7C834B6CU,0xA1C6E1D4U,0xC3E468EDU,0x1EA1C255U,
+        0x07A17A9FU,0xDAE4D027U,0xB8C6591EU,0x6583F3A6U,
+        0x8AC7288AU,0x57828232U,0x35A00B0BU,0xE8E5A1B3U,
+        0xF1E51979U,0x2CA0B3C1U,0x4E823AF8U,0x93C79040U,
+        0x95E7FA51U,0x48A250E9U,0x2A80D9D0U,0xF7C57368U,
+        0xEEC5CBA2U,0x3380611AU,0x51A2E823U,0x8CE7429BU,
+        0x63A399B7U,0xBEE6330FU,0xDCC4BA36U,0x0181108EU,
+        0x1881A844U,0xC5C402FCU,0xA7E68BC5U,0x7AA3217DU,
+        0x52A0C93FU,0x8FE56387U,0xEDC7EABEU,0x30824006U,
+        0x2982F8CCU,0xF4C75274U,0x96E5DB4DU,0x4BA071F5U,
+        0xA4E4AAD9U,0x79A10061U,0x1B838958U,0xC6C623E0U,
+        0xDFC69B2AU,0x02833192U,0x60A1B8ABU,0xBDE41213U,
+        0xBBC47802U,0x6681D2BAU,0x04A35B83U,0xD9E6F13BU,
+        0xC0E649F1U,0x1DA3E349U,0x7F816A70U,0xA2C4C0C8U,
+        0x4D801BE4U,0x90C5B15CU,0xF2E73865U,0x2FA292DDU,
+        0x36A22A17U,0xEBE780AFU,0x89C50996U,0x5480A32EU,
+        0x8585DDB4U,0x58C0770CU,0x3AE2FE35U,0xE7A7548DU,
+        0xFEA7EC47U,0x23E246FFU,0x41C0CFC6U,0x9C85657EU,
+        0x73C1BE52U,0xAE8414EAU,0xCCA69DD3U,0x11E3376BU,
+        0x08E38FA1U,0xD5A62519U,0xB784AC20U,0x6AC10698U,
+        0x6CE16C89U,0xB1A4C631U,0xD3864F08U,0x0EC3E5B0U,
+        0x17C35D7AU,0xCA86F7C2U,0xA8A47EFBU,0x75E1D443U,
+        0x9AA50F6FU,0x47E0A5D7U,0x25C22CEEU,0xF8878656U,
+        0xE1873E9CU,0x3CC29424U,0x5EE01D1DU,0x83A5B7A5U,
+        0xF90696D8U,0x24433C60U,0x4661B559U,0x9B241FE1U,
+        0x8224A72BU,0x5F610D93U,0x3D4384AAU,0xE0062E12U,
+        0x0F42F53EU,0xD2075F86U,0xB025D6BFU,0x6D607C07U,
+        0x7460C4CDU,0xA9256E75U,0xCB07E74CU,0x16424DF4U,
+        0x106227E5U,0xCD278D5DU,0xAF050464U,0x7240AEDCU,
+        0x6B401616U,0xB605BCAEU,0xD4273597U,0x09629F2FU,
+        0xE6264403U,0x3B63EEBBU,0x59416782U,0x8404CD3AU,
+        0x9D0475F0U,0x4041DF48U,0x22635671U,0xFF26FCC9U,
+        0x2E238253U,0xF36628EBU,0x9144A1D2U,0x4C010B6AU,
+        0x5501B3A0U,0x88441918U,0xEA669021U,0x37233A99U,
+        0xD867E1B5U,0x05224B0DU,0x6700C234U,0xBA45688CU,
+        0xA345D046U,0x7E007AFEU,0x1C22F3C7U,0xC167597FU,
+        0xC747336EU,0x1A0299D6U,0x782010EFU,0xA565BA57U,
+        0xBC65029DU,0x6120A825U,0x0302211CU,0xDE478BA4U,
+        0x31035088U,0xEC46FA30U,0x8E647309U,0x5321D9B1U,
+        0x4A21617BU,0x9764CBC3U,0xF54642FAU,0x2803E842U
+    },
+    {
+        0x00000000U,0x38116FACU,0x7022DF58U,0x4833B0F4U,
+        0xE045BEB0U,0xD854D11CU,0x906761E8U,0xA8760E44U,
+        0xC5670B91U,0xFD76643DU,0xB545D4C9U,0x8D54BB65U,
+        0x2522B521U,0x1D33DA8DU,0x55006A79U,0x6D1105D5U,
+        0x8F2261D3U,0xB7330E7FU,0xFF00BE8BU,0xC711D127U,
+        0x6F67DF63U,0x5776B0CFU,0x1F45003BU,0x27546F97U,
+        0x4A456A42U,0x725405EEU,0x3A67B51AU,0x0276DAB6U,
+        0xAA00D4F2U,0x9211BB5EU,0xDA220BAAU,0xE2336406U,
+        0x1BA8B557U,0x23B9DAFBU,0x6B8A6A0FU,0x539B05A3U,
+        0xFBED0BE7U,0xC3FC644BU,0x8BCFD4BFU,0xB3DEBB13U,
+        0xDECFBEC6U,0xE6DED16AU,0xAEED619EU,0x96FC0E32U,
+        0x3E8A0076U,0x069B6FDAU,0x4EA8DF2EU,0x76B9B082U,
+        0x948AD484U,0xAC9BBB28U,0xE4A80BDCU,0xDCB96470U,
+        0x74CF6A34U,0x4CDE0598U,0x04EDB56CU,0x3CFCDAC0U,
+        0x51EDDF15U,0x69FCB0B9U,0x21CF004DU,0x19DE6FE1U,
+        0xB1A861A5U,0x89B90E09U,0xC18ABEFDU,0xF99BD151U,
+        0x37516AAEU,0x0F400502U,0x4773B5F6U,0x7F62DA5AU,
+        0xD714D41EU,0xEF05BBB2U,0xA7360B46U,0x9F2764EAU,
+        0xF236613FU,0xCA270E93U,0x8214BE67U,0xBA05D1CBU,
+        0x1273DF8FU,0x2A62B023U,0x625100D7U,0x5A406F7BU,
+        0xB8730B7DU,0x806264D1U,0xC851D425U,0xF040BB89U,
+        0x5836B5CDU,0x6027DA61U,0x28146A95U,0x10050539U,
+        0x7D1400ECU,0x45056F40U,0x0D36DFB4U,0x3527B018U,
+        0x9D51BE5CU,0xA540D1F0U,0xED736104U,0xD5620EA8U,
+        0x2CF9DFF9U,0x14E8B055U,0x5CDB00A1U,0x64CA6F0DU,
+        0xCCBC6149U,0xF4AD0EE5U,0xBC9EBE11U,0x848FD1BDU,
+        0xE99ED468U,0xD18FBBC4U,0x99BC0B30U,0xA1AD649CU,
+        0x09DB6AD8U,0x31CA0574U,0x79F9B580U,0x41E8DA2CU,
+        0xA3DBBE2AU,0x9BCAD186U,0xD3F96172U,0xEBE80EDEU,
+        0x439E009AU,0x7B8F6F36U,0x33BCDFC2U,0x0BADB06EU,
+        0x66BCB5BBU,0x5EADDA17U,0x169E6AE3U,0x2E8F054FU,
+        0x86F90B0BU,0xBEE864A7U,0xF6DBD453U,0xCECABBFFU,
+        0x6EA2D55CU,0x56B3BAF0U,0x1E800A04U,0x269165A8U,
+        0x8EE76BECU,0xB6F60440U,0xFEC5B4B4U,0xC6D4DB18U,
+        0xABC5DECDU,0x93D4B161U,0xDBE70195U,0xE3F66E39U,
+        0x4B80607DU,0x73910FD1U,0x3BA2BF25U,0x03B3D089U,
+        0xE180B48FU,0xD991DB23U,0x91A26BD7U,0xA9B3047BU,
+        0x01C50A3FU,0x39D46593U,0x71E7D567U,0x49F6BACBU,
+        0x24E7BF1EU,0x1CF6D0B2U,0x54C56046U,0x6CD40FEAU,
+        0xC4A201AEU,0xFCB36E02U,0xB480DEF6U,0x8C91B15AU,
+        0x750A600BU,0x4D1B0FA7U,0x0528BF53U,0x3D39D0FFU,
+        0x954FDEBBU,0xAD5EB117U,0xE56D01E3U,0xDD7C6E4FU,
+        0xB06D6B9AU,0x887C0436U,0xC04FB4C2U,0xF85EDB6EU,
+        0x5028D52AU,0x6839BA86U,0x200A0A72U,0x181B65DEU,
+        0xFA2801D8U,0xC2396E74U,0x8A0ADE80U,0xB21BB12CU,
+        0x1A6DBF68U,0x227CD0C4U,0x6A4F6030U,0x525E0F9CU,
+        0x3F4F0A49U,0x075E65E5U,0x4F6DD511U,0x777CBABDU,
+        0xDF0AB4F9U,0xE71BDB55U,0xAF286BA1U,0x9739040DU,
+        0x59F3BFF2U,0x61E2D05EU,0x29D160AAU,0x11C00F06U,
+        0xB9B60142U,0x81A76EEEU,0xC994DE1AU,0xF185B1B6U,
+        0x9C94B463U,0xA485DBCFU,0xECB66B3BU,0xD4A70497U,
+        0x7CD10AD3U,0x44C0657FU,0x0CF3D58BU,0x34E2BA27U,
+        0xD6D1DE21U,0xEEC0B18DU,0xA6F30179U,0x9EE26ED5U,
+        0x36946091U,0x0E850F3DU,0x46B6BFC9U,0x7EA7D065U,
+        0x13B6D5B0U,0x2BA7BA1CU,0x63940AE8U,0x5B856544U,
+        0xF3F36B00U,0xCBE204ACU,0x83D1B458U,0xBBC0DBF4U,
+        0x425B0AA5U,0x7A4A6509U,0x3279D5FDU,0x0A68BA51U,
+        0xA21EB415U,0x9A0FDBB9U,0xD23C6B4DU,0xEA2D04E1U,
+        0x873C0134U,0xBF2D6E98U,0xF71EDE6CU,0xCF0FB1C0U,
+        0x6779BF84U,0x5F68D028U,0x175B60DCU,0x2F4A0F70U,
+        0xCD796B76U,0xF56804DAU,0xBD5BB42EU,0x854ADB82U,
+        0x2D3CD5C6U,0x152DBA6AU,0x5D1E0A9EU,0x650F6532U,
+        0x081E60E7U,0x300F0F4BU,0x783CBFBFU,0x402DD013U,
+        0xE85BDE57U,0xD04AB1FBU,0x9879010FU,0xA0686EA3U
+    },
+    {
+        0x00000000U,0xEF306B19U,0xDB8CA0C3U,0x34BCCBDAU,
+        0xB2F53777U,0x5DC55C6EU,0x697997B4U,0x8649FCADU,
+        0x6006181FU,0x8F367306U,0xBB8AB8DCU,0x54BAD3C5U,
+        0xD2F32F68U,0x3DC34471U,0x097F8FABU,0xE64FE4B2U,
+        0xC00C303EU,0x2F3C5B27U,0x1B8090FDU,0xF4B0FBE4U,
+        0x72F90749U,0x9DC96C50U,0xA975A78AU,0x4645CC93U,
+        0xA00A2821U,0x4F3A4338U,0x7B8688E2U,0x94B6E3FBU,
+        0x12FF1F56U,0xFDCF744FU,0xC973BF95U,0x2643D48CU,
+        0x85F4168DU,0x6AC47D94U,0x5E78B64EU,0xB148DD57U,
+        0x370121FAU,0xD8314AE3U,0xEC8D8139U,0x03BDEA20U,
+        0xE5F20E92U,0x0AC2658BU,0x3E7EAE51U,0xD14EC548U,
+        0x570739E5U,0xB83752FCU,0x8C8B9926U,0x63BBF23FU,
+        0x45F826B3U,0xAAC84DAAU,0x9E748670U,0x7144ED69U,
+        0xF70D11C4U,0x183D7ADDU,0x2C81B107U,0xC3B1DA1EU,
+        0x25FE3EACU,0xCACE55B5U,0xFE729E6FU,0x1142F576U,
+        0x970B09DBU,0x783B62C2U,0x4C87A918U,0xA3B7C201U,
+        0x0E045BEBU,0xE13430F2U,0xD588FB28U,0x3AB89031U,
+        0xBCF16C9CU,0x53C10785U,0x677DCC5FU,0x884DA746U,
+        0x6E0243F4U,0x813228EDU,0xB58EE337U,0x5ABE882EU,
+        0xDCF77483U,0x33C71F9AU,0x077BD440U,0xE84BBF59U,
+        0xCE086BD5U,0x213800CCU,0x1584CB16U,0xFAB4A00FU,
+        0x7CFD5CA2U,0x93CD37BBU,0xA771FC61U,0x48419778U,
+        0xAE0E73CAU,0x413E18D3U,0x7582D309U,0x9AB2B810U,
+        0x1CFB44BDU,0xF3CB2FA4U,0xC777E47EU,0x28478F67U,
+        0x8BF04D66U,0x64C0267FU,0x507CEDA5U,0xBF4C86BCU,
+        0x39057A11U,0xD6351108U,0xE289DAD2U,0x0DB9B1CBU,
+        0xEBF65579U,0x04C63E60U,0x307AF5BAU,0xDF4A9EA3U,
+        0x5903620EU,0xB6330917U,0x828FC2CDU,0x6DBFA9D4U,
+        0x4BFC7D58U,0xA4CC1641U,0x9070DD9BU,0x7F40B682U,
+        0xF9094A2FU,0x16392136U,0x2285EAECU,0xCDB581F5U,
+        0x2BFA6547U,0xC4CA0E5EU,0xF076C584U,0x1F46AE9DU,
+        0x990F5230U,0x763F3929U,0x4283F2F3U,0xADB399EAU,
+        0x1C08B7D6U,0xF338DCCFU,0xC7841715U,0x28B47C0CU,
+        0xAEFD80A1U,0x41CDEBB8U,0x75712062U,0x9A414B7BU,
+        0x7C0EAFC9U,0x933EC4D0U,0xA7820F0AU,0x48B26413U,
+        0xCEFB98BEU,0x21CBF3A7U,0x1577387DU,0xFA475364U,
+        0xDC0487E8U,0x3334ECF1U,0x0788272BU,0xE8B84C32U,
+        0x6EF1B09FU,0x81C1DB86U,0xB57D105CU,0x5A4D7B45U,
+        0xBC029FF7U,0x5332F4EEU,0x678E3F34U,0x88BE542DU,
+        0x0EF7A880U,0xE1C7C399U,0xD57B0843U,0x3A4B635AU,
+        0x99FCA15BU,0x76CCCA42U,0x42700198U,0xAD406A81U,
+        0x2B09962CU,0xC439FD35U,0xF08536EFU,0x1FB55DF6U,
+        0xF9FAB944U,0x16CAD25DU,0x22761987U,0xCD46729EU,
+        0x4B0F8E33U,0xA43FE52AU,0x90832EF0U,0x7FB345E9U,
+        0x59F09165U,0xB6C0FA7CU,0x827C31A6U,0x6D4C5ABFU,
+        0xEB05A612U,0x0435CD0BU,0x308906D1U,0xDFB96DC8U,
+        0x39F6897AU,0xD6C6E263U,0xE27A29B9U,0x0D4A42A0U,
+        0x8B03BE0DU,0x6433D514U,0x508F1ECEU,0xBFBF75D7U,
+        0x120CEC3DU,0xFD3C8724U,0xC9804CFEU,0x26B027E7U,
+        0xA0F9DB4AU,0x4FC9B053U,0x7B757B89U,0x94451090U,
+        0x720AF422U,0x9D3A9F3BU,0xA98654E1U,0x46B63FF8U,
+        0xC0FFC355U,0x2FCFA84CU,0x1B736396U,0xF443088FU,
+        0xD200DC03U,0x3D30B71AU,0x098C7CC0U,0xE6BC17D9U,
+        0x60F5EB74U,0x8FC5806DU,0xBB794BB7U,0x544920AEU,
+        0xB206C41CU,0x5D36AF05U,0x698A64DFU,0x86BA0FC6U,
+        0x00F3F36BU,0xEFC39872U,0xDB7F53A8U,0x344F38B1U,
+        0x97F8FAB0U,0x78C891A9U,0x4C745A73U,0xA344316AU,
+        0x250DCDC7U,0xCA3DA6DEU,0xFE816D04U,0x11B1061DU,
+        0xF7FEE2AFU,0x18CE89B6U,0x2C72426CU,0xC3422975U,
+        0x450BD5D8U,0xAA3BBEC1U,0x9E87751BU,0x71B71E02U,
+        0x57F4CA8EU,0xB8C4A197U,0x8C786A4DU,0x63480154U,
+        0xE501FDF9U,0x0A3196E0U,0x3E8D5D3AU,0xD1BD3623U,
+        0x37F2D291U,0xD8C2B988U,0xEC7E7252U,0x034E194BU,
+        0x8507E5E6U,0x6A378EFFU,0x5E8B4525U,0xB1BB2E3CU
+    },
+    {
+        0x00000000U,0x68032CC8U,0xD0065990U,0xB8057558U,
+        0xA5E0C5D1U,0xCDE3E919U,0x75E69C41U,0x1DE5B089U,
+        0x4E2DFD53U,0x262ED19BU,0x9E2BA4C3U,0xF628880BU,
+        0xEBCD3882U,0x83CE144AU,0x3BCB6112U,0x53C84DDAU,
+        0x9C5BFAA6U,0xF458D66EU,0x4C5DA336U,0x245E8FFEU,
+        0x39BB3F77U,0x51B813BFU,0xE9BD66E7U,0x81BE4A2FU,
+        0xD27607F5U,0xBA752B3DU,0x02705E65U,0x6A7372ADU,
+        0x7796C224U,0x1F95EEECU,0xA7909BB4U,0xCF93B77CU,
+        0x3D5B83BDU,0x5558AF75U,0xED5DDA2DU,0x855EF6E5U,
+        0x98BB466CU,0xF0B86AA4U,0x48BD1FFCU,0x20BE3334U,
+        0x73767EEEU,0x1B755226U,0xA370277EU,0xCB730BB6U,
+        0xD696BB3FU,0xBE9597F7U,0x0690E2AFU,0x6E93CE67U,
+        0xA100791BU,0xC90355D3U,0x7106208BU,0x19050C43U,
+        0x04E0BCCAU,0x6CE39002U,0xD4E6E55AU,0xBCE5C992U,
+        0xEF2D8448U,0x872EA880U,0x3F2BDDD8U,0x5728F110U,
+        0x4ACD4199U,0x22CE6D51U,0x9ACB1809U,0xF2C834C1U,
+        0x7AB7077AU,0x12B42BB2U,0xAAB15EEAU,0xC2B27222U,
+        0xDF57C2ABU,0xB754EE63U,0x0F519B3BU,0x6752B7F3U,
+        0x349AFA29U,0x5C99D6E1U,0xE49CA3B9U,0x8C9F8F71U,
+        0x917A3FF8U,0xF9791330U,0x417C6668U,0x297F4AA0U,
+        0xE6ECFDDCU,0x8EEFD114U,0x36EAA44CU,0x5EE98884U,
+        0x430C380DU,0x2B0F14C5U,0x930A619DU,0xFB094D55U,
+        0xA8C1008FU,0xC0C22C47U,0x78C7591FU,0x10C475D7U,
+        0x0D21C55EU,0x6522E996U,0xDD279CCEU,0xB524B006U,
+        0x47EC84C7U,0x2FEFA80FU,0x97EADD57U,0xFFE9F19FU,
+        0xE20C4116U,0x8A0F6DDEU,0x320A1886U,0x5A09344EU,
+        0x09C17994U,0x61C2555CU,0xD9C72004U,0xB1C40CCCU,
+        0xAC21BC45U,0xC422908DU,0x7C27E5D5U,0x1424C91DU,
+        0xDBB77E61U,0xB3B452A9U,0x0BB127F1U,0x63B20B39U,
+        0x7E57BBB0U,0x16549778U,0xAE51E220U,0xC652CEE8U,
+        0x959A8332U,0xFD99AFFAU,0x459CDAA2U,0x2D9FF66AU,
+        0x307A46E3U,0x58796A2BU,0xE07C1F73U,0x887F33BBU,
+        0xF56E0EF4U,0x9D6D223CU,0x25685764U,0x4D6B7BACU,
+        0x508ECB25U,0x388DE7EDU,0x808892B5U,0xE88BBE7DU,
+        0xBB43F3A7U,0xD340DF6FU,0x6B45AA37U,0x034686FFU,
+        0x1EA33676U,0x76A01ABEU,0xCEA56FE6U,0xA6A6432EU,
+        0x6935F452U,0x0136D89AU,0xB933ADC2U,0xD130810AU,
+        0xCCD53183U,0xA4D61D4BU,0x1CD36813U,0x74D044DBU,
+        0x27180901U,0x4F1B25C9U,0xF71E5091U,0x9F1D7C59U,
+        0x82F8CCD0U,0xEAFBE018U,0x52FE9540U,0x3AFDB988U,
+        0xC8358D49U,0xA036A181U,0x1833D4D9U,0x7030F811U,
+        0x6DD54898U,0x05D66450U,0xBDD31108U,0xD5D03DC0U,
+        0x8618701AU,0xEE1B5CD2U,0x561E298AU,0x3E1D0542U,
+        0x23F8B5CBU,0x4BFB9903U,0xF3FEEC5BU,0x9BFDC093U,
+        0x546E77EFU,0x3C6D5B27U,0x84682E7FU,0xEC6B02B7U,
+        0xF18EB23EU,0x998D9EF6U,0x2188EBAEU,0x498BC766U,
+        0x1A438ABCU,0x7240A674U,0xCA45D32CU,0xA246FFE4U,
+        0xBFA34F6DU,0xD7A063A5U,0x6FA516FDU,0x07A63A35U,
+        0x8FD9098EU,0xE7DA2546U,0x5FDF501EU,0x37DC7CD6U,
+        0x2A39CC5FU,0x423AE097U,0xFA3F95CFU,0x923CB907U,
+        0xC1F4F4DDU,0xA9F7D815U,0x11F2AD4DU,0x79F18185U,
+        0x6414310CU,0x0C171DC4U,0xB412689CU,0xDC114454U,
+        0x1382F328U,0x7B81DFE0U,0xC384AAB8U,0xAB878670U,
+        0xB66236F9U,0xDE611A31U,0x66646F69U,0x0E6743A1U,
+        0x5DAF0E7BU,0x35AC22B3U,0x8DA957EBU,0xE5AA7B23U,
+        0xF84FCBAAU,0x904CE762U,0x2849923AU,0x404ABEF2U,
+        0xB2828A33U,0xDA81A6FBU,0x6284D3A3U,0x0A87FF6BU,
+        0x17624FE2U,0x7F61632AU,0xC7641672U,0xAF673ABAU,
+        0xFCAF7760U,0x94AC5BA8U,0x2CA92EF0U,0x44AA0238U,
+        0x594FB2B1U,0x314C9E79U,0x8949EB21U,0xE14AC7E9U,
+        0x2ED97095U,0x46DA5C5DU,0xFEDF2905U,0x96DC05CDU,
+        0x8B39B544U,0xE33A998CU,0x5B3FECD4U,0x333CC01CU,
+        0x60F48DC6U,0x08F7A10EU,0xB0F2D456U,0xD8F1F89EU,
+        0xC5144817U,0xAD1764DFU,0x15121187U,0x7D113D4FU
+    },
+    {
+        0x00000000U,0x493C7D27U,0x9278FA4EU,0xDB448769U,
+        0x211D826DU,0x6821FF4AU,0xB3657823U,0xFA590504U,
+        0x423B04DAU,0x0B0779FDU,0xD043FE94U,0x997F83B3U,
+        0x632686B7U,0x2A1AFB90U,0xF15E7CF9U,0xB86201DEU,
+        0x847609B4U,0xCD4A7493U,0x160EF3FAU,0x5F328EDDU,
+        0xA56B8BD9U,0xEC57F6FEU,0x37137197U,0x7E2F0CB0U,
+        0xC64D0D6EU,0x8F717049U,0x5435F720U,0x1D098A07U,
+        0xE7508F03U,0xAE6CF224U,0x7528754DU,0x3C14086AU,
+        0x0D006599U,0x443C18BEU,0x9F789FD7U,0xD644E2F0U,
+        0x2C1DE7F4U,0x65219AD3U,0xBE651DBAU,0xF759609DU,
+        0x4F3B6143U,0x06071C64U,0xDD439B0DU,0x947FE62AU,
+        0x6E26E32EU,0x271A9E09U,0xFC5E1960U,0xB5626447U,
+        0x89766C2DU,0xC04A110AU,0x1B0E9663U,0x5232EB44U,
+        0xA86BEE40U,0xE1579367U,0x3A13140EU,0x732F6929U,
+        0xCB4D68F7U,0x827115D0U,0x593592B9U,0x1009EF9EU,
+        0xEA50EA9AU,0xA36C97BDU,0x782810D4U,0x31146DF3U,
+        0x1A00CB32U,0x533CB615U,0x8878317CU,0xC1444C5BU,
+        0x3B1D495FU,0x72213478U,0xA965B311U,0xE059CE36U,
+        0x583BCFE8U,0x1107B2CFU,0xCA4335A6U,0x837F4881U,
+        0x79264D85U,0x301A30A2U,0xEB5EB7CBU,0xA262CAECU,
+        0x9E76C286U,0xD74ABFA1U,0x0C0E38C8U,0x453245EFU,
+        0xBF6B40EBU,0xF6573DCCU,0x2D13BAA5U,0x642FC782U,
+        0xDC4DC65CU,0x9571BB7BU,0x4E353C12U,0x07094135U,
+        0xFD504431U,0xB46C3916U,0x6F28BE7FU,0x2614C358U,
+        0x1700AEABU,0x5E3CD38CU,0x857854E5U,0xCC4429C2U,
+        0x361D2CC6U,0x7F2151E1U,0xA465D688U,0xED59ABAFU,
+        0x553BAA71U,0x1C07D756U,0xC743503FU,0x8E7F2D18U,
+        0x7426281CU,0x3D1A553BU,0xE65ED252U,0xAF62AF75U,
+        0x9376A71FU,0xDA4ADA38U,0x010E5D51U,0x48322076U,
+        0xB26B2572U,0xFB575855U,0x2013DF3CU,0x692FA21BU,
+        0xD14DA3C5U,0x9871DEE2U,0x4335598BU,0x0A0924ACU,
+        0xF05021A8U,0xB96C5C8FU,0x6228DBE6U,0x2B14A6C1U,
+        0x34019664U,0x7D3DEB43U,0xA6796C2AU,0xEF45110DU,
+        0x151C1409U,0x5C20692EU,0x8764EE47U,0xCE589360U,
+        0x763A92BEU,0x3F06EF99U,0xE44268F0U,0xAD7E15D7U,
+        0x572710D3U,0x1E1B6DF4U,0xC55FEA9DU,0x8C6397BAU,
+        0xB0779FD0U,0xF94BE2F7U,0x220F659EU,0x6B3318B9U,
+        0x916A1DBDU,0xD856609AU,0x0312E7F3U,0x4A2E9AD4U,
+        0xF24C9B0AU,0xBB70E62DU,0x60346144U,0x29081C63U,
+        0xD3511967U,0x9A6D6440U,0x4129E329U,0x08159E0EU,
+        0x3901F3FDU,0x703D8EDAU,0xAB7909B3U,0xE2457494U,
+        0x181C7190U,0x51200CB7U,0x8A648BDEU,0xC358F6F9U,
+        0x7B3AF727U,0x32068A00U,0xE9420D69U,0xA07E704EU,
+        0x5A27754AU,0x131B086DU,0xC85F8F04U,0x8163F223U,
+        0xBD77FA49U,0xF44B876EU,0x2F0F0007U,0x66337D20U,
+        0x9C6A7824U,0xD5560503U,0x0E12826AU,0x472EFF4DU,
+        0xFF4CFE93U,0xB67083B4U,0x6D3404DDU,0x240879FAU,
+        0xDE517CFEU,0x976D01D9U,0x4C2986B0U,0x0515FB97U,
+        0x2E015D56U,0x673D2071U,0xBC79A718U,0xF545DA3FU,
+        0x0F1CDF3BU,0x4620A21CU,0x9D642575U,0xD4585852U,
+        0x6C3A598CU,0x250624ABU,0xFE42A3C2U,0xB77EDEE5U,
+        0x4D27DBE1U,0x041BA6C6U,0xDF5F21AFU,0x96635C88U,
+        0xAA7754E2U,0xE34B29C5U,0x380FAEACU,0x7133D38BU,
+        0x8B6AD68FU,0xC256ABA8U,0x19122CC1U,0x502E51E6U,
+        0xE84C5038U,0xA1702D1FU,0x7A34AA76U,0x3308D751U,
+        0xC951D255U,0x806DAF72U,0x5B29281BU,0x1215553CU,
+        0x230138CFU,0x6A3D45E8U,0xB179C281U,0xF845BFA6U,
+        0x021CBAA2U,0x4B20C785U,0x906440ECU,0xD9583DCBU,
+        0x613A3C15U,0x28064132U,0xF342C65BU,0xBA7EBB7CU,
+        0x4027BE78U,0x091BC35FU,0xD25F4436U,0x9B633911U,
+        0xA777317BU,0xEE4B4C5CU,0x350FCB35U,0x7C33B612U,
+        0x866AB316U,0xCF56CE31U,0x14124958U,0x5D2E347FU,
+        0xE54C35A1U,0xAC704886U,0x7734CFEFU,0x3E08B2C8U,
+        0xC451B7CCU,0x8D6DCAEBU,0x56294D82U,0x1F1530A5U
+    }
+};
+
+
+/** Advances a raw CRC32C over CRC32C_LONG zero bytes, one byte of the CRC per row; Recombines the three interleaved hardware streams */
+const uint32_t crc32c_long_shift[4][256] = {
+    {
+        0x00000000U,0xE040E0ACU,0xC56DB7A9U,0x252D5705U,
+        0x8F3719A3U,0x6F77F90FU,0x4A5AAE0AU,0xAA1A4EA6U,
+        0x1B8245B7U,0xFBC2A51BU,0xDEEFF21EU,0x3EAF12B2U,
+        0x94B55C14U,0x74F5BCB8U,0x51D8EBBDU,0xB1980B11U,
+        0x37048B6EU,0xD7446BC2U,0xF2693CC7U,0x1229DC6BU,
+        0xB83392CDU,0x58737261U,0x7D5E2564U,0x9D1EC5C8U,
+        0x2C86CED9U,0xCCC62E75U,0xE9EB7970U,0x09AB99DCU,
+        0xA3B1D77AU,0x43F137D6U,0x66DC60D3U,0x869C807FU,
+        0x6E0916DCU,0x8E49F670U,0xAB64A175U,0x4B2441D9U,
+        0xE13E0F7FU,0x017EEFD3U,0x2453B8D6U,0xC413587AU,
+        0x758B536BU,0x95CBB3C7U,0xB0E6E4C2U,0x50A6046EU,
+        0xFABC4AC8U,0x1AFCAA64U,0x3FD1FD61U,0xDF911DCDU,
+        0x590D9DB2U,0xB94D7D1EU,0x9C602A1BU,0x7C20CAB7U,
+        0xD63A8411U,0x367A64BDU,0x135733B8U,0xF317D314U,
+        0x428FD805U,0xA2CF38A9U,0x87E26FACU,0x67A28F00U,
+        0xCDB8C1A6U,0x2DF8210AU,0x08D5760FU,0xE89596A3U,
+        0xDC122DB8U,0x3C52CD14U,0x197F9A11U,0xF93F7ABDU,
+        0x5325341BU,0xB365D4B7U,0x964883B2U,0x7608631EU,
+        0xC790680FU,0x27D088A3U,0x02FDDFA6U,0xE2BD3F0AU,
+        0x48A771ACU,0xA8E79100U,0x8DCAC605U,0x6D8A26A9U,
+        0xEB16A6D6U,0x0B56467AU,0x2E7B117FU,0xCE3BF1D3U,
+        0x6421BF75U,0x84615FD9U,0xA14C08DCU,0x410CE870U,
+        0xF094E361U,0x10D403CDU,0x35F954C8U,0xD5B9B464U,
+        0x7FA3FAC2U,0x9FE31A6EU,0xBACE4D6BU,0x5A8EADC7U,
+        0xB21B3B64U,0x525BDBC8U,0x77768CCDU,0x97366C61U,
+        0x3D2C22C7U,0xDD6CC26BU,0xF841956EU,0x180175C2U,
+        0xA9997ED3U,0x49D99E7FU,0x6CF4C97AU,0x8CB429D6U,
+        0x26AE6770U,0xC6EE87DCU,0xE3C3D0D9U,0x03833075U,
+        0x851FB00AU,0x655F50A6U,0x407207A3U,0xA032E70FU,
+        0x0A28A9A9U,0xEA684905U,0xCF451E00U,0x2F05FEACU,
+        0x9E9DF5BDU,0x7EDD1511U,0x5BF04214U,0xBBB0A2B8U,
+        0x11AAEC1EU,0xF1EA0CB2U,0xD4C75BB7U,0x3487BB1BU,
+        0xBDC82D81U,0x5D88CD2DU,0x78A59A28U,0x98E57A84U,
+        0x32FF3422U,0xD2BFD48EU,0xF792838BU,0x17D26327U,
+        0xA64A6836U,0x460A889AU,0x6327DF9FU,0x83673F33U,
+        0x297D7195U,0xC93D9139U,0xEC10C63CU,0x0C502690U,
+        0x8ACCA6EFU,0x6A8C4643U,0x4FA11146U,0xAFE1F1EAU,
+        0x05FBBF4CU,0xE5BB5FE0U,0xC09608E5U,0x20D6E849U,
+        0x914EE358U,0x710E03F4U,0x542354F1U,0xB463B45DU,
+        0x1E79FAFBU,0xFE391A57U,0xDB144D52U,0x3B54ADFEU,
+        0xD3C13B5DU,0x3381DBF1U,0x16AC8CF4U,0xF6EC6C58U,
+        0x5CF622FEU,0xBCB6C252U,0x999B9557U,0x79DB75FBU,
+        0xC8437EEAU,0x28039E46U,0x0D2EC943U,0xED6E29EFU,
+        0x47746749U,0xA73487E5U,0x8219D0E0U,0x6259304CU,
+        0xE4C5B033U,0x0485509FU,0x21A8079AU,0xC1E8E736U,
+        0x6BF2A990U,0x8BB2493CU,0xAE9F1E39U,0x4EDFFE95U,
+        0xFF47F584U,0x1F071528U,0x3A2A422DU,0xDA6AA281U,
+        0x7070EC27U,0x90300C8BU,0xB51D5B8EU,0x555DBB22U,
+        0x61DA0039U,0x819AE095U,0xA4B7B790U,0x44F7573CU,
+        0xEEED199AU,0x0EADF936U,0x2B80AE33U,0xCBC04E9FU,
+        0x7A58458EU,0x9A18A522U,0xBF35F227U,0x5F75128BU,
+        0xF56F5C2DU,0x152FBC81U,0x3002EB84U,0xD0420B28U,
+        0x56DE8B57U,0xB69E6BFBU,0x93B33CFEU,0x73F3DC52U,
+        0xD9E992F4U,0x39A97258U,0x1C84255DU,0xFCC4C5F1U,
+        0x4D5CCEE0U,0xAD1C2E4CU,0x88317949U,0x687199E5U,
+        0xC26BD743U,0x222B37EFU,0x070660EAU,0xE7468046U,
+        0x0FD316E5U,0xEF93F649U,0xCABEA14CU,0x2AFE41E0U,
+        0x80E40F46U,0x60A4EFEAU,0x4589B8EFU,0xA5C95843U,
+        0x14515352U,0xF411B3FEU,0xD13CE4FBU,0x317C0457U,
+        0x9B664AF1U,0x7B26AA5DU,0x5E0BFD58U,0xBE4B1DF4U,
+        0x38D79D8BU,0xD8977D27U,0xFDBA2A22U,0x1DFACA8EU,
+        0xB7E08428U,0x57A06484U,0x728D3381U,0x92CDD32DU,
+        0x2355D83CU,0xC3153890U,0xE6386F95U,0x06788F39U,
+        0xAC62C19FU,0x4C222133U,0x690F7636U,0x894F969AU
+    },
+    {
+        0x00000000U,0x7E7C2DF3U,0xFCF85BE6U,0x82847615U,
+        0xFC1CC13DU,0x8260ECCEU,0x00E49ADBU,0x7E98B728U,
+        0xFDD5F48BU,0x83A9D978U,0x012DAF6DU,0x7F51829EU,
+        0x01C935B6U,0x7FB51845U,0xFD316E50U,0x834D43A3U,
+        0xFE479FE7U,0x803BB214U,0x02BFC401U,0x7CC3E9F2U,
+        0x025B5EDAU,0x7C277329U,0xFEA3053CU,0x80DF28CFU,
+        0x03926B6CU,0x7DEE469FU,0xFF6A308AU,0x81161D79U,
+        0xFF8EAA51U,0x81F287A2U,0x0376F1B7U,0x7D0ADC44U,
+        0xF963493FU,0x871F64CCU,0x059B12D9U,0x7BE73F2AU,
+        0x057F8802U,0x7B03A5F1U,0xF987D3E4U,0x87FBFE17U,
+        0x04B6BDB4U,0x7ACA9047U,0xF84EE652U,0x8632CBA1U,
+        0xF8AA7C89U,0x86D6517AU,0x0452276FU,0x7A2E0A9CU,
+        0x0724D6D8U,0x7958FB2BU,0xFBDC8D3EU,0x85A0A0CDU,
+        0xFB3817E5U,0x85443A16U,0x07C04C03U,0x79BC61F0U,
+        0xFAF12253U,0x848D0FA0U,0x060979B5U,0x78755446U,
+        0x06EDE36EU,0x7891CE9DU,0xFA15B888U,0x8469957BU,
+        0xF72AE48FU,0x8956C97CU,0x0BD2BF69U,0x75AE929AU,
+        0x0B3625B2U,0x754A0841U,0xF7CE7E54U,0x89B253A7U,
+        0x0AFF1004U,0x74833DF7U,0xF6074BE2U,0x887B6611U,
+        0xF6E3D139U,0x889FFCCAU,0x0A1B8ADFU,0x7467A72CU,
+        0x096D7B68U,0x7711569BU,0xF595208EU,0x8BE90D7DU,
+        0xF571BA55U,0x8B0D97A6U,0x0989E1B3U,0x77F5CC40U,
+        0xF4B88FE3U,0x8AC4A210U,0x0840D405U,0x763CF9F6U,
+        0x08A44EDEU,0x76D8632DU,0xF45C1538U,0x8A2038CBU,
+        0x0E49ADB0U,0x70358043U,0xF2B1F656U,0x8CCDDBA5U,
+        0xF2556C8DU,0x8C29417EU,0x0EAD376BU,0x70D11A98U,
+        0xF39C593BU,0x8DE074C8U,0x0F6402DDU,0x71182F2EU,
+        0x0F809806U,0x71FCB5F5U,0xF378C3E0U,0x8D04EE13U,
+        0xF00E3257U,0x8E721FA4U,0x0CF669B1U,0x728A4442U,
+        0x0C12F36AU,0x726EDE99U,0xF0EAA88CU,0x8E96857FU,
+        0x0DDBC6DCU,0x73A7EB2FU,0xF1239D3AU,0x8F5FB0C9U,
+        0xF1C707E1U,0x8FBB2A12U,0x0D3F5C07U,0x734371F4U,
+        0xEBB9BFEFU,0x95C5921CU,0x1741E409U,0x693DC9FAU,
+        0x17A57ED2U,0x69D95321U,0xEB5D2534U,0x952108C7U,
+        0x166C4B64U,0x68106697U,0xEA941082U,0x94E83D71U,
+        0xEA708A59U,0x940CA7AAU,0x1688D1BFU,0x68F4FC4CU,
+        0x15FE2008U,0x6B820DFBU,0xE9067BEEU,0x977A561DU,
+        0xE9E2E135U,0x979ECCC6U,0x151ABAD3U,0x6B669720U,
+        0xE82BD483U,0x9657F970U,0x14D38F65U,0x6AAFA296U,
+        0x143715BEU,0x6A4B384DU,0xE8CF4E58U,0x96B363ABU,
+        0x12DAF6D0U,0x6CA6DB23U,0xEE22AD36U,0x905E80C5U,
+        0xEEC637EDU,0x90BA1A1EU,0x123E6C0BU,0x6C4241F8U,
+        0xEF0F025BU,0x91732FA8U,0x13F759BDU,0x6D8B744EU,
+        0x1313C366U,0x6D6FEE95U,0xEFEB9880U,0x9197B573U,
+        0xEC9D6937U,0x92E144C4U,0x106532D1U,0x6E191F22U,
+        0x1081A80AU,0x6EFD85F9U,0xEC79F3ECU,0x9205DE1FU,
+        0x11489DBCU,0x6F34B04FU,0xEDB0C65AU,0x93CCEBA9U,
+        0xED545C81U,0x93287172U,0x11AC0767U,0x6FD02A94U,
+        0x1C935B60U,0x62EF7693U,0xE06B0086U,0x9E172D75U,
+        0xE08F9A5DU,0x9EF3B7AEU,0x1C77C1BBU,0x620BEC48U,
+        0xE146AFEBU,0x9F3A8218U,0x1DBEF40DU,0x63C2D9FEU,
+        0x1D5A6ED6U,0x63264325U,0xE1A23530U,0x9FDE18C3U,
+        0xE2D4C487U,0x9CA8E974U,0x1E2C9F61U,0x6050B292U,
+        0x1EC805BAU,0x60B42849U,0xE2305E5CU,0x9C4C73AFU,
+        0x1F01300CU,0x617D1DFFU,0xE3F96BEAU,0x9D854619U,
+        0xE31DF131U,0x9D61DCC2U,0x1FE5AAD7U,0x61998724U,
+        0xE5F0125FU,0x9B8C3FACU,0x190849B9U,0x6774644AU,
+        0x19ECD362U,0x6790FE91U,0xE5148884U,0x9B68A577U,
+        0x1825E6D4U,0x6659CB27U,0xE4DDBD32U,0x9AA190C1U,
+        0xE43927E9U,0x9A450A1AU,0x18C17C0FU,0x66BD51FCU,
+        0x1BB78DB8U,0x65CBA04BU,0xE74FD65EU,0x9933FBADU,
+        0xE7AB4C85U,0x99D76176U,0x1B531763U,0x652F3A90U,
+        0xE6627933U,0x981E54C0U,0x1A9A22D5U,0x64E60F26U,
+        0x1A7EB80EU,0x640295FDU,0xE686E3E8U,0x98FACE1BU
+    },
+    {
+        0x00000000U,0xD29F092FU,0xA0D264AFU,0x724D6D80U,
+        0x4448BFAFU,0x96D7B680U,0xE49ADB00U,0x3605D22FU,
+        0x88917F5EU,0x5A0E7671U,0x28431BF1U,0xFADC12DEU,
+        0xCCD9C0F1U,0x1E46C9DEU,0x6C0BA45EU,0xBE94AD71U,
+        0x14CE884DU,0xC6518162U,0xB41CECE2U,0x6683E5CDU,
+        0x508637E2U,0x82193ECDU,0xF054534DU,0x22CB5A62U,
+        0x9C5FF713U,0x4EC0FE3CU,0x3C8D93BCU,0xEE129A93U,
+        0xD81748BCU,0x0A884193U,0x78C52C13U,0xAA5A253CU,
+        0x299D109AU,0xFB0219B5U,0x894F7435U,0x5BD07D1AU,
+        0x6DD5AF35U,0xBF4AA61AU,0xCD07CB9AU,0x1F98C2B5U,
+        0xA10C6FC4U,0x739366EBU,0x01DE0B6BU,0xD3410244U,
+        0xE544D06BU,0x37DBD944U,0x4596B4C4U,0x9709BDEBU,
+        0x3D5398D7U,0xEFCC91F8U,0x9D81FC78U,0x4F1EF557U,
+        0x791B2778U,0xAB842E57U,0xD9C943D7U,0x0B564AF8U,
+        0xB5C2E789U,0x675DEEA6U,0x15108326U,0xC78F8A09U,
+        0xF18A5826U,0x23155109U,0x51583C89U,0x83C735A6U,
+        0x533A2134U,0x81A5281BU,0xF3E8459BU,0x21774CB4U,
+        0x17729E9BU,0xC5ED97B4U,0xB7A0FA34U,0x653FF31BU,
+        0xDBAB5E6AU,0x09345745U,0x7B793AC5U,0xA9E633EAU,
+        0x9FE3E1C5U,0x4D7CE8EAU,0x3F31856AU,0xEDAE8C45U,
+        0x47F4A979U,0x956BA056U,0xE726CDD6U,0x35B9C4F9U,
+        0x03BC16D6U,0xD1231FF9U,0xA36E7279U,0x71F17B56U,
+        0xCF65D627U,0x1DFADF08U,0x6FB7B288U,0xBD28BBA7U,
+        0x8B2D6988U,0x59B260A7U,0x2BFF0D27U,0xF9600408U,
+        0x7AA731AEU,0xA8383881U,0xDA755501U,0x08EA5C2EU,
+        0x3EEF8E01U,0xEC70872EU,0x9E3DEAAEU,0x4CA2E381U,
+        0xF2364EF0U,0x20A947DFU,0x52E42A5FU,0x807B2370U,
+        0xB67EF15FU,0x64E1F870U,0x16AC95F0U,0xC4339CDFU,
+        0x6E69B9E3U,0xBCF6B0CCU,0xCEBBDD4CU,0x1C24D463U,
+        0x2A21064CU,0xF8BE0F63U,0x8AF362E3U,0x586C6BCCU,
+        0xE6F8C6BDU,0x3467CF92U,0x462AA212U,0x94B5AB3DU,
+        0xA2B07912U,0x702F703DU,0x02621DBDU,0xD0FD1492U,
+        0xA6744268U,0x74EB4B47U,0x06A626C7U,0xD4392FE8U,
+        0xE23CFDC7U,0x30A3F4E8U,0x42EE9968U,0x90719047U,
+        0x2EE53D36U,0xFC7A3419U,0x8E375999U,0x5CA850B6U,
+        0x6AAD8299U,0xB8328BB6U,0xCA7FE636U,0x18E0EF19U,
+        0xB2BACA25U,0x6025C30AU,0x1268AE8AU,0xC0F7A7A5U,
+        0xF6F2758AU,0x246D7CA5U,0x56201125U,0x84BF180AU,
+        0x3A2BB57BU,0xE8B4BC54U,0x9AF9D1D4U,0x4866D8FBU,
+        0x7E630AD4U,0xACFC03FBU,0xDEB16E7BU,0x0C2E6754U,
+        0x8FE952F2U,0x5D765BDDU,0x2F3B365DU,0xFDA43F72U,
+        0xCBA1ED5DU,0x193EE472U,0x6B7389F2U,0xB9EC80DDU,
+        0x07782DACU,0xD5E72483U,0xA7AA4903U,0x7535402CU,
+        0x43309203U,0x91AF9B2CU,0xE3E2F6ACU,0x317DFF83U,
+        0x9B27DABFU,0x49B8D390U,0x3BF5BE10U,0xE96AB73FU,
+        0xDF6F6510U,0x0DF06C3FU,0x7FBD01BFU,0xAD220890U,
+        0x13B6A5E1U,0xC129ACCEU,0xB364C14EU,0x61FBC861U,
+        0x57FE1A4EU,0x85611361U,0xF72C7EE1U,0x25B377CEU,
+        0xF54E635CU,0x27D16A73U,0x559C07F3U,0x87030EDCU,
+        0xB106DCF3U,0x6399D5DCU,0x11D4B85CU,0xC34BB173U,
+        0x7DDF1C02U,0xAF40152DU,0xDD0D78ADU,0x0F927182U,
+        0x3997A3ADU,0xEB08AA82U,0x9945C702U,0x4BDACE2DU,
+        0xE180EB11U,0x331FE23EU,0x41528FBEU,0x93CD8691U,
+        0xA5C854BEU,0x77575D91U,0x051A3011U,0xD785393EU,
+        0x6911944FU,0xBB8E9D60U,0xC9C3F0E0U,0x1B5CF9CFU,
+        0x2D592BE0U,0xFFC622CFU,0x8D8B4F4FU,0x5F144660U,
+        0xDCD373C6U,0x0E4C7AE9U,0x7C011769U,0xAE9E1E46U,
+        0x989BCC69U,0x4A04C546U,0x3849A8C6U,0xEAD6A1E9U,
+        0x54420C98U,0x86DD05B7U,0xF4906837U,0x260F6118U,
+        0x100AB337U,0xC295BA18U,0xB0D8D798U,0x6247DEB7U,
+        0xC81DFB8BU,0x1A82F2A4U,0x68CF9F24U,0xBA50960BU,
+        0x8C554424U,0x5ECA4D0BU,0x2C87208BU,0xFE1829A4U,
+        0x408C84D5U,0x92138DFAU,0xE05EE07AU,0x32C1E955U,
+        0x04C43B7AU,0xD65B3255U,0xA4165FD5U,0x768956FAU
+    },
+    {
+        0x00000000U,0x4904F221U,0x9209E442U,0xDB0D1663U,
+        0x21FFBE75U,0x68FB4C54U,0xB3F65A37U,0xFAF2A816U,
+        0x43FF7CEAU,0x0AFB8ECBU,0xD1F698A8U,0x98F26A89U,
+        0x6200C29FU,0x2B0430BEU,0xF00926DDU,0xB90DD4FCU,
+        0x87FEF9D4U,0xCEFA0BF5U,0x15F71D96U,0x5CF3EFB7U,
+        0xA60147A1U,0xEF05B580U,0x3408A3E3U,0x7D0C51C2U,
+        0xC401853EU,0x8D05771FU,0x5608617CU,0x1F0C935DU,
+        0xE5FE3B4BU,0xACFAC96AU,0x77F7DF09U,0x3EF32D28U,
+        0x0A118559U,0x43157778U,0x9818611BU,0xD11C933AU,
+        0x2BEE3B2CU,0x62EAC90DU,0xB9E7DF6EU,0xF0E32D4FU,
+        0x49EEF9B3U,0x00EA0B92U,0xDBE71DF1U,0x92E3EFD0U,
+        0x681147C6U,0x2115B5E7U,0xFA18A384U,0xB31C51A5U,
+        0x8DEF7C8DU,0xC4EB8EACU,0x1FE698CFU,0x56E26AEEU,
+        0xAC10C2F8U,0xE51430D9U,0x3E1926BAU,0x771DD49BU,
+        0xCE100067U,0x8714F246U,0x5C19E425U,0x151D1604U,
+        0xEFEFBE12U,0xA6EB4C33U,0x7DE65A50U,0x34E2A871U,
+        0x14230AB2U,0x5D27F893U,0x862AEEF0U,0xCF2E1CD1U,
+        0x35DCB4C7U,0x7CD846E6U,0xA7D55085U,0xEED1A2A4U,
+        0x57DC7658U,0x1ED88479U,0xC5D5921AU,0x8CD1603BU,
+        0x7623C82DU,0x3F273A0CU,0xE42A2C6FU,0xAD2EDE4EU,
+        0x93DDF366U,0xDAD90147U,0x01D41724U,0x48D0E505U,
+        0xB2224D13U,0xFB26BF32U,0x202BA951U,0x692F5B70U,
+        0xD0228F8CU,0x99267DADU,0x422B6BCEU,0x0B2F99EFU,
+        0xF1DD31F9U,0xB8D9C3D8U,0x63D4D5BBU,0x2AD0279AU,
+        0x1E328FEBU,0x57367DCAU,0x8C3B6BA9U,0xC53F9988U,
+        0x3FCD319EU,0x76C9C3BFU,0xADC4D5DCU,0xE4C027FDU,
+        0x5DCDF301U,0x14C90120U,0xCFC41743U,0x86C0E562U,
+        0x7C324D74U,0x3536BF55U,0xEE3BA936U,0xA73F5B17U,
+        0x99CC763FU,0xD0C8841EU,0x0BC5927DU,0x42C1605CU,
+        0xB833C84AU,0xF1373A6BU,0x2A3A2C08U,0x633EDE29U,
+        0xDA330AD5U,0x9337F8F4U,0x483AEE97U,0x013E1CB6U,
+        0xFBCCB4A0U,0xB2C84681U,0x69C550E2U,0x20C1A2C3U,
+        0x28461564U,0x6142E745U,0xBA4FF126U,0xF34B0307U,
+        0x09B9AB11U,0x40BD5930U,0x9BB04F53U,0xD2B4BD72U,
+        0x6BB9698EU,0x22BD9BAFU,0xF9B08DCCU,0xB0B47FEDU,
+        0x4A46D7FBU,0x034225DAU,0xD84F33B9U,0x914BC198U,
+        0xAFB8ECB0U,0xE6BC1E91U,0x3DB108F2U,0x74B5FAD3U,
+        0x8E4752C5U,0xC743A0E4U,0x1C4EB687U,0x554A44A6U,
+        0xEC47905AU,0xA543627BU,0x7E4E7418U,0x374A8639U,
+        0xCDB82E2FU,0x84BCDC0EU,0x5FB1CA6DU,0x16B5384CU,
+        0x2257903DU,0x6B53621CU,0xB05E747FU,0xF95A865EU,
+        0x03A82E48U,0x4AACDC69U,0x91A1CA0AU,0xD8A5382BU,
+        0x61A8ECD7U,0x28AC1EF6U,0xF3A10895U,0xBAA5FAB4U,
+        0x405752A2U,0x0953A083U,0xD25EB6E0U,0x9B5A44C1U,
+        0xA5A969E9U,0xECAD9BC8U,0x37A08DABU,0x7EA47F8AU,
+        0x8456D79CU,0xCD5225BDU,0x165F33DEU,0x5F5BC1FFU,
+        0xE6561503U,0xAF52E722U,0x745FF141U,0x3D5B0360U,
+        0xC7A9AB76U,0x8EAD5957U,0x55A04F34U,0x1CA4BD15U,
+        0x3C651FD6U,0x7561EDF7U,0xAE6CFB94U,0xE76809B5U,
+        0x1D9AA1A3U,0x549E5382U,0x8F9345E1U,0xC697B7C0U,
+        0x7F9A633CU,0x369E911DU,0xED93877EU,0xA497755FU,
+        0x5E65DD49U,0x17612F68U,0xCC6C390BU,0x8568CB2AU,
+        0xBB9BE602U,0xF29F1423U,0x29920240U,0x6096F061U,
+        0x9A645877U,0xD360AA56U,0x086DBC35U,0x41694E14U,
+        0xF8649AE8U,0xB16068C9U,0x6A6D7EAAU,0x23698C8BU,
+        0xD99B249DU,0x909FD6BCU,0x4B92C0DFU,0x029632FEU,
+        0x36749A8FU,0x7F7068AEU,0xA47D7ECDU,0xED798CECU,
+        0x178B24FAU,0x5E8FD6DBU,0x8582C0B8U,0xCC863299U,
+        0x758BE665U,0x3C8F1444U,0xE7820227U,0xAE86F006U,
+        0x54745810U,0x1D70AA31U,0xC67DBC52U,0x8F794E73U,
+        0xB18A635BU,0xF88E917AU,0x23838719U,0x6A877538U,
+        0x9075DD2EU,0xD9712F0FU,0x027C396CU,0x4B78CB4DU,
+        0xF2751FB1U,0xBB71ED90U,0x607CFBF3U,0x297809D2U,
+        0xD38AA1C4U,0x9A8E53E5U,0x41834586U,0x0887B7A7U
+    }
+};
+
+
+/** Advances a raw CRC32C over CRC32C_SHORT zero bytes, one byte of the CRC per row */
+const uint32_t crc32c_short_shift[4][256] = {
+    {
+        0x00000000U,0xDCB17AA4U,0xBC8E83B9U,0x603FF91DU,
+        0x7CF17183U,0xA0400B27U,0xC07FF23AU,0x1CCE889EU,
+        0xF9E2E306U,0x255399A2U,0x456C60BFU,0x99DD1A1BU,
+        0x85139285U,0x59A2E821U,0x399D113CU,0xE52C6B98U,
+        0xF629B0FDU,0x2A98CA59U,0x4AA73344U,0x961649E0U,
+        0x8AD8C17EU,0x5669BBDAU,0x365642C7U,0xEAE73863U,
+        0x0FCB53FBU,0xD37A295FU,0xB345D042U,0x6FF4AAE6U,
+        0x733A2278U,0xAF8B58DCU,0xCFB4A1C1U,0x1305DB65U,
+        0xE9BF170BU,0x350E6DAFU,0x553194B2U,0x8980EE16U,
+        0x954E6688U,0x49FF1C2CU,0x29C0E531U,0xF5719F95U,
+        0x105DF40DU,0xCCEC8EA9U,0xACD377B4U,0x70620D10U,
+        0x6CAC858EU,0xB01DFF2AU,0xD0220637U,0x0C937C93U,
+        0x1F96A7F6U,0xC327DD52U,0xA318244FU,0x7FA95EEBU,
+        0x6367D675U,0xBFD6ACD1U,0xDFE955CCU,0x03582F68U,
+        0xE67444F0U,0x3AC53E54U,0x5AFAC749U,0x864BBDEDU,
+        0x9A853573U,0x46344FD7U,0x260BB6CAU,0xFABACC6EU,
+        0xD69258E7U,0x0A232243U,0x6A1CDB5EU,0xB6ADA1FAU,
+        0xAA632964U,0x76D253C0U,0x16EDAADDU,0xCA5CD079U,
+        0x2F70BBE1U,0xF3C1C145U,0x93FE3858U,0x4F4F42FCU,
+        0x5381CA62U,0x8F30B0C6U,0xEF0F49DBU,0x33BE337FU,
+        0x20BBE81AU,0xFC0A92BEU,0x9C356BA3U,0x40841107U,
+        0x5C4A9999U,0x80FBE33DU,0xE0C41A20U,0x3C756084U,
+        0xD9590B1CU,0x05E871B8U,0x65D788A5U,0xB966F201U,
+        0xA5A87A9FU,0x7919003BU,0x1926F926U,0xC5978382U,
+        0x3F2D4FECU,0xE39C3548U,0x83A3CC55U,0x5F12B6F1U,
+        0x43DC3E6FU,0x9F6D44CBU,0xFF52BDD6U,0x23E3C772U,
+        0xC6CFACEAU,0x1A7ED64EU,0x7A412F53U,0xA6F055F7U,
+        0xBA3EDD69U,0x668FA7CDU,0x06B05ED0U,0xDA012474U,
+        0xC904FF11U,0x15B585B5U,0x758A7CA8U,0xA93B060CU,
+        0xB5F58E92U,0x6944F436U,0x097B0D2BU,0xD5CA778FU,
+        0x30E61C17U,0xEC5766B3U,0x8C689FAEU,0x50D9E50AU,
+        0x4C176D94U,0x90A61730U,0xF099EE2DU,0x2C289489U,
+        0xA8C8C73FU,0x7479BD9BU,0x14464486U,0xC8F73E22U,
+        0xD439B6BCU,0x0888CC18U,0x68B73505U,0xB4064FA1U,
+        0x512A2439U,0x8D9B5E9DU,0xEDA4A780U,0x3115DD24U,
+        0x2DDB55BAU,0xF16A2F1EU,0x9155D603U,0x4DE4ACA7U,
+        0x5EE177C2U,0x82500D66U,0xE26FF47BU,0x3EDE8EDFU,
+        0x22100641U,0xFEA17CE5U,0x9E9E85F8U,0x422FFF5CU,
+        0xA70394C4U,0x7BB2EE60U,0x1B8D177DU,0xC73C6DD9U,
+        0xDBF2E547U,0x07439FE3U,0x677C66FEU,0xBBCD1C5AU,
+        0x4177D034U,0x9DC6AA90U,0xFDF9538DU,0x21482929U,
+        0x3D86A1B7U,0xE137DB13U,0x8108220EU,0x5DB958AAU,
+        0xB8953332U,0x64244996U,0x041BB08BU,0xD8AACA2FU,
+        0xC46442B1U,0x18D53815U,0x78EAC108U,0xA45BBBACU,
+        0xB75E60C9U,0x6BEF1A6DU,0x0BD0E370U,0xD76199D4U,
+        0xCBAF114AU,0x171E6BEEU,0x772192F3U,0xAB90E857U,
+        0x4EBC83CFU,0x920DF96BU,0xF2320076U,0x2E837AD2U,
+        0x324DF24CU,0xEEFC88E8U,0x8EC371F5U,0x52720B51U,
+        0x7E5A9FD8U,0xA2EBE57CU,0xC2D41C61U,0x1E6566C5U,
+        0x02ABEE5BU,0xDE1A94FFU,0xBE256DE2U,0x62941746U,
+        0x87B87CDEU,0x5B09067AU,0x3B36FF67U,0xE78785C3U,
+        0xFB490D5DU,0x27F877F9U,0x47C78EE4U,0x9B76F440U,
+        0x88732F25U,0x54C25581U,0x34FDAC9CU,0xE84CD638U,
+        0xF4825EA6U,0x28332402U,0x480CDD1FU,0x94BDA7BBU,
+        0x7191CC23U,0xAD20B687U,0xCD1F4F9AU,0x11AE353EU,
+        0x0D60BDA0U,0xD1D1C704U,0xB1EE3E19U,0x6D5F44BDU,
+        0x97E588D3U,0x4B54F277U,0x2B6B0B6AU,0xF7DA71CEU,
+        0xEB14F950U,0x37A583F4U,0x579A7AE9U,0x8B2B004DU,
+        0x6E076BD5U,0xB2B61171U,0xD289E86CU,0x0E3892C8U,
+        0x12F61A56U,0xCE4760F2U,0xAE7899EFU,0x72C9E34BU,
+        0x61CC382EU,0xBD7D428AU,0xDD42BB97U,0x01F3C133U,
+        0x1D3D49ADU,0xC18C3309U,0xA1B3CA14U,0x7D02B0B0U,
+        0x982EDB28U,0x449FA18CU,0x24A05891U,0xF8112235U,
+        0xE4DFAAABU,0x386ED00FU,0x58512912U,0x84E053B6U
+    },
+    {
+        0x00000000U,0x547DF88FU,0xA8FBF11EU,0xFC860991U,
+        0x541B94CDU,0x00666C42U,0xFCE065D3U,0xA89D9D5CU,
+        0xA837299AU,0xFC4AD115U,0x00CCD884U,0x54B1200BU,
+        0xFC2CBD57U,0xA85145D8U,0x54D74C49U,0x00AAB4C6U,
+        0x558225C5U,0x01FFDD4AU,0xFD79D4DBU,0xA9042C54U,
+        0x0199B108U,0x55E44987U,0xA9624016U,0xFD1FB899U,
+        0xFDB50C5FU,0xA9C8F4D0U,0x554EFD41U,0x013305CEU,
+        0xA9AE9892U,0xFDD3601DU,0x0155698CU,0x55289103U,
+        0xAB044B8AU,0xFF79B305U,0x03FFBA94U,0x5782421BU,
+        0xFF1FDF47U,0xAB6227C8U,0x57E42E59U,0x0399D6D6U,
+        0x03336210U,0x574E9A9FU,0xABC8930EU,0xFFB56B81U,
+        0x5728F6DDU,0x03550E52U,0xFFD307C3U,0xABAEFF4CU,
+        0xFE866E4FU,0xAAFB96C0U,0x567D9F51U,0x020067DEU,
+        0xAA9DFA82U,0xFEE0020DU,0x02660B9CU,0x561BF313U,
+        0x56B147D5U,0x02CCBF5AU,0xFE4AB6CBU,0xAA374E44U,
+        0x02AAD318U,0x56D72B97U,0xAA512206U,0xFE2CDA89U,
+        0x53E4E1E5U,0x0799196AU,0xFB1F10FBU,0xAF62E874U,
+        0x07FF7528U,0x53828DA7U,0xAF048436U,0xFB797CB9U,
+        0xFBD3C87FU,0xAFAE30F0U,0x53283961U,0x0755C1EEU,
+        0xAFC85CB2U,0xFBB5A43DU,0x0733ADACU,0x534E5523U,
+        0x0666C420U,0x521B3CAFU,0xAE9D353EU,0xFAE0CDB1U,
+        0x527D50EDU,0x0600A862U,0xFA86A1F3U,0xAEFB597CU,
+        0xAE51EDBAU,0xFA2C1535U,0x06AA1CA4U,0x52D7E42BU,
+        0xFA4A7977U,0xAE3781F8U,0x52B18869U,0x06CC70E6U,
+        0xF8E0AA6FU,0xAC9D52E0U,0x501B5B71U,0x0466A3FEU,
+        0xACFB3EA2U,0xF886C62DU,0x0400CFBCU,0x507D3733U,
+        0x50D783F5U,0x04AA7B7AU,0xF82C72EBU,0xAC518A64U,
+        0x04CC1738U,0x50B1EFB7U,0xAC37E626U,0xF84A1EA9U,
+        0xAD628FAAU,0xF91F7725U,0x05997EB4U,0x51E4863BU,
+        0xF9791B67U,0xAD04E3E8U,0x5182EA79U,0x05FF12F6U,
+        0x0555A630U,0x51285EBFU,0xADAE572EU,0xF9D3AFA1U,
+        0x514E32FDU,0x0533CA72U,0xF9B5C3E3U,0xADC83B6CU,
+        0xA7C9C3CAU,0xF3B43B45U,0x0F3232D4U,0x5B4FCA5BU,
+        0xF3D25707U,0xA7AFAF88U,0x5B29A619U,0x0F545E96U,
+        0x0FFEEA50U,0x5B8312DFU,0xA7051B4EU,0xF378E3C1U,
+        0x5BE57E9DU,0x0F988612U,0xF31E8F83U,0xA763770CU,
+        0xF24BE60FU,0xA6361E80U,0x5AB01711U,0x0ECDEF9EU,
+        0xA65072C2U,0xF22D8A4DU,0x0EAB83DCU,0x5AD67B53U,
+        0x5A7CCF95U,0x0E01371AU,0xF2873E8BU,0xA6FAC604U,
+        0x0E675B58U,0x5A1AA3D7U,0xA69CAA46U,0xF2E152C9U,
+        0x0CCD8840U,0x58B070CFU,0xA436795EU,0xF04B81D1U,
+        0x58D61C8DU,0x0CABE402U,0xF02DED93U,0xA450151CU,
+        0xA4FAA1DAU,0xF0875955U,0x0C0150C4U,0x587CA84BU,
+        0xF0E13517U,0xA49CCD98U,0x581AC409U,0x0C673C86U,
+        0x594FAD85U,0x0D32550AU,0xF1B45C9BU,0xA5C9A414U,
+        0x0D543948U,0x5929C1C7U,0xA5AFC856U,0xF1D230D9U,
+        0xF178841FU,0xA5057C90U,0x59837501U,0x0DFE8D8EU,
+        0xA56310D2U,0xF11EE85DU,0x0D98E1CCU,0x59E51943U,
+        0xF42D222FU,0xA050DAA0U,0x5CD6D331U,0x08AB2BBEU,
+        0xA036B6E2U,0xF44B4E6DU,0x08CD47FCU,0x5CB0BF73U,
+        0x5C1A0BB5U,0x0867F33AU,0xF4E1FAABU,0xA09C0224U,
+        0x08019F78U,0x5C7C67F7U,0xA0FA6E66U,0xF48796E9U,
+        0xA1AF07EAU,0xF5D2FF65U,0x0954F6F4U,0x5D290E7BU,
+        0xF5B49327U,0xA1C96BA8U,0x5D4F6239U,0x09329AB6U,
+        0x09982E70U,0x5DE5D6FFU,0xA163DF6EU,0xF51E27E1U,
+        0x5D83BABDU,0x09FE4232U,0xF5784BA3U,0xA105B32CU,
+        0x5F2969A5U,0x0B54912AU,0xF7D298BBU,0xA3AF6034U,
+        0x0B32FD68U,0x5F4F05E7U,0xA3C90C76U,0xF7B4F4F9U,
+        0xF71E403FU,0xA363B8B0U,0x5FE5B121U,0x0B9849AEU,
+        0xA305D4F2U,0xF7782C7DU,0x0BFE25ECU,0x5F83DD63U,
+        0x0AAB4C60U,0x5ED6B4EFU,0xA250BD7EU,0xF62D45F1U,
+        0x5EB0D8ADU,0x0ACD2022U,0xF64B29B3U,0xA236D13CU,
+        0xA29C65FAU,0xF6E19D75U,0x0A6794E4U,0x5E1A6C6BU,
+        0xF687F137U,0xA2FA09B8U,0x5E7C0029U,0x0A01F8A6U
+    },
+    {
+        0x00000000U,0x4A7FF165U,0x94FFE2CAU,0xDE8013AFU,
+        0x2C13B365U,0x666C4200U,0xB8EC51AFU,0xF293A0CAU,
+        0x582766CAU,0x125897AFU,0xCCD88400U,0x86A77565U,
+        0x7434D5AFU,0x3E4B24CAU,0xE0CB3765U,0xAAB4C600U,
+        0xB04ECD94U,0xFA313CF1U,0x24B12F5EU,0x6ECEDE3BU,
+        0x9C5D7EF1U,0xD6228F94U,0x08A29C3BU,0x42DD6D5EU,
+        0xE869AB5EU,0xA2165A3BU,0x7C964994U,0x36E9B8F1U,
+        0xC47A183BU,0x8E05E95EU,0x5085FAF1U,0x1AFA0B94U,
+        0x6571EDD9U,0x2F0E1CBCU,0xF18E0F13U,0xBBF1FE76U,
+        0x49625EBCU,0x031DAFD9U,0xDD9DBC76U,0x97E24D13U,
+        0x3D568B13U,0x77297A76U,0xA9A969D9U,0xE3D698BCU,
+        0x11453876U,0x5B3AC913U,0x85BADABCU,0xCFC52BD9U,
+        0xD53F204DU,0x9F40D128U,0x41C0C287U,0x0BBF33E2U,
+        0xF92C9328U,0xB353624DU,0x6DD371E2U,0x27AC8087U,
+        0x8D184687U,0xC767B7E2U,0x19E7A44DU,0x53985528U,
+        0xA10BF5E2U,0xEB740487U,0x35F41728U,0x7F8BE64DU,
+        0xCAE3DBB2U,0x809C2AD7U,0x5E1C3978U,0x1463C81DU,
+        0xE6F068D7U,0xAC8F99B2U,0x720F8A1DU,0x38707B78U,
+        0x92C4BD78U,0xD8BB4C1DU,0x063B5FB2U,0x4C44AED7U,
+        0xBED70E1DU,0xF4A8FF78U,0x2A28ECD7U,0x60571DB2U,
+        0x7AAD1626U,0x30D2E743U,0xEE52F4ECU,0xA42D0589U,
+        0x56BEA543U,0x1CC15426U,0xC2414789U,0x883EB6ECU,
+        0x228A70ECU,0x68F58189U,0xB6759226U,0xFC0A6343U,
+        0x0E99C389U,0x44E632ECU,0x9A662143U,0xD019D026U,
+        0xAF92366BU,0xE5EDC70EU,0x3B6DD4A1U,0x711225C4U,
+        0x8381850EU,0xC9FE746BU,0x177E67C4U,0x5D0196A1U,
+        0xF7B550A1U,0xBDCAA1C4U,0x634AB26BU,0x2935430EU,
+        0xDBA6E3C4U,0x91D912A1U,0x4F59010EU,0x0526F06BU,
+        0x1FDCFBFFU,0x55A30A9AU,0x8B231935U,0xC15CE850U,
+        0x33CF489AU,0x79B0B9FFU,0xA730AA50U,0xED4F5B35U,
+        0x47FB9D35U,0x0D846C50U,0xD3047FFFU,0x997B8E9AU,
+        0x6BE82E50U,0x2197DF35U,0xFF17CC9AU,0xB5683DFFU,
+        0x902BC195U,0xDA5430F0U,0x04D4235FU,0x4EABD23AU,
+        0xBC3872F0U,0xF6478395U,0x28C7903AU,0x62B8615FU,
+        0xC80CA75FU,0x8273563AU,0x5CF34595U,0x168CB4F0U,
+        0xE41F143AU,0xAE60E55FU,0x70E0F6F0U,0x3A9F0795U,
+        0x20650C01U,0x6A1AFD64U,0xB49AEECBU,0xFEE51FAEU,
+        0x0C76BF64U,0x46094E01U,0x98895DAEU,0xD2F6ACCBU,
+        0x78426ACBU,0x323D9BAEU,0xECBD8801U,0xA6C27964U,
+        0x5451D9AEU,0x1E2E28CBU,0xC0AE3B64U,0x8AD1CA01U,
+        0xF55A2C4CU,0xBF25DD29U,0x61A5CE86U,0x2BDA3FE3U,
+        0xD9499F29U,0x93366E4CU,0x4DB67DE3U,0x07C98C86U,
+        0xAD7D4A86U,0xE702BBE3U,0x3982A84CU,0x73FD5929U,
+        0x816EF9E3U,0xCB110886U,0x15911B29U,0x5FEEEA4CU,
+        0x4514E1D8U,0x0F6B10BDU,0xD1EB0312U,0x9B94F277U,
+        0x690752BDU,0x2378A3D8U,0xFDF8B077U,0xB7874112U,
+        0x1D338712U,0x574C7677U,0x89CC65D8U,0xC3B394BDU,
+        0x31203477U,0x7B5FC512U,0xA5DFD6BDU,0xEFA027D8U,
+        0x5AC81A27U,0x10B7EB42U,0xCE37F8EDU,0x84480988U,
+        0x76DBA942U,0x3CA45827U,0xE2244B88U,0xA85BBAEDU,
+        0x02EF7CEDU,0x48908D88U,0x96109E27U,0xDC6F6F42U,
+        0x2EFCCF88U,0x64833EEDU,0xBA032D42U,0xF07CDC27U,
+        0xEA86D7B3U,0xA0F926D6U,0x7E793579U,0x3406C41CU,
+        0xC69564D6U,0x8CEA95B3U,0x526A861CU,0x18157779U,
+        0xB2A1B179U,0xF8DE401CU,0x265E53B3U,0x6C21A2D6U,
+        0x9EB2021CU,0xD4CDF379U,0x0A4DE0D6U,0x403211B3U,
+        0x3FB9F7FEU,0x75C6069BU,0xAB461534U,0xE139E451U,
+        0x13AA449BU,0x59D5B5FEU,0x8755A651U,0xCD2A5734U,
+        0x679E9134U,0x2DE16051U,0xF36173FEU,0xB91E829BU,
+        0x4B8D2251U,0x01F2D334U,0xDF72C09BU,0x950D31FEU,
+        0x8FF73A6AU,0xC588CB0FU,0x1B08D8A0U,0x517729C5U,
+        0xA3E4890FU,0xE99B786AU,0x371B6BC5U,0x7D649AA0U,
+        0xD7D05CA0U,0x9DAFADC5U,0x432FBE6AU,0x09504F0FU,
+        0xFBC3EFC5U,0xB1BC1EA0U,0x6F3C0D0FU,0x2543FC6AU
+    },
+    {
+        0x00000000U,0x25BBF5DBU,0x4B77EBB6U,0x6ECC1E6DU,
+        0x96EFD76CU,0xB35422B7U,0xDD983CDAU,0xF823C901U,
+        0x2833D829U,0x0D882DF2U,0x6344339FU,0x46FFC644U,
+        0xBEDC0F45U,0x9B67FA9EU,0xF5ABE4F3U,0xD0101128U,
+        0x5067B052U,0x75DC4589U,0x1B105BE4U,0x3EABAE3FU,
+        0xC688673EU,0xE33392E5U,0x8DFF8C88U,0xA8447953U,
+        0x7854687BU,0x5DEF9DA0U,0x332383CDU,0x16987616U,
+        0xEEBBBF17U,0xCB004ACCU,0xA5CC54A1U,0x8077A17AU,
+        0xA0CF60A4U,0x8574957FU,0xEBB88B12U,0xCE037EC9U,
+        0x3620B7C8U,0x139B4213U,0x7D575C7EU,0x58ECA9A5U,
+        0x88FCB88DU,0xAD474D56U,0xC38B533BU,0xE630A6E0U,
+        0x1E136FE1U,0x3BA89A3AU,0x55648457U,0x70DF718CU,
+        0xF0A8D0F6U,0xD513252DU,0xBBDF3B40U,0x9E64CE9BU,
+        0x6647079AU,0x43FCF241U,0x2D30EC2CU,0x088B19F7U,
+        0xD89B08DFU,0xFD20FD04U,0x93ECE369U,0xB65716B2U,
+        0x4E74DFB3U,0x6BCF2A68U,0x05033405U,0x20B8C1DEU,
+        0x4472B7B9U,0x61C94262U,0x0F055C0FU,0x2ABEA9D4U,
+        0xD29D60D5U,0xF726950EU,0x99EA8B63U,0xBC517EB8U,
+        0x6C416F90U,0x49FA9A4BU,0x27368426U,0x028D71FDU,
+        0xFAAEB8FCU,0xDF154D27U,0xB1D9534AU,0x9462A691U,
+        0x141507EBU,0x31AEF230U,0x5F62EC5DU,0x7AD91986U,
+        0x82FAD087U,0xA741255CU,0xC98D3B31U,0xEC36CEEAU,
+        0x3C26DFC2U,0x199D2A19U,0x77513474U,0x52EAC1AFU,
+        0xAAC908AEU,0x8F72FD75U,0xE1BEE318U,0xC40516C3U,
+        0xE4BDD71DU,0xC10622C6U,0xAFCA3CABU,0x8A71C970U,
+        0x72520071U,0x57E9F5AAU,0x3925EBC7U,0x1C9E1E1CU,
+        0xCC8E0F34U,0xE935FAEFU,0x87F9E482U,0xA2421159U,
+        0x5A61D858U,0x7FDA2D83U,0x111633EEU,0x34ADC635U,
+        0xB4DA674FU,0x91619294U,0xFFAD8CF9U,0xDA167922U,
+        0x2235B023U,0x078E45F8U,0x69425B95U,0x4CF9AE4EU,
+        0x9CE9BF66U,0xB9524ABDU,0xD79E54D0U,0xF225A10BU,
+        0x0A06680AU,0x2FBD9DD1U,0x417183BCU,0x64CA7667U,
+        0x88E56F72U,0xAD5E9AA9U,0xC39284C4U,0xE629711FU,
+        0x1E0AB81EU,0x3BB14DC5U,0x557D53A8U,0x70C6A673U,
+        0xA0D6B75BU,0x856D4280U,0xEBA15CEDU,0xCE1AA936U,
+        0x36396037U,0x138295ECU,0x7D4E8B81U,0x58F57E5AU,
+        0xD882DF20U,0xFD392AFBU,0x93F53496U,0xB64EC14DU,
+        0x4E6D084CU,0x6BD6FD97U,0x051AE3FAU,0x20A11621U,
+        0xF0B10709U,0xD50AF2D2U,0xBBC6ECBFU,0x9E7D1964U,
+        0x665ED065U,0x43E525BEU,0x2D293BD3U,0x0892CE08U,
+        0x282A0FD6U,0x0D91FA0DU,0x635DE460U,0x46E611BBU,
+        0xBEC5D8BAU,0x9B7E2D61U,0xF5B2330CU,0xD009C6D7U,
+        0x0019D7FFU,0x25A22224U,0x4B6E3C49U,0x6ED5C992U,
+        0x96F60093U,0xB34DF548U,0xDD81EB25U,0xF83A1EFEU,
+        0x784DBF84U,0x5DF64A5FU,0x333A5432U,0x1681A1E9U,
+        0xEEA268E8U,0xCB199D33U,0xA5D5835EU,0x806E7685U,
+        0x507E67ADU,0x75C59276U,0x1B098C1BU,0x3EB279C0U,
+        0xC691B0C1U,0xE32A451AU,0x8DE65B77U,0xA85DAEACU,
+        0xCC97D8CBU,0xE92C2D10U,0x87E0337DU,0xA25BC6A6U,
+        0x5A780FA7U,0x7FC3FA7CU,0x110FE411U,0x34B411CAU,
+        0xE4A400E2U,0xC11FF539U,0xAFD3EB54U,0x8A681E8FU,
+        0x724BD78EU,0x57F02255U,0x393C3C38U,0x1C87C9E3U,
+        0x9CF06899U,0xB94B9D42U,0xD787832FU,0xF23C76F4U,
+        0x0A1FBFF5U,0x2FA44A2EU,0x41685443U,0x64D3A198U,
+        0xB4C3B0B0U,0x9178456BU,0xFFB45B06U,0xDA0FAEDDU,
+        0x222C67DCU,0x07979207U,0x695B8C6AU,0x4CE079B1U,
+        0x6C58B86FU,0x49E34DB4U,0x272F53D9U,0x0294A602U,
+        0xFAB76F03U,0xDF0C9AD8U,0xB1C084B5U,0x947B716EU,
+        0x446B6046U,0x61D0959DU,0x0F1C8BF0U,0x2AA77E2BU,
+        0xD284B72AU,0xF73F42F1U,0x99F35C9CU,0xBC48A947U,
+        0x3C3F083DU,0x1984FDE6U,0x7748E38BU,0x52F31650U,
+        0xAAD0DF51U,0x8F6B2A8AU,0xE1A734E7U,0xC41CC13CU,
+        0x140CD014U,0x31B725CFU,0x5F7B3BA2U,0x7AC0CE79U,
+        0x82E30778U,0xA758F2A3U,0xC994ECCEU,0xEC2F1915U
+    }
+};
+
+/** x^(2^k) modulo the reflected CRC32C polynomial for k = 0..63; Used by `crc32c_combine()` */
+const uint32_t crc32c_x2n_table[64] = {
+    0x40000000U, 0x20000000U, 0x08000000U, 0x00800000U,
+    0x00008000U, 0x82F63B78U, 0x6EA2D55CU, 0x18B8EA18U,
+    0x510AC59AU, 0xB82BE955U, 0xB8FDB1E7U, 0x88E56F72U,
+    0x74C360A4U, 0xE4172B16U, 0x0D65762AU, 0x35D73A62U,
+    0x28461564U, 0xBF455269U, 0xE2EA32DCU, 0xFE7740E6U,
+    0xF946610BU, 0x3C204F8FU, 0x538586E3U, 0x59726915U,
+    0x734D5309U, 0xBC1AC763U, 0x7D0722CCU, 0xD289CABEU,
+    0xE94CA9BCU, 0x05B74F3FU, 0xA51E1F42U, 0x40000000U,
+    0x20000000U, 0x08000000U, 0x00800000U, 0x00008000U,
+    0x82F63B78U, 0x6EA2D55CU, 0x18B8EA18U, 0x510AC59AU,
+    0xB82BE955U, 0xB8FDB1E7U, 0x88E56F72U, 0x74C360A4U,
+    0xE4172B16U, 0x0D65762AU, 0x35D73A62U, 0x28461564U,
+    0xBF455269U, 0xE2EA32DCU, 0xFE7740E6U, 0xF946610BU,
+    0x3C204F8FU, 0x538586E3U, 0x59726915U, 0x734D5309U,
+    0xBC1AC763U, 0x7D0722CCU, 0xD289CABEU, 0xE94CA9BCU,
+    0x05B74F3FU, 0xA51E1F42U, 0x40000000U, 0x20000000U
+};
+
+
 /** Table of constants needed by some cryptography functions */
 const uint8_t Sbox[256] = {
     0x02, 0x03, 0x05, 0x07, 0x0B, 0x0D, 0x11, 0x13,
@@ -632,154 +2871,192 @@ const u32 ANUBIS_RC[] = {
 /* FUNCTIONS */
 
 
-/** Return a random integer */
-int randomint(void) {
-#   ifdef OSPOSIX
-    struct timeval tmstrct;
-    gettimeofday(&tmstrct, NULL);
-    srand((unsigned int)(tmstrct.tv_usec * tmstrct.tv_sec));
-#   else
-    srand((unsigned int)time(NULL) * (unsigned int)clock());
-#   endif
-    return (int)rand();
+/** Private Function: Advance a SplitMix64 sequence and return its next output; Used to expand seeds */
+static uint64_t splitmix64(uint64_t *__restrict__ x) {
+    register uint64_t z = (*x += 0x9E3779B97F4A7C15ULL);
+    z = ((z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL);
+    z = ((z ^ (z >> 27)) * 0x94D049BB133111EBULL);
+    return (z ^ (z >> 31));
 }
 
 
-/** Return a random unsigned long int */
-ulint randomlong(void) {
-#   ifdef OSPOSIX
-    struct timeval tmstrct;
-    gettimeofday(&tmstrct, NULL);
-    srand((unsigned int)((ulint)tmstrct.tv_usec ^ ((ulint)tmstrct.tv_usec * (ulint)tmstrct.tv_sec)));
-#   else
-    srand((unsigned int)(((ulint)time(NULL) + 0x01) | ((ulint)time(NULL) * (ulint)clock())));
-#   endif
-    ulint rand_num1 = (ulint)rand();
+/** Seed a xoshiro256** generator from one 64-bit value (through SplitMix64, so that similar seeds give unrelated streams) */
+void prng_seed(prng_state *__restrict__ state, const uint64_t seed) {
+    uint64_t x = seed;
+    state->s[0] = splitmix64(&x);
+    state->s[1] = splitmix64(&x);
+    state->s[2] = splitmix64(&x);
+    state->s[3] = splitmix64(&x);
+}
+
+
+/** Return the next 64-bit output of a xoshiro256** generator */
+uint64_t prng_next(prng_state *__restrict__ state) {
+#   define PRNG_ROTL(x, k)   (((x) << (k)) | ((x) >> (64 - (k))))
+    uint64_t *s = state->s;
+    const uint64_t result = (PRNG_ROTL((s[1] * 5), 7) * 9);
+    const uint64_t t = (s[1] << 17);
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = PRNG_ROTL(s[3], 45);
+    return result;
+#   undef PRNG_ROTL
+}
+
+
+/** Private Function: Advance a generator by the polynomial `jump` */
+static void prng_apply_jump(prng_state *__restrict__ state, const uint64_t jump[4]) {
+    uint64_t s0 = 0x0, s1 = 0x0, s2 = 0x0, s3 = 0x0;
+    register unsigned int i, b;
+    for (i = 0x0; i < 4; ++i) {
+        for (b = 0x0; b < 64; ++b) {
+            if (jump[i] & ((uint64_t)1 << b)) {
+                s0 ^= state->s[0];
+                s1 ^= state->s[1];
+                s2 ^= state->s[2];
+                s3 ^= state->s[3];
+            }
+            (void)prng_next(state);
+        }
+    }
+    state->s[0] = s0;
+    state->s[1] = s1;
+    state->s[2] = s2;
+    state->s[3] = s3;
+}
+
+
+/** Advance a generator by 2^128 outputs; Successive jumps from one seed give up to 2^128 non-overlapping streams for parallel workers */
+void prng_jump(prng_state *__restrict__ state) {
+    static const uint64_t jump[4] = { 0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL };
+    prng_apply_jump(state, jump);
+}
+
+
+/** Advance a generator by 2^192 outputs (one stream per process or machine, each split further with `prng_jump()`) */
+void prng_long_jump(prng_state *__restrict__ state) {
+    static const uint64_t jump[4] = { 0x76E15D3EFEFDCBBFULL, 0xC5004E441C522FB3ULL, 0x77710069854EE241ULL, 0x39109BB02ACBE635ULL };
+    prng_apply_jump(state, jump);
+}
+
+
+/** Fill `len` bytes of `buf` with generator output (eight bytes per step) */
+void prng_fill(prng_state *__restrict__ state, void *__restrict__ buf, size_t len) {
+    uint8_t *bytes = (uint8_t *)buf;
+    uint64_t word;
+    while (len >= 8) {
+        word = prng_next(state);
+        memcpy(bytes, &word, 8);
+        bytes += 8;
+        len -= 8;
+    }
+    if (len) {
+        word = prng_next(state);
+        memcpy(bytes, &word, len);
+    }
+}
+
+
+/** Return this thread's generator, seeded on first use from the clock, the address of the state (which differs between threads), and a process-wide counter */
+prng_state *prng_thread_state(void) {
+    static PRNG_THREAD_LOCAL prng_state state;
+    static PRNG_THREAD_LOCAL int seeded = 0;
+    static uint64_t instance = 0x0;
+    if (!seeded) {
+        uint64_t seed;
 #   ifdef OSPOSIX
-    gettimeofday(&tmstrct, NULL);
-    srand((unsigned int)((ulint)tmstrct.tv_usec ^ ((ulint)tmstrct.tv_usec * (ulint)tmstrct.tv_sec)));
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        seed = (((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec);
 #   else
-    srand((unsigned int)((((ulint)time(NULL) + 0x01) % ((ulint)clock() + 0x01)) | ((ulint)time(NULL) * (ulint)clock())));
+        seed = (((uint64_t)time(NULL) << 20) ^ (uint64_t)clock());
 #   endif
-    ulint rand_num2 = (ulint)rand();
-#   ifdef OSPOSIX
-    gettimeofday(&tmstrct, NULL);
-    srand((unsigned int)((ulint)tmstrct.tv_usec ^ ((ulint)tmstrct.tv_usec * (ulint)tmstrct.tv_sec)));
+#   ifdef __GNUC__
+        seed ^= (__atomic_fetch_add(&instance, 1, __ATOMIC_RELAXED) * 0xD1B54A32D192ED03ULL);
 #   else
-    srand((unsigned int)((((ulint)time(NULL) + 0x01) % ((ulint)clock() + 0x01)) | ((ulint)time(NULL) * (ulint)clock())));
+        seed ^= (instance++ * 0xD1B54A32D192ED03ULL);
 #   endif
-    return (ulint)((rand_num1 * (ulint)rand()) ^ rand_num2);
+        prng_seed(&state, (seed ^ (uint64_t)(uintptr_t)&state));
+        seeded = 1;
+    }
+    return &state;
+}
+
+
+/** Fill `len` bytes of `buf` from this thread's generator */
+void fill_random(void *__restrict__ buf, const size_t len) {
+    if (buf != NULL) prng_fill(prng_thread_state(), buf, len);
+}
+
+
+/** Return a random integer (0 to 2^31 - 1) */
+int randomint(void) {
+    return (int)(prng_next(prng_thread_state()) >> 33);
+}
+
+
+/** Return a random unsigned long int */
+ulint randomlong(void) {
+    return (ulint)prng_next(prng_thread_state());
+}
+
+
+/** Private Function: Return a `calloc()` buffer of `size` chars whose first `length` chars are drawn uniformly from the `setsize` chars of `charset` (two chars per generator output) */
+static char *random_charset(const size_t length, const size_t size, const char *__restrict__ charset, const uint32_t setsize) {
+    char *random_string = (char *)calloc(size, sizeof(char));
+    prng_state *state = prng_thread_state();
+    register uint64_t r;
+    register size_t i;
+    if (random_string == (char *)NULL) { return (char *)NULL; }
+    for (i = 0x00; (i + 0x01) < length; i += 0x02) {
+        r = prng_next(state);
+        random_string[i] = charset[((r & 0xFFFFFFFF) * setsize) >> 32];  // Multiply-shift maps 32 random bits onto the set
+        random_string[i + 1] = charset[((r >> 32) * setsize) >> 32];
+    }
+    if (i < length) random_string[i] = charset[((prng_next(state) >> 32) * setsize) >> 32];
+    return random_string;
 }
 
 
 /** Return a random string with the specified length; remember to `free()` random_string */
 char *randstr(const size_t length) {
-    char *random_string;
-    if (length) {
-        random_string = (char *)calloc((length + (size_t)1), sizeof(char));
-        if (random_string == (char *)NULL) { return (char *)NULL; }
-#       ifdef OSPOSIX
-        struct timeval tmstrct;
-        gettimeofday(&tmstrct, NULL);
-        srand((unsigned int)(tmstrct.tv_usec * tmstrct.tv_sec));
-#       else
-        srand((unsigned int)time(NULL) * (unsigned int)clock());
-#       endif
-        static char charset[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789<>,.?~`!@#$%^&*()-_+=[]{}|':;";
-        register ulint i;
-        for (i = 0x00; i < length; ++i) random_string[i] = charset[(int)(rand() % 91)];
-    } else { return (char *)NULL; }
-    random_string[length] = '\0';
-    return random_string;
+    static const char charset[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789<>,.?~`!@#$%^&*()-_+=[]{}|':;";
+    if (!length) { return (char *)NULL; }
+    return random_charset(length, (length + (size_t)1), charset, 91);
 }
 
 
 /** Return a random alphabetic string with the specified length; remember to `free()` random_string */
 char *randalphastr(const size_t length) {
-    char *random_string;
-    if (length) {
-        random_string = (char *)calloc((length + (size_t)1), sizeof(char));
-        if (random_string == (char *)NULL) { return (char *)NULL; }
-#       ifdef OSPOSIX
-        struct timeval tmstrct;
-        gettimeofday(&tmstrct, NULL);
-        srand((unsigned int)(tmstrct.tv_usec * tmstrct.tv_sec));
-#       else
-        srand((unsigned int)time(NULL) * (unsigned int)clock());
-#       endif
-        static char charset[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
-        register ulint i;
-        for (i = 0x00; i < length; ++i) random_string[i] = charset[(rand() % 52)];
-    } else { return (char *)NULL; }
-    random_string[length] = '\0';
-    return random_string;
+    static const char charset[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    if (!length) { return (char *)NULL; }
+    return random_charset(length, (length + (size_t)1), charset, 52);
 }
 
 
 /** Return a random alphanumeric string with the specified length; remember to `free()` random_string */
 char *randalphanumstr(const size_t length) {
-    char *random_string;
-    if (length) {
-        random_string = (char *)calloc((length + (size_t)1), sizeof(char));
-        if (random_string == (char *)NULL) { return (char *)NULL; }
-#       ifdef OSPOSIX
-        struct timeval tmstrct;
-        gettimeofday(&tmstrct, NULL);
-        srand((unsigned int)(tmstrct.tv_usec * tmstrct.tv_sec));
-#       else
-        srand((unsigned int)time(NULL) * (unsigned int)clock());
-#       endif
-        static char charset[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
-        register ulint i;
-        for (i = 0x00; i < length; ++i) random_string[i] = charset[(rand() % 62)];
-    } else { return (char *)NULL; }
-    random_string[length] = '\0';
-    return random_string;
+    static const char charset[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+    if (!length) { return (char *)NULL; }
+    return random_charset(length, (length + (size_t)1), charset, 62);
 }
 
 
 /** Return a random string with the specified length; supports larger strings; remember to `free()` random_string */
 char *randstrx(const uint64_t length) {
-    char *random_string;
-    if (length) {
-        random_string = (char *)calloc((size_t)(length + (uint64_t)0x01), sizeof(char));
-        if (random_string == (char *)NULL) { return (char *)NULL; }
-#       ifdef OSPOSIX
-        struct timeval tmstrct;
-        gettimeofday(&tmstrct, NULL);
-        srand((unsigned int)((ulint)tmstrct.tv_usec % ((ulint)tmstrct.tv_usec * (ulint)tmstrct.tv_sec)));
-#       else
-        srand((unsigned int)(((ulint)time(NULL)) % ((ulint)time(NULL) * (ulint)clock())));
-#       endif
-        static char charset[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 \"\n\t<>,.?/~`!@#$%^&*()-_+=[]{}|\\':;";
-        register uint64_t i;
-        for (i = (uint64_t)0x00; i < length; ++i) {
-            random_string[i] = charset[(rand() % 97)];
-        }
-    } else { return (char *)NULL; }
-    random_string[length] = '\0';
-    return random_string;
+    static const char charset[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 \"\n\t<>,.?/~`!@#$%^&*()-_+=[]{}|\\':;";
+    if (!length) { return (char *)NULL; }
+    return random_charset((size_t)length, (size_t)(length + (uint64_t)0x01), charset, 97);
 }
 
 
 /** Return a random 16384-bit string; remember to `free()` random_string */
 char *rand16384str(void) {
-    char *random_string;
-    random_string = (char *)calloc((size_t)16384, sizeof(char));
-    if (random_string == (char *)NULL) { return (char *)NULL; }
-#   ifdef OSPOSIX
-    struct timeval tmstrct;
-    gettimeofday(&tmstrct, NULL);
-    srand((unsigned int)((ulint)tmstrct.tv_usec | ((ulint)tmstrct.tv_usec * (ulint)tmstrct.tv_sec)));
-#   else
-    srand((unsigned int)((((ulint)time(NULL) + 0x01) / ((ulint)clock() + 0x01)) | ((ulint)time(NULL) * (ulint)clock())));
-#   endif
     static const char charset[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 \"\n\t<>,.?/~`!@#$%^&*()-_+=[]{}|\\':;";
-    register uint32_t i;
-    for (i = 0x00; i < 16384; ++i) {
-        random_string[i] = charset[(rand() % 97)];
-    }
-    return random_string;
+    return random_charset((size_t)16384, (size_t)16384, charset, 97);
 }
 
 
@@ -814,32 +3091,212 @@ uint64_t endianswap64(uint64_t x) {
 }
 
 
-/** Shuffle the int array; must have multiple array items and initialize srand() */
-void shuffle_int(signed int *__restrict__ array, const size_t num_items) {
-    if (num_items > (size_t)0x02) {
-        register size_t i, j;
-        register signed int t;
-        for (i = 0x00; i < (num_items - 0x01); ++i) {
-            j = (i + (size_t)(((size_t)rand() + 0x01) / ((size_t)RAND_MAX / (num_items - i) + 0x01)));
-            t = array[j];
-            array[j] = array[i];
-            array[i] = t;
+/** Return a uniform random integer in `[0, range)` (0 if `range` is 0) using Lemire's multiply-shift with rejection; Divides only when a draw lands in the biased sliver */
+uint32_t prng_bounded32(prng_state *__restrict__ state, const uint32_t range) {
+    register uint64_t m = ((prng_next(state) >> 32) * (uint64_t)range);
+    register uint32_t low = (uint32_t)m;
+    if (low < range) {
+        const uint32_t threshold = ((uint32_t)(-range) % range);
+        while (low < threshold) {
+            m = ((prng_next(state) >> 32) * (uint64_t)range);
+            low = (uint32_t)m;
+        }
+    }
+    return (uint32_t)(m >> 32);
+}
+
+
+/** Return a uniform random integer in `[0, range)` (0 if `range` is 0); 64-bit version of `prng_bounded32()` */
+uint64_t prng_bounded(prng_state *__restrict__ state, const uint64_t range) {
+#   ifdef UINT128_SUPPORTED
+    register uint128_t m = ((uint128_t)prng_next(state) * (uint128_t)range);
+    register uint64_t low = (uint64_t)m;
+    if (low < range) {
+        const uint64_t threshold = ((uint64_t)(-range) % range);
+        while (low < threshold) {
+            m = ((uint128_t)prng_next(state) * (uint128_t)range);
+            low = (uint64_t)m;
         }
     }
+    return (uint64_t)(m >> 64);
+#   else
+    register uint64_t r;
+    if (range == 0x0) return 0x0;
+    const uint64_t threshold = ((uint64_t)(-range) % range);
+    do { r = prng_next(state); } while (r < threshold);
+    return (r % range);
+#   endif
 }
 
 
-/** Shuffle the uint32_t array; must have multiple array items and initialize srand() */
+/** Shuffle the int array (unbiased Fisher-Yates on this thread's generator) */
+void shuffle_int(signed int *__restrict__ array, const size_t num_items) {
+    prng_state *state = prng_thread_state();
+    register size_t i, j;
+    register signed int t;
+    for (i = num_items; i > 0x01; --i) {
+        j = ((i <= 0xFFFFFFFF) ? (size_t)prng_bounded32(state, (uint32_t)i) : (size_t)prng_bounded(state, (uint64_t)i));
+        t = array[j];
+        array[j] = array[i - 1];
+        array[i - 1] = t;
+    }
+}
+
+
+/** Private Function: Unbiased Fisher-Yates shuffle of at most 2^32 items */
+static void fisher_yates_uint32(uint32_t *__restrict__ array, const size_t num_items, prng_state *__restrict__ state) {
+    register size_t i, j;
+    register uint32_t t;
+    for (i = num_items; i > 0x01; --i) {
+        j = (size_t)prng_bounded32(state, (uint32_t)i);
+        t = array[j];
+        array[j] = array[i - 1];
+        array[i - 1] = t;
+    }
+}
+
+
+/** Shuffle the uint32_t array (unbiased Fisher-Yates on this thread's generator) */
 void shuffle_uint32(uint32_t *__restrict__ array, const uint32_t num_items) {
-    if (num_items > (uint32_t)0x02) {
-        register uint32_t i, j, t;
-        for (i = 0x00; i < (num_items - (uint32_t)0x01); ++i) {
-            j = (i + (((uint32_t)rand() + 0x01) / (uint32_t)(RAND_MAX / (num_items - i) + (uint32_t)0x01)));
-            t = array[j];
-            array[j] = array[i];
-            array[i] = t;
+    fisher_yates_uint32(array, (size_t)num_items, prng_thread_state());
+}
+
+
+/** Private Function: MergeShuffle merge; Turn the shuffled runs `[0, mid)` and `[mid, num_items)` into one uniformly shuffled run with one random bit per element, then insert the leftovers Fisher-Yates style */
+static void merge_shuffle_merge(uint32_t *__restrict__ array, const size_t mid, const size_t num_items, prng_state *__restrict__ state) {
+    register size_t i = 0x0, j = mid;
+    register uint64_t bits = 0x0;
+    register unsigned int nbits = 0x0;
+    register uint32_t t;
+    for (;;) {
+        if (nbits == 0x0) {
+            bits = prng_next(state);
+            nbits = 64;
+        }
+        --nbits;
+        if (bits & 0x1) {
+            if (j == num_items) break;
+            t = array[i];
+            array[i] = array[j];
+            array[j] = t;
+            ++j;
+        } else if (i == j) {
+            break;
+        }
+        bits >>= 1;
+        ++i;
+    }
+    for (; i < num_items; ++i) {
+        j = ((i < 0xFFFFFFFF) ? (size_t)prng_bounded32(state, (uint32_t)(i + 1)) : (size_t)prng_bounded(state, (uint64_t)(i + 1)));
+        t = array[i];
+        array[i] = array[j];
+        array[j] = t;
+    }
+}
+
+
+/** Work of one `shuffle_uint32_parallel()` thread in one phase */
+typedef struct shuffle_job {
+    uint32_t *array;
+    size_t num_items;
+    size_t span;  // Zero to shuffle blocks; Otherwise the length of the runs to merge pairwise
+    unsigned int worker, num_workers;  // Runs (or blocks) `worker`, `worker + num_workers`, ... belong to this job
+    prng_state state;  // Private stream of this worker (`prng_jump()` apart)
+} shuffle_job;
+
+
+/** Private Function: Run one `shuffle_job` (a thread entry point) */
+static void *shuffle_worker(void *arg) {
+    shuffle_job *job = (shuffle_job *)arg;
+    register size_t start, len;
+    if (job->span == 0x0) {
+        for (start = ((size_t)job->worker * SHUFFLE_BLOCK); start < job->num_items; start += ((size_t)job->num_workers * SHUFFLE_BLOCK)) {
+            len = (((job->num_items - start) < SHUFFLE_BLOCK) ? (job->num_items - start) : SHUFFLE_BLOCK);
+            fisher_yates_uint32(job->array + start, len, &job->state);
+        }
+    } else {
+        for (start = ((size_t)job->worker * (job->span << 1)); (start + job->span) < job->num_items; start += ((size_t)job->num_workers * (job->span << 1))) {
+            len = (((job->num_items - start) < (job->span << 1)) ? (job->num_items - start) : (job->span << 1));
+            merge_shuffle_merge(job->array + start, job->span, len, &job->state);
         }
     }
+    return NULL;
+}
+
+
+/**
+    Shuffle a large uint32_t array with MergeShuffle: cache-sized blocks are shuffled independently, then neighbouring runs are merged pairwise, each level in parallel
+    @param[in] num_threads    Worker threads (0 for one per online CPU); Without pthreads, or under SHUFFLE_PARALLEL_MIN items, the shuffle runs on the calling thread
+*/
+void shuffle_uint32_parallel(uint32_t *__restrict__ array, const size_t num_items, unsigned int num_threads) {
+    const size_t nblocks = ((num_items + (SHUFFLE_BLOCK - 1)) / SHUFFLE_BLOCK);
+    shuffle_job *jobs, fallback;
+    register unsigned int i;
+    size_t span;
+    if (num_items < SHUFFLE_PARALLEL_MIN) {
+        fisher_yates_uint32(array, num_items, prng_thread_state());
+        return;
+    }
+#   ifdef OSPOSIX
+    if (num_threads == 0x0) {
+        const long online = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = ((online > 0L) ? (unsigned int)online : 0x1);
+    }
+#   endif
+#   ifndef __PTHREAD_ENABLED__
+    num_threads = 0x1;
+#   endif
+    if (num_threads == 0x0) num_threads = 0x1;
+    if ((size_t)num_threads > nblocks) num_threads = (unsigned int)nblocks;
+    if (num_threads == 0x1 && num_items <= 0xFFFFFFFF) {  // The merge levels only pay off when they run in parallel
+        fisher_yates_uint32(array, num_items, prng_thread_state());
+        return;
+    }
+    jobs = (shuffle_job *)calloc((size_t)num_threads, sizeof(shuffle_job));
+    if (jobs == (shuffle_job *)NULL) {
+        jobs = &fallback;
+        num_threads = 0x1;
+    }
+    for (i = 0x0; i < num_threads; ++i) {
+        jobs[i].array = array;
+        jobs[i].num_items = num_items;
+        jobs[i].worker = i;
+        jobs[i].num_workers = num_threads;
+        jobs[i].state = ((i == 0x0) ? *prng_thread_state() : jobs[i - 1].state);
+        prng_jump(&jobs[i].state);
+    }
+    *prng_thread_state() = jobs[num_threads - 1].state;  // Later calls on this thread must not replay a worker's stream
+    prng_jump(prng_thread_state());
+#   ifdef __PTHREAD_ENABLED__
+    pthread_t *threads = (pthread_t *)calloc((size_t)num_threads, sizeof(pthread_t));
+    uint8_t *spawned = (uint8_t *)calloc((size_t)num_threads, 0x1);
+#   endif
+    for (span = 0x0; span == 0x0 || span < num_items; span = ((span == 0x0) ? SHUFFLE_BLOCK : (span << 1))) {
+        jobs[0].span = span;  // Each job takes the span as it is dispatched
+#   ifdef __PTHREAD_ENABLED__
+        if (threads != (pthread_t *)NULL && spawned != (uint8_t *)NULL) {
+            for (i = 0x1; i < num_threads; ++i) {
+                jobs[i].span = span;
+                spawned[i] = (uint8_t)(pthread_create(&threads[i], NULL, shuffle_worker, &jobs[i]) == 0x0);
+                if (!spawned[i]) (void)shuffle_worker(&jobs[i]);
+            }
+            (void)shuffle_worker(&jobs[0]);
+            for (i = 0x1; i < num_threads; ++i) {
+                if (spawned[i]) (void)pthread_join(threads[i], NULL);
+            }
+            continue;
+        }
+#   endif
+        for (i = 0x0; i < num_threads; ++i) {
+            jobs[i].span = span;
+            (void)shuffle_worker(&jobs[i]);
+        }
+    }
+#   ifdef __PTHREAD_ENABLED__
+    free(threads);
+    free(spawned);
+#   endif
+    if (jobs != &fallback) free(jobs);
 }
 
 
@@ -1036,6 +3493,132 @@ void nxor_cipher(char *__restrict__ data, const char *__restrict__ password) {
 }
 
 
+/** Private Function: XOR `data` 32 bytes per step with the repeated key `pattern` starting at key offset `*phase`; Returns the bytes done and advances `*phase` */
+static size_t xor_pattern_words(uint8_t *__restrict__ data, const size_t len, const uint8_t *__restrict__ pattern, const size_t keylen, size_t *__restrict__ phase) {
+    const size_t step = (0x20 % keylen);
+    register size_t i, p = *phase;
+    uint64_t d[4], k[4];
+    for (i = 0x0; (i + 0x20) <= len; i += 0x20) {
+        memcpy(d, data + i, 0x20);
+        memcpy(k, pattern + p, 0x20);
+        d[0] ^= k[0];
+        d[1] ^= k[1];
+        d[2] ^= k[2];
+        d[3] ^= k[3];
+        memcpy(data + i, d, 0x20);
+        p += step;
+        if (p >= keylen) p -= keylen;
+    }
+    *phase = p;
+    return i;
+}
+
+
+#ifdef CRYPTX_X86_DISPATCH
+/** Private Function: AVX2 version of `xor_pattern_words()`, four 32-byte vectors per step */
+__attribute__((target("avx2")))
+static size_t xor_pattern_avx2(uint8_t *__restrict__ data, const size_t len, const uint8_t *__restrict__ pattern, const size_t keylen, size_t *__restrict__ phase) {
+    const size_t step = (0x80 % keylen);
+    register size_t i, p = *phase;
+    for (i = 0x0; (i + 0x80) <= len; i += 0x80) {
+        const uint8_t *k = pattern + p;
+        __m256i d0 = _mm256_loadu_si256((const __m256i *)(const void *)(data + i));
+        __m256i d1 = _mm256_loadu_si256((const __m256i *)(const void *)(data + i + 0x20));
+        __m256i d2 = _mm256_loadu_si256((const __m256i *)(const void *)(data + i + 0x40));
+        __m256i d3 = _mm256_loadu_si256((const __m256i *)(const void *)(data + i + 0x60));
+        d0 = _mm256_xor_si256(d0, _mm256_loadu_si256((const __m256i *)(const void *)k));
+        d1 = _mm256_xor_si256(d1, _mm256_loadu_si256((const __m256i *)(const void *)(k + 0x20)));
+        d2 = _mm256_xor_si256(d2, _mm256_loadu_si256((const __m256i *)(const void *)(k + 0x40)));
+        d3 = _mm256_xor_si256(d3, _mm256_loadu_si256((const __m256i *)(const void *)(k + 0x60)));
+        _mm256_storeu_si256((__m256i *)(void *)(data + i), d0);
+        _mm256_storeu_si256((__m256i *)(void *)(data + i + 0x20), d1);
+        _mm256_storeu_si256((__m256i *)(void *)(data + i + 0x40), d2);
+        _mm256_storeu_si256((__m256i *)(void *)(data + i + 0x60), d3);
+        p += step;
+        if (p >= keylen) p -= keylen;
+    }
+    *phase = p;
+    return i;
+}
+
+
+/** Private Function: AVX-512 version of `xor_pattern_words()`, four 64-byte vectors per step */
+__attribute__((target("avx512f")))
+static size_t xor_pattern_avx512(uint8_t *__restrict__ data, const size_t len, const uint8_t *__restrict__ pattern, const size_t keylen, size_t *__restrict__ phase) {
+    const size_t step = (0x100 % keylen);
+    register size_t i, p = *phase;
+    for (i = 0x0; (i + 0x100) <= len; i += 0x100) {
+        const uint8_t *k = pattern + p;
+        __m512i d0 = _mm512_loadu_si512((const void *)(data + i));
+        __m512i d1 = _mm512_loadu_si512((const void *)(data + i + 0x40));
+        __m512i d2 = _mm512_loadu_si512((const void *)(data + i + 0x80));
+        __m512i d3 = _mm512_loadu_si512((const void *)(data + i + 0xC0));
+        d0 = _mm512_xor_si512(d0, _mm512_loadu_si512((const void *)k));
+        d1 = _mm512_xor_si512(d1, _mm512_loadu_si512((const void *)(k + 0x40)));
+        d2 = _mm512_xor_si512(d2, _mm512_loadu_si512((const void *)(k + 0x80)));
+        d3 = _mm512_xor_si512(d3, _mm512_loadu_si512((const void *)(k + 0xC0)));
+        _mm512_storeu_si512((void *)(data + i), d0);
+        _mm512_storeu_si512((void *)(data + i + 0x40), d1);
+        _mm512_storeu_si512((void *)(data + i + 0x80), d2);
+        _mm512_storeu_si512((void *)(data + i + 0xC0), d3);
+        p += step;
+        if (p >= keylen) p -= keylen;
+    }
+    *phase = p;
+    return i;
+}
+#endif
+
+
+/** Private Function: XOR `data` with the key repeated (and complemented when `invert` is set); The kernels load the key register from `pattern + phase`, which is the key rotated to the current offset, so no byte needs a modulo */
+static void xor_pattern_buf(uint8_t *__restrict__ data, const size_t len, const uint8_t *__restrict__ key, const size_t keylen, const uint8_t invert) {
+    uint8_t stack_pattern[XOR_KEY_STACK + XOR_PATTERN_SLACK];
+    uint8_t *pattern = stack_pattern;
+    register size_t i;
+    size_t done = 0x0, phase = 0x0;
+    const size_t pattern_len = (keylen + XOR_PATTERN_SLACK);
+    const uint8_t mask = (invert ? 0xFF : 0x0);
+    if (len == 0x0 || keylen == 0x0) return;
+    if (keylen > XOR_KEY_STACK) {
+        pattern = (uint8_t *)malloc(pattern_len);
+        if (pattern == (uint8_t *)NULL) {
+            for (i = 0x0; i < len; ++i) {
+                data[i] ^= (uint8_t)(key[phase] ^ mask);
+                if (++phase == keylen) phase = 0x0;
+            }
+            return;
+        }
+    }
+    for (i = 0x0; i < pattern_len; ++i) {  // Carrying the key phase keeps -ftree-parallelize-loops off this fill
+        pattern[i] = (uint8_t)(key[phase] ^ mask);
+        if (++phase == keylen) phase = 0x0;
+    }
+    phase = 0x0;
+#ifdef CRYPTX_X86_DISPATCH
+    if (__builtin_cpu_supports("avx512f")) done = xor_pattern_avx512(data, len, pattern, keylen, &phase);
+    if (__builtin_cpu_supports("avx2")) done += xor_pattern_avx2(data + done, len - done, pattern, keylen, &phase);
+#endif
+    done += xor_pattern_words(data + done, len - done, pattern, keylen, &phase);
+    for (i = done; i < len; ++i) {
+        data[i] ^= pattern[phase];
+        if (++phase == keylen) phase = 0x0;
+    }
+    if (pattern != stack_pattern) free(pattern);
+}
+
+
+/** Encrypt/Decrypt `len` bytes of binary data in place using an XOR Cipher; Byte `i` is XORed with `key[i % keylen]` (an empty key leaves the data unchanged) */
+void xor_cipher_buf(uint8_t *__restrict__ data, const size_t len, const uint8_t *__restrict__ key, const size_t keylen) {
+    xor_pattern_buf(data, len, key, keylen, 0x0);
+}
+
+
+/** Encrypt/Decrypt `len` bytes of binary data in place using an NXOR Cipher; Byte `i` becomes `~(data[i] ^ key[i % keylen])` */
+void nxor_cipher_buf(uint8_t *__restrict__ data, const size_t len, const uint8_t *__restrict__ key, const size_t keylen) {
+    xor_pattern_buf(data, len, key, keylen, 0x1);
+}
+
+
 /** Tiny Encryption Algorithm: Encrypt an array of two `uint32`s using an array of four `uint32`s */
 void tea_cipher(uint32_t *__restrict__ v, const uint32_t *__restrict__ k) {
     const uint32_t delta = 0x9e3779b9;  // Key schedule constant
@@ -1123,7 +3706,7 @@ void xxtea_cipher(uint32_t *__restrict__ v, const int32_t num_items, const uint3
         y = v[0];
         do {
             e = (uint32_t)((sum >> 2) & 3);
-            for (p = ((uint32_t)(u_num_items) - 1); p--;) {
+            for (p = ((uint32_t)(u_num_items) - 1); p > 0; --p) {
                 z = v[p - 1];
                 v[p] = (uint32_t)(v[p] - (uint32_t)(MX));
                 y = v[p];
@@ -1137,6 +3720,329 @@ void xxtea_cipher(uint32_t *__restrict__ v, const int32_t num_items, const uint3
 }
 
 
+/** Private Function: `dest = src ^ stream` over `len` bytes (`dest` may equal `src`) */
+static void keystream_xor(uint8_t *dest, const uint8_t *src, const uint8_t *__restrict__ stream, const size_t len) {
+    uint64_t word, key;
+    register size_t i;
+    for (i = 0x0; (i + 8) <= len; i += 8) {
+        memcpy(&word, src + i, 8);
+        memcpy(&key, stream + i, 8);
+        word ^= key;
+        memcpy(dest + i, &word, 8);
+    }
+    for (; i < len; ++i) dest[i] = (uint8_t)(src[i] ^ stream[i]);
+}
+
+
+#ifdef CRYPTX_X86_DISPATCH
+#   define TEA_MIX(x, ka, kb, s)   (_mm_xor_si128(_mm_xor_si128(_mm_add_epi32(_mm_slli_epi32((x), 4), (ka)), _mm_add_epi32((x), (s))), _mm_add_epi32(_mm_srli_epi32((x), 5), (kb))))
+#   define TEA_MIX256(x, ka, kb, s)   (_mm256_xor_si256(_mm256_xor_si256(_mm256_add_epi32(_mm256_slli_epi32((x), 4), (ka)), _mm256_add_epi32((x), (s))), _mm256_add_epi32(_mm256_srli_epi32((x), 5), (kb))))
+#   define XTEA_MIX(x, s)   (_mm_xor_si128(_mm_add_epi32(_mm_xor_si128(_mm_slli_epi32((x), 4), _mm_srli_epi32((x), 5)), (x)), (s)))
+#   define XTEA_MIX256(x, s)   (_mm256_xor_si256(_mm256_add_epi32(_mm256_xor_si256(_mm256_slli_epi32((x), 4), _mm256_srli_epi32((x), 5)), (x)), (s)))
+/** Private Function: TEA on `nblocks` (a multiple of 4) blocks; The first and second words of four blocks are transposed into two SSE2 vectors (SSE2 is part of x86-64) */
+__attribute__((target("sse2")))
+static void tea_blocks_sse2(uint32_t *__restrict__ v, const size_t nblocks, const uint32_t *__restrict__ k, const int decrypt) {
+    const __m128i k0 = _mm_set1_epi32((int)k[0]), k1 = _mm_set1_epi32((int)k[1]), k2 = _mm_set1_epi32((int)k[2]), k3 = _mm_set1_epi32((int)k[3]);
+    __m128i a, b, v0, v1, s;
+    register uint32_t sum, i;
+    size_t block;
+    for (block = 0x0; block < nblocks; block += 4) {
+        a = _mm_loadu_si128((const __m128i *)(const void *)(v + (block << 1)));
+        b = _mm_loadu_si128((const __m128i *)(const void *)(v + (block << 1) + 4));
+        v0 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), _MM_SHUFFLE(2, 0, 2, 0)));
+        v1 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), _MM_SHUFFLE(3, 1, 3, 1)));
+        if (decrypt) {
+            for (i = 0x00, sum = 0xC6EF3720; i < 32; ++i, sum -= 0x9E3779B9) {
+                s = _mm_set1_epi32((int)sum);
+                v1 = _mm_sub_epi32(v1, TEA_MIX(v0, k2, k3, s));
+                v0 = _mm_sub_epi32(v0, TEA_MIX(v1, k0, k1, s));
+            }
+        } else {
+            for (i = 0x00, sum = 0x9E3779B9; i < 32; ++i, sum += 0x9E3779B9) {
+                s = _mm_set1_epi32((int)sum);
+                v0 = _mm_add_epi32(v0, TEA_MIX(v1, k0, k1, s));
+                v1 = _mm_add_epi32(v1, TEA_MIX(v0, k2, k3, s));
+            }
+        }
+        _mm_storeu_si128((__m128i *)(void *)(v + (block << 1)), _mm_unpacklo_epi32(v0, v1));
+        _mm_storeu_si128((__m128i *)(void *)(v + (block << 1) + 4), _mm_unpackhi_epi32(v0, v1));
+    }
+}
+
+
+/** Private Function: TEA on `nblocks` (a multiple of 8) blocks, eight at a time in AVX2 lanes */
+__attribute__((target("avx2")))
+static void tea_blocks_avx2(uint32_t *__restrict__ v, const size_t nblocks, const uint32_t *__restrict__ k, const int decrypt) {
+    const __m256i k0 = _mm256_set1_epi32((int)k[0]), k1 = _mm256_set1_epi32((int)k[1]), k2 = _mm256_set1_epi32((int)k[2]), k3 = _mm256_set1_epi32((int)k[3]);
+    __m256i a, b, v0, v1, s;
+    register uint32_t sum, i;
+    size_t block;
+    for (block = 0x0; block < nblocks; block += 8) {
+        a = _mm256_loadu_si256((const __m256i *)(const void *)(v + (block << 1)));
+        b = _mm256_loadu_si256((const __m256i *)(const void *)(v + (block << 1) + 8));
+        v0 = _mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _MM_SHUFFLE(2, 0, 2, 0)));  // Blocks 0, 1, 4, 5 | 2, 3, 6, 7
+        v1 = _mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _MM_SHUFFLE(3, 1, 3, 1)));
+        if (decrypt) {
+            for (i = 0x00, sum = 0xC6EF3720; i < 32; ++i, sum -= 0x9E3779B9) {
+                s = _mm256_set1_epi32((int)sum);
+                v1 = _mm256_sub_epi32(v1, TEA_MIX256(v0, k2, k3, s));
+                v0 = _mm256_sub_epi32(v0, TEA_MIX256(v1, k0, k1, s));
+            }
+        } else {
+            for (i = 0x00, sum = 0x9E3779B9; i < 32; ++i, sum += 0x9E3779B9) {
+                s = _mm256_set1_epi32((int)sum);
+                v0 = _mm256_add_epi32(v0, TEA_MIX256(v1, k0, k1, s));
+                v1 = _mm256_add_epi32(v1, TEA_MIX256(v0, k2, k3, s));
+            }
+        }
+        _mm256_storeu_si256((__m256i *)(void *)(v + (block << 1)), _mm256_unpacklo_epi32(v0, v1));
+        _mm256_storeu_si256((__m256i *)(void *)(v + (block << 1) + 8), _mm256_unpackhi_epi32(v0, v1));
+    }
+}
+
+
+/** Private Function: XTEA on `nblocks` (a multiple of 4) blocks, four at a time in SSE2 lanes */
+__attribute__((target("sse2")))
+static void xtea_blocks_sse2(const uint32_t num_rounds, uint32_t *__restrict__ v, const size_t nblocks, const uint32_t key[4], const int decrypt) {
+    __m128i a, b, v0, v1;
+    register uint32_t sum, i;
+    size_t block;
+    for (block = 0x0; block < nblocks; block += 4) {
+        a = _mm_loadu_si128((const __m128i *)(const void *)(v + (block << 1)));
+        b = _mm_loadu_si128((const __m128i *)(const void *)(v + (block << 1) + 4));
+        v0 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), _MM_SHUFFLE(2, 0, 2, 0)));
+        v1 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), _MM_SHUFFLE(3, 1, 3, 1)));
+        if (decrypt) {
+            for (i = 0x00, sum = (0x9E3779B9 * num_rounds); i < num_rounds; ++i) {
+                v1 = _mm_sub_epi32(v1, XTEA_MIX(v0, _mm_set1_epi32((int)(sum + key[(sum >> 11) & 3]))));
+                sum -= 0x9E3779B9;
+                v0 = _mm_sub_epi32(v0, XTEA_MIX(v1, _mm_set1_epi32((int)(sum + key[sum & 3]))));
+            }
+        } else {
+            for (i = 0x00, sum = 0x00; i < num_rounds; ++i) {
+                v0 = _mm_add_epi32(v0, XTEA_MIX(v1, _mm_set1_epi32((int)(sum + key[sum & 3]))));
+                sum += 0x9E3779B9;
+                v1 = _mm_add_epi32(v1, XTEA_MIX(v0, _mm_set1_epi32((int)(sum + key[(sum >> 11) & 3]))));
+            }
+        }
+        _mm_storeu_si128((__m128i *)(void *)(v + (block << 1)), _mm_unpacklo_epi32(v0, v1));
+        _mm_storeu_si128((__m128i *)(void *)(v + (block << 1) + 4), _mm_unpackhi_epi32(v0, v1));
+    }
+}
+
+
+/** Private Function: XTEA on `nblocks` (a multiple of 8) blocks, eight at a time in AVX2 lanes */
+__attribute__((target("avx2")))
+static void xtea_blocks_avx2(const uint32_t num_rounds, uint32_t *__restrict__ v, const size_t nblocks, const uint32_t key[4], const int decrypt) {
+    __m256i a, b, v0, v1;
+    register uint32_t sum, i;
+    size_t block;
+    for (block = 0x0; block < nblocks; block += 8) {
+        a = _mm256_loadu_si256((const __m256i *)(const void *)(v + (block << 1)));
+        b = _mm256_loadu_si256((const __m256i *)(const void *)(v + (block << 1) + 8));
+        v0 = _mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _MM_SHUFFLE(2, 0, 2, 0)));
+        v1 = _mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _MM_SHUFFLE(3, 1, 3, 1)));
+        if (decrypt) {
+            for (i = 0x00, sum = (0x9E3779B9 * num_rounds); i < num_rounds; ++i) {
+                v1 = _mm256_sub_epi32(v1, XTEA_MIX256(v0, _mm256_set1_epi32((int)(sum + key[(sum >> 11) & 3]))));
+                sum -= 0x9E3779B9;
+                v0 = _mm256_sub_epi32(v0, XTEA_MIX256(v1, _mm256_set1_epi32((int)(sum + key[sum & 3]))));
+            }
+        } else {
+            for (i = 0x00, sum = 0x00; i < num_rounds; ++i) {
+                v0 = _mm256_add_epi32(v0, XTEA_MIX256(v1, _mm256_set1_epi32((int)(sum + key[sum & 3]))));
+                sum += 0x9E3779B9;
+                v1 = _mm256_add_epi32(v1, XTEA_MIX256(v0, _mm256_set1_epi32((int)(sum + key[(sum >> 11) & 3]))));
+            }
+        }
+        _mm256_storeu_si256((__m256i *)(void *)(v + (block << 1)), _mm256_unpacklo_epi32(v0, v1));
+        _mm256_storeu_si256((__m256i *)(void *)(v + (block << 1) + 8), _mm256_unpackhi_epi32(v0, v1));
+    }
+}
+
+
+/** Private Function: XXTEA on `nblocks` (a multiple of 8) arrays of `|num_items|` (2 to XXTEA_LANES_MAX_ITEMS) words; Word `p` of eight arrays is gathered into one AVX2 vector */
+__attribute__((target("avx2")))
+static void xxtea_blocks_avx2(uint32_t *__restrict__ v, const size_t nblocks, const int32_t num_items, const uint32_t key[4]) {
+#   define MX256   (_mm256_xor_si256(_mm256_add_epi32(_mm256_xor_si256(_mm256_srli_epi32(z, 5), _mm256_slli_epi32(y, 2)), _mm256_xor_si256(_mm256_srli_epi32(y, 3), _mm256_slli_epi32(z, 4))), _mm256_add_epi32(_mm256_xor_si256(_mm256_set1_epi32((int)sum), y), _mm256_xor_si256(_mm256_set1_epi32((int)key[(p & 3) ^ e]), z))))
+    const uint32_t n = (uint32_t)((num_items < 0) ? -num_items : num_items);
+    const __m256i index = _mm256_mullo_epi32(_mm256_set1_epi32((int)n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    __m256i lanes[XXTEA_LANES_MAX_ITEMS], y, z;
+    uint32_t words[8], e, p, sum, rounds, lane;
+    size_t block;
+    for (block = 0x0; block < nblocks; block += 8) {
+        uint32_t *arrays = (v + (block * n));
+        for (p = 0x0; p < n; ++p) lanes[p] = _mm256_i32gather_epi32((const int *)(const void *)(arrays + p), index, 4);
+        rounds = (6 + (52 / n));
+        if (num_items > 0) {
+            sum = 0x00;
+            z = lanes[n - 1];
+            do {
+                sum += DELTA;
+                e = ((sum >> 2) & 3);
+                for (p = 0x00; p < (n - 1); ++p) {
+                    y = lanes[p + 1];
+                    lanes[p] = _mm256_add_epi32(lanes[p], MX256);
+                    z = lanes[p];
+                }
+                y = lanes[0];
+                lanes[n - 1] = _mm256_add_epi32(lanes[n - 1], MX256);
+                z = lanes[n - 1];
+            } while (--rounds);
+        } else {
+            sum = (rounds * DELTA);
+            y = lanes[0];
+            do {
+                e = ((sum >> 2) & 3);
+                for (p = (n - 1); p > 0; --p) {
+                    z = lanes[p - 1];
+                    lanes[p] = _mm256_sub_epi32(lanes[p], MX256);
+                    y = lanes[p];
+                }
+                z = lanes[n - 1];
+                lanes[0] = _mm256_sub_epi32(lanes[0], MX256);
+                y = lanes[0];
+                sum -= DELTA;
+            } while (--rounds);
+        }
+        for (p = 0x0; p < n; ++p) {  // AVX2 has no scatter
+            _mm256_storeu_si256((__m256i *)(void *)words, lanes[p]);
+            for (lane = 0x0; lane < 8; ++lane) arrays[(lane * n) + p] = words[lane];
+        }
+    }
+#   undef MX256
+}
+#   undef TEA_MIX
+#   undef TEA_MIX256
+#   undef XTEA_MIX
+#   undef XTEA_MIX256
+#endif
+
+
+/** Private Function: TEA on `nblocks` consecutive blocks; Full groups go through the widest SIMD engine and the rest through `tea_cipher()` */
+static void tea_blocks(uint32_t *__restrict__ v, size_t nblocks, const uint32_t *__restrict__ k, const int decrypt) {
+    size_t full;
+#ifdef CRYPTX_X86_DISPATCH
+    if (__builtin_cpu_supports("avx2")) {
+        full = (nblocks & ~(size_t)7);
+        tea_blocks_avx2(v, full, k, decrypt);
+        v += (full << 1);
+        nblocks -= full;
+    }
+    full = (nblocks & ~(size_t)3);
+    tea_blocks_sse2(v, full, k, decrypt);
+    v += (full << 1);
+    nblocks -= full;
+#endif
+    for (full = 0x0; full < nblocks; ++full) {
+        if (decrypt) decrypt_tea_cipher(v + (full << 1), k);
+        else tea_cipher(v + (full << 1), k);
+    }
+}
+
+
+/** Private Function: XTEA on `nblocks` consecutive blocks; Full groups go through the widest SIMD engine and the rest through `xtea_cipher()` */
+static void xtea_blocks(const uint32_t num_rounds, uint32_t *__restrict__ v, size_t nblocks, const uint32_t key[4], const int decrypt) {
+    size_t full;
+#ifdef CRYPTX_X86_DISPATCH
+    if (__builtin_cpu_supports("avx2")) {
+        full = (nblocks & ~(size_t)7);
+        xtea_blocks_avx2(num_rounds, v, full, key, decrypt);
+        v += (full << 1);
+        nblocks -= full;
+    }
+    full = (nblocks & ~(size_t)3);
+    xtea_blocks_sse2(num_rounds, v, full, key, decrypt);
+    v += (full << 1);
+    nblocks -= full;
+#endif
+    for (full = 0x0; full < nblocks; ++full) {
+        if (decrypt) decrypt_xtea_cipher(num_rounds, v + (full << 1), key);
+        else xtea_cipher(num_rounds, v + (full << 1), key);
+    }
+}
+
+
+/** Tiny Encryption Algorithm: Encrypt `nblocks` consecutive blocks of two `uint32`s (the same result as `tea_cipher()` on each block) */
+void tea_cipher_blocks(uint32_t *__restrict__ v, const size_t nblocks, const uint32_t *__restrict__ k) {
+    tea_blocks(v, nblocks, k, 0);
+}
+
+
+/** Tiny Encryption Algorithm: Decrypt `nblocks` consecutive blocks of two `uint32`s */
+void decrypt_tea_cipher_blocks(uint32_t *__restrict__ v, const size_t nblocks, const uint32_t *__restrict__ k) {
+    tea_blocks(v, nblocks, k, 1);
+}
+
+
+/** Extended Tiny Encryption Algorithm: Encrypt `nblocks` consecutive blocks of two `uint32`s (the same result as `xtea_cipher()` on each block) */
+void xtea_cipher_blocks(const uint32_t num_rounds, uint32_t *__restrict__ v, const size_t nblocks, const uint32_t key[4]) {
+    xtea_blocks(num_rounds, v, nblocks, key, 0);
+}
+
+
+/** Extended Tiny Encryption Algorithm: Decrypt `nblocks` consecutive blocks of two `uint32`s */
+void decrypt_xtea_cipher_blocks(const uint32_t num_rounds, uint32_t *__restrict__ v, const size_t nblocks, const uint32_t key[4]) {
+    xtea_blocks(num_rounds, v, nblocks, key, 1);
+}
+
+
+/** Corrected Block TEA: Encrypt/Decrypt `nblocks` consecutive arrays of `num_items` `uint32_t`s each, with the sign convention of `xxtea_cipher()` */
+void xxtea_cipher_blocks(uint32_t *__restrict__ v, const size_t nblocks, const int32_t num_items, const uint32_t key[4]) {
+    const size_t n = (size_t)((num_items < 0) ? -(int64_t)num_items : (int64_t)num_items);
+    size_t block = 0x0;
+    if (n < 2) return;
+#ifdef CRYPTX_X86_DISPATCH
+    if (n <= XXTEA_LANES_MAX_ITEMS && __builtin_cpu_supports("avx2")) {
+        block = (nblocks & ~(size_t)7);
+        xxtea_blocks_avx2(v, block, num_items, key);
+    }
+#endif
+    for (; block < nblocks; ++block) xxtea_cipher(v + (block * n), num_items, key);
+}
+
+
+/** Tiny Encryption Algorithm in counter mode: XOR `len` bytes of `src` into `dest` (which may equal `src`) with the encryptions of the blocks `{ (uint32_t)counter, (uint32_t)(counter >> 32) }`, `counter + 1`, ...; The keystream words are in native byte order; `*counter` is advanced past the blocks used */
+void tea_ctr(const uint32_t k[4], uint64_t *__restrict__ counter, uint8_t *dest, const uint8_t *src, size_t len) {
+    uint32_t stream[TEA_CTR_BLOCKS << 1];
+    size_t nblocks, take, b;
+    while (len) {
+        nblocks = ((len + 7) >> 3);
+        if (nblocks > TEA_CTR_BLOCKS) nblocks = TEA_CTR_BLOCKS;
+        for (b = 0x0; b < nblocks; ++b, ++(*counter)) {
+            stream[b << 1] = (uint32_t)(*counter);
+            stream[(b << 1) + 1] = (uint32_t)(*counter >> 32);
+        }
+        tea_blocks(stream, nblocks, k, 0);
+        take = ((len < sizeof(stream)) ? len : sizeof(stream));
+        keystream_xor(dest, src, (const uint8_t *)stream, take);
+        src += take;
+        dest += take;
+        len -= take;
+    }
+}
+
+
+/** Extended Tiny Encryption Algorithm in counter mode (see `tea_ctr()`) */
+void xtea_ctr(const uint32_t num_rounds, const uint32_t key[4], uint64_t *__restrict__ counter, uint8_t *dest, const uint8_t *src, size_t len) {
+    uint32_t stream[TEA_CTR_BLOCKS << 1];
+    size_t nblocks, take, b;
+    while (len) {
+        nblocks = ((len + 7) >> 3);
+        if (nblocks > TEA_CTR_BLOCKS) nblocks = TEA_CTR_BLOCKS;
+        for (b = 0x0; b < nblocks; ++b, ++(*counter)) {
+            stream[b << 1] = (uint32_t)(*counter);
+            stream[(b << 1) + 1] = (uint32_t)(*counter >> 32);
+        }
+        xtea_blocks(num_rounds, stream, nblocks, key, 0);
+        take = ((len < sizeof(stream)) ? len : sizeof(stream));
+        keystream_xor(dest, src, (const uint8_t *)stream, take);
+        src += take;
+        dest += take;
+        len -= take;
+    }
+}
+
 /** Treyfer Encryption */
 void treyfer_cipher(uint8_t text[8], const uint8_t key[8]) {
     register uint8_t r, i;
@@ -1164,6 +4070,162 @@ void decrypt_treyfer_cipher(uint8_t text[8], const uint8_t key[8]) {
 }
 
 
+/** Private Function: Read a big-endian 32-bit word */
+static uint32_t anubis_load(const uint8_t *__restrict__ bytes) {
+    return (((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) | ((uint32_t)bytes[2] << 8) | (uint32_t)bytes[3]);
+}
+
+
+/** Private Function: Write a big-endian 32-bit word */
+static void anubis_store(uint8_t *__restrict__ bytes, const uint32_t word) {
+    bytes[0] = (uint8_t)(word >> 24);
+    bytes[1] = (uint8_t)(word >> 16);
+    bytes[2] = (uint8_t)(word >> 8);
+    bytes[3] = (uint8_t)word;
+}
+
+
+/** Private Function: Run `nblocks` (at most ANUBIS_LANES) Anubis states through every round with the round keys `key`; The blocks are independent, so their table lookups overlap */
+static void anubis_crypt_blocks(const uint32_t key[ANUBIS_MAX_ROUNDS + 1][4], const int rounds, uint32_t state[][4], const size_t nblocks) {
+#   define ANUBIS_COLUMN(s, shift)   (ANUBIS_T0[((s)[0] >> (shift)) & 0xFF] ^ ANUBIS_T1[((s)[1] >> (shift)) & 0xFF] ^ ANUBIS_T2[((s)[2] >> (shift)) & 0xFF] ^ ANUBIS_T3[((s)[3] >> (shift)) & 0xFF])
+#   define ANUBIS_LAST_COLUMN(s, shift)   ((ANUBIS_T0[((s)[0] >> (shift)) & 0xFF] & 0xFF000000U) ^ (ANUBIS_T1[((s)[1] >> (shift)) & 0xFF] & 0x00FF0000U) ^ (ANUBIS_T2[((s)[2] >> (shift)) & 0xFF] & 0x0000FF00U) ^ (ANUBIS_T3[((s)[3] >> (shift)) & 0xFF] & 0x000000FFU))
+    uint32_t inter[4];
+    register size_t b;
+    register int r;
+    for (b = 0x0; b < nblocks; ++b) {
+        state[b][0] ^= key[0][0];
+        state[b][1] ^= key[0][1];
+        state[b][2] ^= key[0][2];
+        state[b][3] ^= key[0][3];
+    }
+    for (r = 1; r < rounds; ++r) {
+        for (b = 0x0; b < nblocks; ++b) {
+            inter[0] = (ANUBIS_COLUMN(state[b], 24) ^ key[r][0]);
+            inter[1] = (ANUBIS_COLUMN(state[b], 16) ^ key[r][1]);
+            inter[2] = (ANUBIS_COLUMN(state[b], 8) ^ key[r][2]);
+            inter[3] = (ANUBIS_COLUMN(state[b], 0) ^ key[r][3]);
+            memcpy(state[b], inter, sizeof(inter));
+        }
+    }
+    for (b = 0x0; b < nblocks; ++b) {
+        inter[0] = (ANUBIS_LAST_COLUMN(state[b], 24) ^ key[rounds][0]);
+        inter[1] = (ANUBIS_LAST_COLUMN(state[b], 16) ^ key[rounds][1]);
+        inter[2] = (ANUBIS_LAST_COLUMN(state[b], 8) ^ key[rounds][2]);
+        inter[3] = (ANUBIS_LAST_COLUMN(state[b], 0) ^ key[rounds][3]);
+        memcpy(state[b], inter, sizeof(inter));
+    }
+#   undef ANUBIS_COLUMN
+#   undef ANUBIS_LAST_COLUMN
+}
+
+
+/** Anubis: Expand a key of `key_len` bytes (16 to 40, a multiple of 4) into `ctx`; Return 0, or -1 for an invalid key length */
+int anubis_setkey(anubis_ctx *__restrict__ ctx, const uint8_t *__restrict__ key, const size_t key_len) {
+#   define ANUBIS_KEY_MIX(k, byte)   (ANUBIS_T4[(byte)] ^ (ANUBIS_T5[(k) >> 24] & 0xFF000000U) ^ (ANUBIS_T5[((k) >> 16) & 0xFF] & 0x00FF0000U) ^ (ANUBIS_T5[((k) >> 8) & 0xFF] & 0x0000FF00U) ^ (ANUBIS_T5[(k) & 0xFF] & 0x000000FFU))
+#   define ANUBIS_KEY_THETA(k)   (ANUBIS_T0[ANUBIS_T4[(k) >> 24] & 0xFF] ^ ANUBIS_T1[ANUBIS_T4[((k) >> 16) & 0xFF] & 0xFF] ^ ANUBIS_T2[ANUBIS_T4[((k) >> 8) & 0xFF] & 0xFF] ^ ANUBIS_T3[ANUBIS_T4[(k) & 0xFF] & 0xFF])
+    uint32_t kappa[ANUBIS_MAX_KEY_SIZE / 4], k0, k1, k2, k3, a, b, c, v;
+    register size_t byte;
+    register int i, r;
+    if (key_len < ANUBIS_MIN_KEY_SIZE || key_len > ANUBIS_MAX_KEY_SIZE || (key_len & 0x3)) return -1;
+    const int n = (int)(key_len >> 2);
+    const int rounds = (8 + n);
+    ctx->rounds = rounds;
+    for (byte = 0x0; byte < key_len; byte += 4) kappa[byte >> 2] = anubis_load(key + byte);
+    for (r = 0x0; r <= rounds; ++r) {
+        k0 = ANUBIS_T4[kappa[n - 1] >> 24];  // Round key K^r, one scalar per column
+        k1 = ANUBIS_T4[(kappa[n - 1] >> 16) & 0xFF];
+        k2 = ANUBIS_T4[(kappa[n - 1] >> 8) & 0xFF];
+        k3 = ANUBIS_T4[kappa[n - 1] & 0xFF];
+        for (i = (n - 2); i >= 0; --i) {
+            k0 = ANUBIS_KEY_MIX(k0, kappa[i] >> 24);
+            k1 = ANUBIS_KEY_MIX(k1, (kappa[i] >> 16) & 0xFF);
+            k2 = ANUBIS_KEY_MIX(k2, (kappa[i] >> 8) & 0xFF);
+            k3 = ANUBIS_KEY_MIX(k3, kappa[i] & 0xFF);
+        }
+        ctx->E[r][0] = k0;
+        ctx->E[r][1] = k1;
+        ctx->E[r][2] = k2;
+        ctx->E[r][3] = k3;
+        if (r == 0x0 || r == rounds) {  // Inverse schedule: D^0 = K^R, D^R = K^0, D^r = theta(K^(R - r))
+            ctx->D[rounds - r][0] = k0;
+            ctx->D[rounds - r][1] = k1;
+            ctx->D[rounds - r][2] = k2;
+            ctx->D[rounds - r][3] = k3;
+        } else {
+            ctx->D[rounds - r][0] = ANUBIS_KEY_THETA(k0);
+            ctx->D[rounds - r][1] = ANUBIS_KEY_THETA(k1);
+            ctx->D[rounds - r][2] = ANUBIS_KEY_THETA(k2);
+            ctx->D[rounds - r][3] = ANUBIS_KEY_THETA(k3);
+        }
+        if (r == rounds) break;
+        a = kappa[n - 3];  // Key state kappa^(r + 1), updated in place: `a`, `b`, and `c` carry the old words i - 3, i - 2, and i - 1
+        b = kappa[n - 2];
+        c = kappa[n - 1];
+        for (i = 0x0; i < n; ++i) {
+            v = kappa[i];
+            kappa[i] = (ANUBIS_T0[v >> 24] ^ ANUBIS_T1[(c >> 16) & 0xFF] ^ ANUBIS_T2[(b >> 8) & 0xFF] ^ ANUBIS_T3[a & 0xFF]);
+            a = b;
+            b = c;
+            c = v;
+        }
+        kappa[0] ^= ANUBIS_RC[r];
+    }
+    return 0;
+#   undef ANUBIS_KEY_MIX
+#   undef ANUBIS_KEY_THETA
+}
+
+
+/** Anubis: Encrypt one 16-byte block (`dest` may equal `src`) */
+void anubis_encrypt(const anubis_ctx *__restrict__ ctx, uint8_t dest[ANUBIS_BLOCK_SIZE], const uint8_t src[ANUBIS_BLOCK_SIZE]) {
+    uint32_t state[1][4];
+    register int i;
+    for (i = 0x0; i < 4; ++i) state[0][i] = anubis_load(src + (i << 2));
+    anubis_crypt_blocks(ctx->E, ctx->rounds, state, 0x1);
+    for (i = 0x0; i < 4; ++i) anubis_store(dest + (i << 2), state[0][i]);
+}
+
+
+/** Anubis: Decrypt one 16-byte block (`dest` may equal `src`) */
+void anubis_decrypt(const anubis_ctx *__restrict__ ctx, uint8_t dest[ANUBIS_BLOCK_SIZE], const uint8_t src[ANUBIS_BLOCK_SIZE]) {
+    uint32_t state[1][4];
+    register int i;
+    for (i = 0x0; i < 4; ++i) state[0][i] = anubis_load(src + (i << 2));
+    anubis_crypt_blocks(ctx->D, ctx->rounds, state, 0x1);
+    for (i = 0x0; i < 4; ++i) anubis_store(dest + (i << 2), state[0][i]);
+}
+
+
+/**
+    Anubis in counter mode: XOR `len` bytes of `src` with the encrypted big-endian 128-bit `counter` sequence into `dest` (which may equal `src`); Encryption and decryption are the same operation
+    @param[in,out] counter    Counter block of the first keystream block; On return, the counter of the next unused block, so that calls of whole blocks continue one stream
+*/
+void anubis_ctr(const anubis_ctx *__restrict__ ctx, uint8_t counter[ANUBIS_BLOCK_SIZE], uint8_t *dest, const uint8_t *src, size_t len) {
+    uint32_t ctr[4], state[ANUBIS_LANES][4];
+    uint8_t stream[ANUBIS_LANES * ANUBIS_BLOCK_SIZE];
+    size_t nblocks, take, b, i;
+    for (i = 0x0; i < 4; ++i) ctr[i] = anubis_load(counter + (i << 2));
+    while (len) {
+        nblocks = ((len + (ANUBIS_BLOCK_SIZE - 1)) / ANUBIS_BLOCK_SIZE);
+        if (nblocks > ANUBIS_LANES) nblocks = ANUBIS_LANES;
+        for (b = 0x0; b < nblocks; ++b) {
+            memcpy(state[b], ctr, sizeof(ctr));
+            if (++ctr[3] == 0x0 && ++ctr[2] == 0x0 && ++ctr[1] == 0x0) ++ctr[0];
+        }
+        anubis_crypt_blocks(ctx->E, ctx->rounds, state, nblocks);
+        for (b = 0x0; b < nblocks; ++b) {
+            for (i = 0x0; i < 4; ++i) anubis_store(stream + (b << 4) + (i << 2), state[b][i]);
+        }
+        take = ((len < sizeof(stream)) ? len : sizeof(stream));
+        keystream_xor(dest, src, stream, take);
+        src += take;
+        dest += take;
+        len -= take;
+    }
+    for (i = 0x0; i < 4; ++i) anubis_store(counter + (i << 2), ctr[i]);
+}
+
+
 /**
     Quaternion Byte Cipher (Encryption) that uses a 32-byte key
     @param[in] data    The data to encrypt
@@ -1309,9 +4371,9 @@ uint8_t bitparity128(const uint128_t data) {
 #endif
 
 
-/** Return the CRC8 value for the given byte array (`data`), given length */
-uint8_t crc8(const uint8_t *__restrict__ data, size_t len) {
-    register uint8_t x, crc = 0xFF;
+/** Private Function: Feed `len` bytes into a CRC8 register */
+static uint8_t crc8_feed(register uint8_t crc, const uint8_t *__restrict__ data, size_t len) {
+    register uint8_t x;
     while (len--) {
         x = crc >> 4 ^ *data++;
         x ^= (x >> 2);
@@ -1321,6 +4383,12 @@ uint8_t crc8(const uint8_t *__restrict__ data, size_t len) {
 }
 
 
+/** Return the CRC8 value for the given byte array (`data`), given length */
+uint8_t crc8(const uint8_t *__restrict__ data, size_t len) {
+    return crc8_feed(0xFF, data, len);
+}
+
+
 /** Return the CRC8 value for the given byte array (`data`) */
 uint8_t crc8x(const uint8_t *__restrict__ data) {
     register uint8_t x, crc = 0xFF;
@@ -1349,10 +4417,9 @@ uint8_t crc8portable(const uint8_t *__restrict__ data, const uint32_t len) {
 }
 
 
-/** Return the CRC16 value for the given byte array (`data`), given length */
-uint16_t crc16(const uint8_t *__restrict__ data, size_t len) {
+/** Private Function: Feed `len` bytes into a CRC16 register */
+static uint16_t crc16_feed(register uint16_t crc, const uint8_t *__restrict__ data, size_t len) {
     register uint8_t x;
-    register uint16_t crc = 0xFFFF;
     while (len--) {
         x = (uint8_t)(crc >> 8 ^ *data++);
         x ^= (x >> 4);
@@ -1362,6 +4429,12 @@ uint16_t crc16(const uint8_t *__restrict__ data, size_t len) {
 }
 
 
+/** Return the CRC16 value for the given byte array (`data`), given length */
+uint16_t crc16(const uint8_t *__restrict__ data, size_t len) {
+    return crc16_feed(0xFFFF, data, len);
+}
+
+
 /** Return the CRC16 value for the given byte array (`data`) */
 uint16_t crc16x(const uint8_t *__restrict__ data) {
     register uint8_t x;
@@ -1408,17 +4481,125 @@ uint16_t crc16memx(const uint8_t *data) {
 }
 
 
-/** Return the CRC32 value for the given byte array (`data`), given length */
+/** Return the CRC32 value for the given byte array (`data`), given length; Uses the PCLMULQDQ kernel when the CPU supports it */
 uint32_t crc32(uint32_t crc, const uint8_t *__restrict__ data, const size_t len) {
-    register size_t i;
-    for (i = len; i--;) {
-        crc = (uint32_t)(crc32_table[*data ^ ((crc >> 24) & 0xFF)] ^ (crc << 8));
-        data++;
+#ifdef CRYPTX_X86_DISPATCH
+    if (len >= 64 && __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1")) return crc32_clmul(crc, data, len);
+#endif
+    return crc32_slice16(crc, data, len);
+}
+
+
+/** Return the CRC32 value for the given byte array (`data`), given length; Slicing-by-8 (eight table lookups per 8 bytes) */
+uint32_t crc32_slice8(uint32_t crc, const uint8_t *__restrict__ data, size_t len) {
+    register uint32_t hi, lo;
+    for (; len >= 8; len -= 8) {
+        hi = crc ^ (((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | (uint32_t)data[3]);
+        lo = (((uint32_t)data[4] << 24) | ((uint32_t)data[5] << 16) | ((uint32_t)data[6] << 8) | (uint32_t)data[7]);
+        crc = (crc32_slice_table[7][hi >> 24] ^ crc32_slice_table[6][(hi >> 16) & 0xFF] ^ crc32_slice_table[5][(hi >> 8) & 0xFF] ^ crc32_slice_table[4][hi & 0xFF] ^ crc32_slice_table[3][lo >> 24] ^ crc32_slice_table[2][(lo >> 16) & 0xFF] ^ crc32_slice_table[1][(lo >> 8) & 0xFF] ^ crc32_slice_table[0][lo & 0xFF]);
+        data += 8;
+    }
+    while (len--) crc = (uint32_t)(crc32_table[*data++ ^ ((crc >> 24) & 0xFF)] ^ (crc << 8));
+    return crc;
+}
+
+
+/** Return the CRC32 value for the given byte array (`data`), given length; Slicing-by-16 (sixteen table lookups per 16 bytes) */
+uint32_t crc32_slice16(uint32_t crc, const uint8_t *__restrict__ data, size_t len) {
+    register uint32_t w0, w1, w2, w3;
+    for (; len >= 16; len -= 16) {
+        w0 = crc ^ (((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | (uint32_t)data[3]);
+        w1 = (((uint32_t)data[4] << 24) | ((uint32_t)data[5] << 16) | ((uint32_t)data[6] << 8) | (uint32_t)data[7]);
+        w2 = (((uint32_t)data[8] << 24) | ((uint32_t)data[9] << 16) | ((uint32_t)data[10] << 8) | (uint32_t)data[11]);
+        w3 = (((uint32_t)data[12] << 24) | ((uint32_t)data[13] << 16) | ((uint32_t)data[14] << 8) | (uint32_t)data[15]);
+        crc = (crc32_slice_table[15][w0 >> 24] ^ crc32_slice_table[14][(w0 >> 16) & 0xFF] ^ crc32_slice_table[13][(w0 >> 8) & 0xFF] ^ crc32_slice_table[12][w0 & 0xFF] ^ crc32_slice_table[11][w1 >> 24] ^ crc32_slice_table[10][(w1 >> 16) & 0xFF] ^ crc32_slice_table[9][(w1 >> 8) & 0xFF] ^ crc32_slice_table[8][w1 & 0xFF] ^ crc32_slice_table[7][w2 >> 24] ^ crc32_slice_table[6][(w2 >> 16) & 0xFF] ^ crc32_slice_table[5][(w2 >> 8) & 0xFF] ^ crc32_slice_table[4][w2 & 0xFF] ^ crc32_slice_table[3][w3 >> 24] ^ crc32_slice_table[2][(w3 >> 16) & 0xFF] ^ crc32_slice_table[1][(w3 >> 8) & 0xFF] ^ crc32_slice_table[0][w3 & 0xFF]);
+        data += 16;
+    }
+    while (len--) crc = (uint32_t)(crc32_table[*data++ ^ ((crc >> 24) & 0xFF)] ^ (crc << 8));
+    return crc;
+}
+
+
+#ifdef CRYPTX_X86_DISPATCH
+/** Return the CRC32 value for the given byte array (`data`), given length; Folds four 128-bit lanes at a time with carry-less multiplication (Intel's "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ", non-reflected form), then Barrett-reduces; Requires PCLMULQDQ and SSE4.1 */
+__attribute__((target("pclmul,sse4.1")))
+uint32_t crc32_clmul(uint32_t crc, const uint8_t *__restrict__ data, size_t len) {
+    const __m128i bswap = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);  // The first byte is the most significant
+    const __m128i fold4 = _mm_set_epi64x(0x8833794CLL, 0xE6228B11LL);  // x^576 mod P, x^512 mod P
+    const __m128i fold1 = _mm_set_epi64x(0xC5B9CD4CLL, 0xE8A45605LL);  // x^192 mod P, x^128 mod P
+    const __m128i reduce = _mm_set_epi64x(0x490D678DLL, 0xF200AA66LL);  // x^64 mod P, x^96 mod P
+    const __m128i barrett = _mm_set_epi64x(0x104C11DB7LL, 0x104D101DFLL);  // P, floor(x^64 / P)
+    __m128i x0, x1, x2, x3, t;
+    if (len < 64) return crc32_slice16(crc, data, len);
+    x0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)data), bswap);
+    x1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)(data + 16)), bswap);
+    x2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)(data + 32)), bswap);
+    x3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)(data + 48)), bswap);
+    x0 = _mm_xor_si128(x0, _mm_set_epi32((int)crc, 0, 0, 0));  // The initial CRC lines up with the first 32 bits of data
+    data += 64;
+    len -= 64;
+    while (len >= 64) {  // Fold each lane 512 bits forward onto the next 64 bytes
+        t = _mm_clmulepi64_si128(x0, fold4, 0x11);
+        x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, fold4, 0x00), t), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)data), bswap));
+        t = _mm_clmulepi64_si128(x1, fold4, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, fold4, 0x00), t), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)(data + 16)), bswap));
+        t = _mm_clmulepi64_si128(x2, fold4, 0x11);
+        x2 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x2, fold4, 0x00), t), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)(data + 32)), bswap));
+        t = _mm_clmulepi64_si128(x3, fold4, 0x11);
+        x3 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x3, fold4, 0x00), t), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)(data + 48)), bswap));
+        data += 64;
+        len -= 64;
+    }
+    // Fold the four lanes into one, then fold in any remaining whole 16-byte blocks
+    x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, fold1, 0x11), _mm_clmulepi64_si128(x0, fold1, 0x00)), x1);
+    x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, fold1, 0x11), _mm_clmulepi64_si128(x0, fold1, 0x00)), x2);
+    x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, fold1, 0x11), _mm_clmulepi64_si128(x0, fold1, 0x00)), x3);
+    while (len >= 16) {
+        x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, fold1, 0x11), _mm_clmulepi64_si128(x0, fold1, 0x00)), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)data), bswap));
+        data += 16;
+        len -= 16;
+    }
+    // CRC = x0 * x^32 mod P: reduce 128 bits to 96, then to 64, then Barrett-reduce to 32
+    x0 = _mm_xor_si128(_mm_clmulepi64_si128(x0, reduce, 0x01), _mm_slli_si128(_mm_move_epi64(x0), 4));
+    x0 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_srli_si128(x0, 8), reduce, 0x10), _mm_move_epi64(x0));
+    t = _mm_clmulepi64_si128(_mm_srli_epi64(x0, 32), barrett, 0x00);
+    t = _mm_clmulepi64_si128(_mm_srli_epi64(t, 32), barrett, 0x10);
+    crc = (uint32_t)_mm_cvtsi128_si32(_mm_xor_si128(x0, t));
+    return crc32_slice16(crc, data, len);  // Trailing bytes
+}
+#endif
+
+
+/** Private Function: Multiply two polynomials modulo the CRC32 polynomial */
+static uint32_t crc32_multmodp(const uint32_t a, uint32_t b) {
+    register uint32_t prod = 0x0;
+    register int i;
+    for (i = 31; i >= 0; i--) {
+        prod = ((prod & 0x80000000U) ? ((prod << 1) ^ 0x04C11DB7U) : (prod << 1));
+        if ((a >> i) & 0x1) prod ^= b;
+    }
+    return prod;
+}
+
+
+/** Return the CRC32 that `crc32()` would reach after feeding `len` zero bytes into `crc`, in O(log(len)) time */
+uint32_t crc32_shift(uint32_t crc, uint64_t len) {
+    register unsigned int k = 3;  // Start at x^(8 * 2^0)
+    while (len != 0x0 && k < 64) {
+        if (len & 0x1) crc = crc32_multmodp(crc32_x2n_table[k], crc);
+        len >>= 1;
+        ++k;
     }
     return crc;
 }
 
 
+/** Combine `crc1 = crc32(init, A, lenA)` and `crc2 = crc32(0, B, len2)` into `crc32(init, AB, lenA + len2)` */
+uint32_t crc32_combine(const uint32_t crc1, const uint32_t crc2, const uint64_t len2) {
+    return (crc32_shift(crc1, len2) ^ crc2);
+}
+
+
 /** Return the CRC32 value for the given byte array (`data`) */
 uint32_t crc32x(uint32_t crc, const uint8_t *__restrict__ data) {
     register size_t len;
@@ -1430,6 +4611,134 @@ uint32_t crc32x(uint32_t crc, const uint8_t *__restrict__ data) {
 }
 
 
+/** Private Function: Advance a raw CRC32C over a fixed run of zero bytes with one of the shift tables */
+static uint32_t crc32c_shift(const uint32_t table[4][256], const uint32_t crc) {
+    return (table[0][crc & 0xFF] ^ table[1][(crc >> 8) & 0xFF] ^ table[2][(crc >> 16) & 0xFF] ^ table[3][crc >> 24]);
+}
+
+
+/** Return the initial CRC32C (Castagnoli) state */
+uint32_t crc32c_init(void) {
+    return 0xFFFFFFFFU;
+}
+
+
+/** Feed `len` bytes into a raw CRC32C state in software (slicing-by-8); Any alignment */
+uint32_t crc32c_sw(uint32_t crc, const uint8_t *__restrict__ data, size_t len) {
+    register uint32_t hi;
+    for (; len >= 8; len -= 8) {
+        crc ^= ((uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24));
+        hi = ((uint32_t)data[4] | ((uint32_t)data[5] << 8) | ((uint32_t)data[6] << 16) | ((uint32_t)data[7] << 24));
+        crc = (crc32c_table[7][crc & 0xFF] ^ crc32c_table[6][(crc >> 8) & 0xFF] ^ crc32c_table[5][(crc >> 16) & 0xFF] ^ crc32c_table[4][crc >> 24] ^ crc32c_table[3][hi & 0xFF] ^ crc32c_table[2][(hi >> 8) & 0xFF] ^ crc32c_table[1][(hi >> 16) & 0xFF] ^ crc32c_table[0][hi >> 24]);
+        data += 8;
+    }
+    while (len--) crc = ((crc >> 8) ^ crc32c_table[0][(crc ^ *data++) & 0xFF]);
+    return crc;
+}
+
+
+#ifdef CRYPTX_X86_DISPATCH
+/** Feed `len` bytes into a raw CRC32C state with the SSE4.2 `crc32` instruction; Three independent `crc32q` streams hide its 3-cycle latency and are merged with the shift tables; Any alignment */
+__attribute__((target("sse4.2")))
+uint32_t crc32c_hw(uint32_t crc, const uint8_t *__restrict__ data, size_t len) {
+    uint64_t crc0 = crc, crc1, crc2, word0, word1, word2;
+    const uint8_t *end;
+    while (len != 0x0 && ((uintptr_t)data & 0x7)) {  // Align to a word boundary
+        crc0 = _mm_crc32_u8((uint32_t)crc0, *data++);
+        --len;
+    }
+    while (len >= (3 * CRC32C_LONG)) {
+        crc1 = crc2 = 0x0;
+        end = (data + CRC32C_LONG);
+        do {
+            memcpy(&word0, data, 8);
+            memcpy(&word1, data + CRC32C_LONG, 8);
+            memcpy(&word2, data + (2 * CRC32C_LONG), 8);
+            crc0 = _mm_crc32_u64(crc0, word0);
+            crc1 = _mm_crc32_u64(crc1, word1);
+            crc2 = _mm_crc32_u64(crc2, word2);
+            data += 8;
+        } while (data < end);
+        crc0 = (crc32c_shift(crc32c_long_shift, (uint32_t)crc0) ^ (uint32_t)crc1);
+        crc0 = (crc32c_shift(crc32c_long_shift, (uint32_t)crc0) ^ (uint32_t)crc2);
+        data += (2 * CRC32C_LONG);
+        len -= (3 * CRC32C_LONG);
+    }
+    while (len >= (3 * CRC32C_SHORT)) {
+        crc1 = crc2 = 0x0;
+        end = (data + CRC32C_SHORT);
+        do {
+            memcpy(&word0, data, 8);
+            memcpy(&word1, data + CRC32C_SHORT, 8);
+            memcpy(&word2, data + (2 * CRC32C_SHORT), 8);
+            crc0 = _mm_crc32_u64(crc0, word0);
+            crc1 = _mm_crc32_u64(crc1, word1);
+            crc2 = _mm_crc32_u64(crc2, word2);
+            data += 8;
+        } while (data < end);
+        crc0 = (crc32c_shift(crc32c_short_shift, (uint32_t)crc0) ^ (uint32_t)crc1);
+        crc0 = (crc32c_shift(crc32c_short_shift, (uint32_t)crc0) ^ (uint32_t)crc2);
+        data += (2 * CRC32C_SHORT);
+        len -= (3 * CRC32C_SHORT);
+    }
+    for (; len >= 8; len -= 8) {
+        memcpy(&word0, data, 8);
+        crc0 = _mm_crc32_u64(crc0, word0);
+        data += 8;
+    }
+    while (len--) crc0 = _mm_crc32_u8((uint32_t)crc0, *data++);
+    return (uint32_t)crc0;
+}
+#endif
+
+
+/** Feed `len` bytes into a CRC32C state (from `crc32c_init()`); Uses SSE4.2 when the CPU supports it */
+uint32_t crc32c_update(uint32_t crc, const uint8_t *__restrict__ data, const size_t len) {
+#ifdef CRYPTX_X86_DISPATCH
+    if (__builtin_cpu_supports("sse4.2")) return crc32c_hw(crc, data, len);
+#endif
+    return crc32c_sw(crc, data, len);
+}
+
+
+/** Return the CRC32C value of a state */
+uint32_t crc32c_final(const uint32_t crc) {
+    return ~crc;
+}
+
+
+/** Return the CRC32C (Castagnoli) value for the given byte array (`data`), given length; "123456789" gives 0xE3069283 */
+uint32_t crc32c(const uint8_t *__restrict__ data, const size_t len) {
+    return crc32c_final(crc32c_update(crc32c_init(), data, len));
+}
+
+
+/** Private Function: Multiply two polynomials modulo the reflected CRC32C polynomial */
+static uint32_t crc32c_multmodp(const uint32_t a, uint32_t b) {
+    register uint32_t m = 0x80000000U, p = 0x0;
+    for (;;) {
+        if (a & m) {
+            p ^= b;
+            if ((a & (m - 1)) == 0x0) break;
+        }
+        m >>= 1;
+        b = ((b & 0x1) ? ((b >> 1) ^ 0x82F63B78U) : (b >> 1));
+    }
+    return p;
+}
+
+
+/** Combine `crc1 = crc32c(A)` and `crc2 = crc32c(B)` into `crc32c(AB)` given the length of B, in O(log(len2)) time */
+uint32_t crc32c_combine(const uint32_t crc1, const uint32_t crc2, uint64_t len2) {
+    register uint32_t p = 0x80000000U;  // x^0
+    register unsigned int k = 0x3;  // Bytes to bits
+    for (; len2; len2 >>= 1, ++k) {
+        if (len2 & 0x1) p = crc32c_multmodp(crc32c_x2n_table[k], p);
+    }
+    return (crc32c_multmodp(p, crc1) ^ crc2);
+}
+
+
 #ifdef INTEL64
 /** Optimized CRC32 */
 uint32_t fastcrc32(char *str, const uint32_t len) {
@@ -1488,30 +4797,158 @@ uint16_t adler16(const uint8_t *__restrict__ data, register size_t len) {
 }
 
 
-/** Return the Adler32 checksum of the given data */
-uint32_t adler32(const uint8_t *__restrict__ data, register size_t len) {
-    register uint32_t a = 0x1, b = 0x0;
+/** Private Function: Sum `len` (at most ADLER32_NMAX) bytes without any modulo; `sum` gets the byte total and `weighted` gets the total of the running sums */
+static void adler_sums_scalar(const uint8_t *__restrict__ data, const size_t len, uint32_t *__restrict__ sum, uint32_t *__restrict__ weighted) {
+    register uint32_t a = 0x0, b = 0x0;
     register size_t index;
     for (index = 0x0; index < len; ++index) {
-        a = ((uint32_t)(a + (uint32_t)data[index]) % (uint32_t)0xFFF1);
-        b = ((uint32_t)(b + a) % (uint32_t)0xFFF1);
+        a += data[index];
+        b += a;
     }
-    return (uint32_t)((uint32_t)(b << 16) | a);
+    *sum = a;
+    *weighted = b;
 }
 
 
-/** Return the Adler64 checksum of the given data */
-uint64_t adler64(const uint8_t *__restrict__ data, register size_t len) {
-    register uint64_t a = 0x1, b = 0x0;
-    register size_t index;
-    for (index = 0x0; index < len; ++index) {
-        a = ((uint64_t)(a + (uint64_t)data[index]) % (uint64_t)0xFFFFFFF1);
-        b = ((uint64_t)(b + a) % (uint64_t)0xFFFFFFF1);
+#ifdef CRYPTX_X86_DISPATCH
+/** Private Function: SSSE3 form of `adler_sums_scalar()`; `psadbw` gives the byte totals and `pmaddubsw` the positional weights of each 16-byte vector */
+__attribute__((target("ssse3")))
+static void adler_sums_ssse3(const uint8_t *__restrict__ data, const size_t len, uint32_t *__restrict__ sum, uint32_t *__restrict__ weighted) {
+    const __m128i zero = _mm_setzero_si128(), ones = _mm_set1_epi16(0x1);
+    const __m128i weights = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    __m128i vs1 = zero, vs2 = zero, prev = zero, bytes;
+    register size_t index, blocks = (len >> 4);
+    uint32_t s, w, tail_s, tail_w;
+    for (index = 0x0; index < blocks; ++index) {
+        bytes = _mm_loadu_si128((const __m128i *)(const void *)(data + (index << 4)));
+        prev = _mm_add_epi32(prev, vs1);
+        vs1 = _mm_add_epi32(vs1, _mm_sad_epu8(bytes, zero));
+        vs2 = _mm_add_epi32(vs2, _mm_madd_epi16(_mm_maddubs_epi16(bytes, weights), ones));
+    }
+    vs2 = _mm_add_epi32(vs2, _mm_slli_epi32(prev, 4));
+    vs1 = _mm_add_epi32(vs1, _mm_shuffle_epi32(vs1, 0x4E));
+    vs2 = _mm_add_epi32(vs2, _mm_shuffle_epi32(vs2, 0x4E));
+    vs2 = _mm_add_epi32(vs2, _mm_shuffle_epi32(vs2, 0xB1));
+    s = (uint32_t)_mm_cvtsi128_si32(vs1);
+    w = (uint32_t)_mm_cvtsi128_si32(vs2);
+    adler_sums_scalar(data + (blocks << 4), (len & 0xF), &tail_s, &tail_w);
+    *sum = (s + tail_s);
+    *weighted = (w + (uint32_t)(len & 0xF) * s + tail_w);
+}
+
+
+/** Private Function: AVX2 form of `adler_sums_scalar()` working on 32-byte vectors */
+__attribute__((target("avx2")))
+static void adler_sums_avx2(const uint8_t *__restrict__ data, const size_t len, uint32_t *__restrict__ sum, uint32_t *__restrict__ weighted) {
+    const __m256i zero = _mm256_setzero_si256(), ones = _mm256_set1_epi16(0x1);
+    const __m256i weights = _mm256_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    __m256i vs1 = zero, vs2 = zero, prev = zero, bytes;
+    __m128i s1, s2;
+    register size_t index, blocks = (len >> 5);
+    uint32_t s, w, tail_s, tail_w;
+    for (index = 0x0; index < blocks; ++index) {
+        bytes = _mm256_loadu_si256((const __m256i *)(const void *)(data + (index << 5)));
+        prev = _mm256_add_epi32(prev, vs1);
+        vs1 = _mm256_add_epi32(vs1, _mm256_sad_epu8(bytes, zero));
+        vs2 = _mm256_add_epi32(vs2, _mm256_madd_epi16(_mm256_maddubs_epi16(bytes, weights), ones));
+    }
+    vs2 = _mm256_add_epi32(vs2, _mm256_slli_epi32(prev, 5));
+    s1 = _mm_add_epi32(_mm256_castsi256_si128(vs1), _mm256_extracti128_si256(vs1, 1));
+    s2 = _mm_add_epi32(_mm256_castsi256_si128(vs2), _mm256_extracti128_si256(vs2, 1));
+    s1 = _mm_add_epi32(s1, _mm_shuffle_epi32(s1, 0x4E));
+    s2 = _mm_add_epi32(s2, _mm_shuffle_epi32(s2, 0x4E));
+    s2 = _mm_add_epi32(s2, _mm_shuffle_epi32(s2, 0xB1));
+    s = (uint32_t)_mm_cvtsi128_si32(s1);
+    w = (uint32_t)_mm_cvtsi128_si32(s2);
+    adler_sums_scalar(data + (blocks << 5), (len & 0x1F), &tail_s, &tail_w);
+    *sum = (s + tail_s);
+    *weighted = (w + (uint32_t)(len & 0x1F) * s + tail_w);
+}
+#endif
+
+
+/** Feed `len` bytes into an Adler32 state (start from 1); Sums are reduced once per ADLER32_NMAX bytes and use AVX2 or SSSE3 when the CPU supports it */
+uint32_t adler32_update(uint32_t adler, const uint8_t *__restrict__ data, size_t len) {
+    void (*sums)(const uint8_t *__restrict__, const size_t, uint32_t *__restrict__, uint32_t *__restrict__) = adler_sums_scalar;
+    register uint64_t a = (adler & 0xFFFF), b = (adler >> 16);
+    register size_t block;
+    uint32_t s, w;
+#ifdef CRYPTX_X86_DISPATCH
+    if (__builtin_cpu_supports("avx2")) sums = adler_sums_avx2;
+    else if (__builtin_cpu_supports("ssse3")) sums = adler_sums_ssse3;
+#endif
+    while (len) {
+        block = ((len > ADLER32_NMAX) ? ADLER32_NMAX : len);
+        sums(data, block, &s, &w);
+        b = ((b + (uint64_t)block * a + w) % ADLER32_BASE);
+        a = ((a + s) % ADLER32_BASE);
+        data += block;
+        len -= block;
+    }
+    return (uint32_t)((uint32_t)(b << 16) | (uint32_t)a);
+}
+
+
+/** Return the Adler32 checksum of the given data */
+uint32_t adler32(const uint8_t *__restrict__ data, register size_t len) {
+    return adler32_update(0x1, data, len);
+}
+
+
+/** Return the Adler32 checksum of two concatenated pieces given the checksum of each and the length of the second piece */
+uint32_t adler32_combine(const uint32_t adler1, const uint32_t adler2, const uint64_t len2) {
+    const uint32_t rem = (uint32_t)(len2 % ADLER32_BASE);
+    register uint32_t sum1 = (adler1 & 0xFFFF), sum2;
+    sum2 = ((rem * sum1) % ADLER32_BASE);
+    sum1 += ((adler2 & 0xFFFF) + ADLER32_BASE - 1);
+    sum2 += ((adler1 >> 16) + (adler2 >> 16) + ADLER32_BASE - rem);
+    if (sum1 >= ADLER32_BASE) sum1 -= ADLER32_BASE;
+    if (sum1 >= ADLER32_BASE) sum1 -= ADLER32_BASE;
+    if (sum2 >= (ADLER32_BASE << 1)) sum2 -= (ADLER32_BASE << 1);
+    if (sum2 >= ADLER32_BASE) sum2 -= ADLER32_BASE;
+    return (uint32_t)((sum2 << 16) | sum1);
+}
+
+
+/** Return the Adler64 checksum of two concatenated pieces given the checksum of each and the length of the second piece */
+uint64_t adler64_combine(const uint64_t adler1, const uint64_t adler2, const uint64_t len2) {
+    const uint64_t rem = (len2 % ADLER64_BASE);
+    register uint64_t sum1 = (adler1 & 0xFFFFFFFF), sum2;
+    sum2 = ((rem * sum1) % ADLER64_BASE);
+    sum1 = ((sum1 + (adler2 & 0xFFFFFFFF) + ADLER64_BASE - 1) % ADLER64_BASE);
+    sum2 = ((sum2 + (adler1 >> 32) + (adler2 >> 32) + ADLER64_BASE - rem) % ADLER64_BASE);
+    return (uint64_t)((sum2 << 32) | sum1);
+}
+
+
+/** Feed `len` bytes into an Adler64 state (start from 1); Shares the deferred-modulo kernels of `adler32_update()` */
+uint64_t adler64_update(uint64_t adler, const uint8_t *__restrict__ data, size_t len) {
+    void (*sums)(const uint8_t *__restrict__, const size_t, uint32_t *__restrict__, uint32_t *__restrict__) = adler_sums_scalar;
+    register uint64_t a = (adler & 0xFFFFFFFF), b = (adler >> 32);
+    register size_t block;
+    uint32_t s, w;
+#ifdef CRYPTX_X86_DISPATCH
+    if (__builtin_cpu_supports("avx2")) sums = adler_sums_avx2;
+    else if (__builtin_cpu_supports("ssse3")) sums = adler_sums_ssse3;
+#endif
+    while (len) {
+        block = ((len > ADLER32_NMAX) ? ADLER32_NMAX : len);
+        sums(data, block, &s, &w);
+        b = ((b + (uint64_t)block * a + w) % ADLER64_BASE);
+        a = ((a + s) % ADLER64_BASE);
+        data += block;
+        len -= block;
     }
     return (uint64_t)((uint64_t)(b << 32) | a);
 }
 
 
+/** Return the Adler64 checksum of the given data */
+uint64_t adler64(const uint8_t *__restrict__ data, register size_t len) {
+    return adler64_update(0x1, data, len);
+}
+
+
 /** Return the Anti-Adler64 (decrementing for-loop) checksum of the given data */
 uint64_t antiadler64(const uint8_t *__restrict__ data, register size_t len) {
     register uint64_t a = 0x1, b = 0x0;
@@ -1550,6 +4987,128 @@ uint128_t adler128(const uint8_t *__restrict__ data, register size_t len) {
 #endif
 
 
+/** Private Function: Sum `count` (at most FLETCHER_NMAX) elements of `width` bytes without any modulo; `sum` gets the element total and `weighted` gets the total of the running sums */
+static void fletcher_sums_scalar(const void *__restrict__ data, const size_t count, const size_t width, uint64_t *__restrict__ sum, uint64_t *__restrict__ weighted) {
+    register uint64_t a = 0x0, b = 0x0;
+    register size_t index;
+    uint16_t half;
+    uint32_t word;
+    switch (width) {
+        case 1:
+            for (index = 0x0; index < count; ++index) { b += a += ((const uint8_t *)data)[index]; }
+            break;
+        case 2:
+            for (index = 0x0; index < count; ++index) {
+                memcpy(&half, (const uint8_t *)data + (index << 1), 2);  // `checksum_update()` may pass unaligned elements
+                b += a += half;
+            }
+            break;
+        default:
+            for (index = 0x0; index < count; ++index) {
+                memcpy(&word, (const uint8_t *)data + (index << 2), 4);
+                b += a += word;
+            }
+            break;
+    }
+    *sum = a;
+    *weighted = b;
+}
+
+
+#ifdef CRYPTX_X86_DISPATCH
+/** Private Function: AVX2 form of `fletcher_sums_scalar()` for 2 and 4 byte elements; Each byte plane is summed like Adler data (`psadbw` totals, `pmaddubsw` position weights) in 32-bit lanes and the planes are recombined in 64 bits */
+__attribute__((target("avx2")))
+static void fletcher_sums_avx2(const void *__restrict__ data, const size_t count, const size_t width, uint64_t *__restrict__ sum, uint64_t *__restrict__ weighted) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    const size_t per_vector = (32 / width), vectors = (count / per_vector);
+    const __m256i zero = _mm256_setzero_si256(), ones = _mm256_set1_epi16(0x1);
+    const __m256i mask = ((width == 2) ? _mm256_set1_epi16(0xFF) : _mm256_set1_epi32(0xFF));
+    const __m128i scale = _mm_cvtsi32_si128((width == 2) ? 4 : 3);
+    const __m256i weights = ((width == 2) ? _mm256_setr_epi8(16, 16, 15, 15, 14, 14, 13, 13, 12, 12, 11, 11, 10, 10, 9, 9, 8, 8, 7, 7, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1) : _mm256_setr_epi8(8, 8, 8, 8, 7, 7, 7, 7, 6, 6, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 3, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1, 1));  // `per_vector - (byte / width)`
+    __m256i vs1[4], vs2[4], prev[4], block, plane;
+    __m128i s1, s2;
+    register size_t index, p;
+    uint64_t s = 0x0, w = 0x0, tail_s, tail_w;
+    for (p = 0x0; p < width; ++p) vs1[p] = vs2[p] = prev[p] = zero;
+    for (index = 0x0; index < vectors; ++index) {
+        block = _mm256_loadu_si256((const __m256i *)(const void *)(bytes + (index << 5)));
+        for (p = 0x0; p < width; ++p) {  // Shifting `block` down one plane per step also keeps -ftree-parallelize-loops off this loop
+            plane = _mm256_and_si256(block, mask);
+            block = ((width == 2) ? _mm256_srli_epi16(block, 8) : _mm256_srli_epi32(block, 8));
+            prev[p] = _mm256_add_epi32(prev[p], vs1[p]);
+            vs1[p] = _mm256_add_epi32(vs1[p], _mm256_sad_epu8(plane, zero));
+            vs2[p] = _mm256_add_epi32(vs2[p], _mm256_madd_epi16(_mm256_maddubs_epi16(plane, weights), ones));
+        }
+    }
+    for (p = width; p-- > 0x0;) {  // Horner order: the planes are recombined as `s = (s << 8) + plane`
+        vs2[p] = _mm256_add_epi32(vs2[p], _mm256_sll_epi32(prev[p], scale));
+        s1 = _mm_add_epi32(_mm256_castsi256_si128(vs1[p]), _mm256_extracti128_si256(vs1[p], 1));
+        s2 = _mm_add_epi32(_mm256_castsi256_si128(vs2[p]), _mm256_extracti128_si256(vs2[p], 1));
+        s1 = _mm_add_epi32(s1, _mm_shuffle_epi32(s1, 0x4E));
+        s2 = _mm_add_epi32(s2, _mm_shuffle_epi32(s2, 0x4E));
+        s2 = _mm_add_epi32(s2, _mm_shuffle_epi32(s2, 0xB1));
+        s = ((s << 8) + (uint64_t)(uint32_t)_mm_cvtsi128_si32(s1));
+        w = ((w << 8) + (uint64_t)(uint32_t)_mm_cvtsi128_si32(s2));
+    }
+    index = (vectors * per_vector);
+    fletcher_sums_scalar(bytes + (index * width), (count - index), width, &tail_s, &tail_w);
+    *sum = (s + tail_s);
+    *weighted = (w + (uint64_t)(count - index) * s + tail_w);
+}
+#endif
+
+
+/** Private Function: Sum `count` (at most FLETCHER_NMAX) elements of `width` (1, 2, or 4) bytes with the fastest kernel the CPU supports */
+static void fletcher_sums(const void *__restrict__ data, const size_t count, const size_t width, uint64_t *__restrict__ sum, uint64_t *__restrict__ weighted) {
+    uint32_t s, w;
+    if (width == 1) {
+#ifdef CRYPTX_X86_DISPATCH
+        if (__builtin_cpu_supports("avx2")) adler_sums_avx2((const uint8_t *)data, count, &s, &w);
+        else if (__builtin_cpu_supports("ssse3")) adler_sums_ssse3((const uint8_t *)data, count, &s, &w);
+        else
+#endif
+        adler_sums_scalar((const uint8_t *)data, count, &s, &w);
+        *sum = s;
+        *weighted = w;
+        return;
+    }
+#ifdef CRYPTX_X86_DISPATCH
+    if (__builtin_cpu_supports("avx2")) {
+        fletcher_sums_avx2(data, count, width, sum, weighted);
+        return;
+    }
+#endif
+    fletcher_sums_scalar(data, count, width, sum, weighted);
+}
+
+
+/** Private Function: Add `count` elements of `width` bytes to the running Fletcher (or Adler) sums, each kept modulo `modulus`; Reduces once per FLETCHER_NMAX elements */
+static void fletcher_accumulate(uint64_t *__restrict__ sum1, uint64_t *__restrict__ sum2, const void *__restrict__ data, size_t count, const size_t width, const uint64_t modulus) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    register uint64_t a = *sum1, b = *sum2;
+    register size_t block;
+    uint64_t s, w;
+    while (count) {
+        block = ((count > FLETCHER_NMAX) ? FLETCHER_NMAX : count);
+        fletcher_sums(bytes, block, width, &s, &w);
+        b = ((b + (uint64_t)block * a + (w % modulus)) % modulus);
+        a = ((a + (s % modulus)) % modulus);
+        bytes += (block * width);
+        count -= block;
+    }
+    *sum1 = a;
+    *sum2 = b;
+}
+
+
+/** Private Function: Return the Fletcher sums (modulo `modulus`, starting at zero) of `count` elements of `width` bytes packed as `sum2 << 32 | sum1` */
+static uint64_t fletcher_reduce(const void *__restrict__ data, size_t count, const size_t width, const uint64_t modulus) {
+    uint64_t sum1 = 0x0, sum2 = 0x0;
+    fletcher_accumulate(&sum1, &sum2, data, count, width, modulus);
+    return (uint64_t)((sum2 << 32) | sum1);
+}
+
+
 /** Return the Fletcher8 checksum of the given data */
 uint8_t fletcher8(const uint8_t *__restrict__ data, const size_t count) {
     register uint8_t sum1 = 0x0, sum2 = 0x0;
@@ -1564,13 +5123,8 @@ uint8_t fletcher8(const uint8_t *__restrict__ data, const size_t count) {
 
 /** Return the Fletcher16 checksum of the given data */
 uint16_t fletcher16(const uint8_t *__restrict__ data, const size_t count) {
-    register uint16_t sum1 = 0x0, sum2 = 0x0;
-    register size_t index;
-    for (index = 0x0; index < count; ++index) {
-        sum1 = (uint16_t)((sum1 + (uint16_t)data[index]) % 0xFF);
-        sum2 = (uint16_t)((sum2 + sum1) % 0xFF);
-    }
-    return (uint16_t)((uint16_t)(sum2 << 8) | sum1);
+    const uint64_t sums = fletcher_reduce(data, count, 1, 0xFF);
+    return (uint16_t)((uint16_t)((sums >> 32) << 8) | (uint16_t)(sums & 0xFF));
 }
 
 
@@ -1597,13 +5151,8 @@ uint16_t fletcher16fast(const uint8_t *__restrict__ data, const size_t words) {
 
 /** Return the Fletcher32 checksum of the given data */
 uint32_t fletcher32(const uint16_t *__restrict__ data, const size_t count) {
-    register uint32_t sum1 = 0x0, sum2 = 0x0;
-    register size_t index;
-    for (index = 0x0; index < count; ++index) {
-        sum1 = (uint32_t)((sum1 + (uint32_t)data[index]) % 0xFFFF);
-        sum2 = (uint32_t)((sum2 + sum1) % 0xFFFF);
-    }
-    return (uint32_t)((uint32_t)(sum2 << 16) | sum1);
+    const uint64_t sums = fletcher_reduce(data, count, 2, 0xFFFF);
+    return (uint32_t)((uint32_t)((sums >> 32) << 16) | (uint32_t)(sums & 0xFFFF));
 }
 
 
@@ -1627,35 +5176,145 @@ uint32_t fletcher32fast(const uint16_t *__restrict__ data, const size_t words) {
 
 /** Return the Fletcher64 checksum for the given data */
 uint64_t fletcher64(const uint32_t *__restrict__ data, const size_t count) {
-    register uint64_t sum1 = 0x0, sum2 = 0x0;
-    register size_t index;
-    for (index = 0x0; index < count; ++index) {
-        sum1 = (uint64_t)((sum1 + (uint64_t)data[index]) % 0xFFFFFFFF);
-        sum2 = (uint64_t)((sum2 + sum1) % 0xFFFFFFFF);
-    }
-    return (uint64_t)((uint64_t)(sum2 << 32) | sum1);
+    return fletcher_reduce(data, count, 4, 0xFFFFFFFF);
 }
 
 
 /** Return the Fletcher64 checksum for the given string cast as an uint_t */
 uint64_t fletcher64char(const uint8_t *__restrict__ data, const size_t count) {
-    register uint64_t sum1 = 0x0, sum2 = 0x0;
-    register size_t index;
-    for (index = 0x0; index < count; ++index) {
-        sum1 = (uint64_t)((sum1 + (uint64_t)data[index]) % 0xFFFFFFFF);
-        sum2 = (uint64_t)((sum2 + sum1) % 0xFFFFFFFF);
-    }
-    return (uint64_t)((uint64_t)(sum2 << 32) | sum1);
+    return fletcher_reduce(data, count, 1, 0xFFFFFFFF);
 }
 
 
 /** Return the Collier32 checksum of the given data */
 uint32_t collier32(const uint16_t *__restrict__ data, const size_t count) {
     register uint32_t sum1 = 0x0, sum2 = 0x0;
-    register size_t index;
-    for (index = count; --index;) {
-        sum2 = (uint32_t)((sum2 + sum1) & 0xFFFF);
-        sum1 = (uint32_t)((sum1 + (uint32_t)data[index]) & 0xFFFF);
+    register size_t index, block;
+    uint64_t s, w;
+    // The reversed loop over data[count - 1] .. data[1] gives data[index] the weight (index - 1) in sum2
+    for (index = 0x1; index < count; index += block) {
+        block = (((count - index) > FLETCHER_NMAX) ? FLETCHER_NMAX : (count - index));
+        fletcher_sums(data + index, block, 2, &s, &w);
+        sum2 += (uint32_t)((uint64_t)(index - 1) * s + (uint64_t)block * s - w);
+        sum1 += (uint32_t)s;
     }
-    return (uint32_t)((uint32_t)(sum2 << 0xF) ^ sum1);
+    return (uint32_t)((uint32_t)((sum2 & 0xFFFF) << 0xF) ^ (sum1 & 0xFFFF));
+}
+
+
+/* STREAMING CHECKSUMS */
+
+
+/** Private Function: Return the modulus, element width, packing shift, and initial `sum1` of an Adler or Fletcher `algorithm`; Return 0 for the others */
+static uint64_t checksum_params(const unsigned int algorithm, size_t *__restrict__ width, unsigned int *__restrict__ shift, uint64_t *__restrict__ start) {
+    *width = 0x1;
+    *start = 0x0;
+    switch (algorithm) {
+        case CHECKSUM_ADLER16: *shift = 8; *start = 0x1; return 0xF1;
+        case CHECKSUM_ADLER32: *shift = 16; *start = 0x1; return ADLER32_BASE;
+        case CHECKSUM_ADLER64: *shift = 32; *start = 0x1; return ADLER64_BASE;
+        case CHECKSUM_FLETCHER8: *shift = 4; return 0xF;
+        case CHECKSUM_FLETCHER16: *shift = 8; return 0xFF;
+        case CHECKSUM_FLETCHER32: *shift = 16; *width = 0x2; return 0xFFFF;
+        case CHECKSUM_FLETCHER64: *shift = 32; *width = 0x4; return 0xFFFFFFFF;
+        default: *shift = 0; return 0x0;
+    }
+}
+
+
+/** Start a streaming checksum of type `algorithm` (a CHECKSUM_* value) in `ctx`; Return 0, or -1 for an unknown algorithm */
+int checksum_init(checksum_ctx *__restrict__ ctx, const unsigned int algorithm) {
+    size_t width;
+    unsigned int shift;
+    uint64_t start;
+    if (algorithm > CHECKSUM_FLETCHER64) return -1;
+    memset(ctx, 0x0, sizeof(checksum_ctx));
+    ctx->algorithm = (uint8_t)algorithm;
+    switch (algorithm) {
+        case CHECKSUM_CRC8: ctx->sum1 = 0xFF; break;
+        case CHECKSUM_CRC16: ctx->sum1 = 0xFFFF; break;
+        case CHECKSUM_CRC32: ctx->sum1 = 0x0; break;
+        case CHECKSUM_CRC32C: ctx->sum1 = crc32c_init(); break;
+        case CHECKSUM_ADLER8: ctx->sum1 = 0x1; break;
+        default:
+            (void)checksum_params(algorithm, &width, &shift, &start);
+            ctx->sum1 = start;
+            break;
+    }
+    return 0;
+}
+
+
+/** Feed `len` bytes into a streaming checksum; Chunks may have any length and alignment and give the same result as one contiguous buffer */
+void checksum_update(checksum_ctx *__restrict__ ctx, const uint8_t *__restrict__ data, size_t len) {
+    size_t width, take, index;
+    unsigned int shift;
+    uint64_t start;
+    const uint64_t modulus = checksum_params(ctx->algorithm, &width, &shift, &start);
+    register uint8_t a, b;
+    ctx->length += len;
+    switch (ctx->algorithm) {
+        case CHECKSUM_CRC8: ctx->sum1 = crc8_feed((uint8_t)ctx->sum1, data, len); return;
+        case CHECKSUM_CRC16: ctx->sum1 = crc16_feed((uint16_t)ctx->sum1, data, len); return;
+        case CHECKSUM_CRC32: ctx->sum1 = crc32((uint32_t)ctx->sum1, data, len); return;
+        case CHECKSUM_CRC32C: ctx->sum1 = crc32c_update((uint32_t)ctx->sum1, data, len); return;
+        case CHECKSUM_ADLER8:  // Keeps the byte truncation of `adler8()`
+            a = (uint8_t)ctx->sum1;
+            b = (uint8_t)ctx->sum2;
+            for (index = 0x0; index < len; ++index) {
+                a = ((uint8_t)(a + (uint8_t)data[index]) % (uint8_t)0xF);
+                b = ((uint8_t)(b + a) % (uint8_t)0xF);
+            }
+            ctx->sum1 = a;
+            ctx->sum2 = b;
+            return;
+        default:
+            break;
+    }
+    if (ctx->npending) {  // Complete a Fletcher element split across calls
+        take = (width - ctx->npending);
+        if (take > len) take = len;
+        memcpy(ctx->pending + ctx->npending, data, take);
+        ctx->npending = (uint8_t)(ctx->npending + take);
+        data += take;
+        len -= take;
+        if (ctx->npending < width) return;
+        fletcher_accumulate(&ctx->sum1, &ctx->sum2, ctx->pending, 0x1, width, modulus);
+        ctx->npending = 0x0;
+    }
+    fletcher_accumulate(&ctx->sum1, &ctx->sum2, data, (len / width), width, modulus);
+    take = (len % width);
+    if (take) {
+        memcpy(ctx->pending, data + (len - take), take);
+        ctx->npending = (uint8_t)take;
+    }
+}
+
+
+/** Return the value of a streaming checksum; `ctx` is left untouched, so more data may follow; A partial final Fletcher element is zero-padded */
+uint64_t checksum_final(const checksum_ctx *__restrict__ ctx) {
+    size_t width;
+    unsigned int shift;
+    uint64_t start, sum1 = ctx->sum1, sum2 = ctx->sum2;
+    uint32_t element = 0x0;  // Zero-padded final element; A scalar, as a 4-byte array trips -Wstack-protector
+    const uint64_t modulus = checksum_params(ctx->algorithm, &width, &shift, &start);
+    switch (ctx->algorithm) {
+        case CHECKSUM_CRC8:
+        case CHECKSUM_CRC16:
+        case CHECKSUM_CRC32: return ctx->sum1;
+        case CHECKSUM_CRC32C: return crc32c_final((uint32_t)ctx->sum1);
+        case CHECKSUM_ADLER8: return (uint64_t)((uint8_t)((uint8_t)(ctx->sum2 << 4) | (uint8_t)ctx->sum1));
+        default: break;
+    }
+    if (ctx->npending) {
+        memcpy(&element, ctx->pending, ctx->npending);
+        fletcher_accumulate(&sum1, &sum2, &element, 0x1, width, modulus);
+    }
+    return (uint64_t)((sum2 << shift) | sum1);
+}
+
+
+/** Copy the state of a streaming checksum so that both copies can continue independently */
+void checksum_clone(checksum_ctx *__restrict__ dest, const checksum_ctx *__restrict__ src) {
+    memcpy(dest, src, sizeof(checksum_ctx));
 }
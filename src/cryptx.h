@@ -34,14 +34,61 @@ License along with this library.
 #define FILE_CRYPTX_SEEN
 
 
+#include <stddef.h>  // Must precede MACROS.h, which redefines ptrdiff_t before <immintrin.h> can typedef it
 #include "MACROS.h"
 
 #include <time.h>
 #ifdef OSPOSIX
 #   include <sys/time.h>  // http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/sys_time.h.html
+#   include <unistd.h>  // http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/unistd.h.html
+#endif
+#ifdef __PTHREAD_ENABLED__
+#   include <pthread.h>
+#endif
+
+#if (defined(INTEL64) && defined(__GNUC__))
+#   include <immintrin.h>
+#   define CRYPTX_X86_DISPATCH  // Kernels for newer x86 extensions are built with `__attribute__((target()))` and chosen at runtime
+#endif
+
+#if (defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L))
+#   define PRNG_THREAD_LOCAL   _Thread_local
+#elif defined(__GNUC__)
+#   define PRNG_THREAD_LOCAL   __thread
+#else
+#   define PRNG_THREAD_LOCAL  // No thread-local storage; `prng_thread_state()` is then shared by all threads
 #endif
 
 #define TREYFER_NUMROUNDS   ((uint8_t)(32))
+#define SHUFFLE_BLOCK   (0x10000)  // Elements that each MergeShuffle block holds (256 KiB of `uint32_t`, so a block shuffles in cache)
+#define SHUFFLE_PARALLEL_MIN   (0x100000)  // Smaller arrays are shuffled in place by Fisher-Yates
+#define TEA_CTR_BLOCKS   (64)  // Counter blocks that `tea_ctr()` and `xtea_ctr()` encrypt per batch
+#define XXTEA_LANES_MAX_ITEMS   (64)  // Longest XXTEA array that the AVX2 multi-block engine handles; Longer arrays use `xxtea_cipher()`
+#define XOR_KEY_STACK   (0x400)  // `xor_cipher_buf()` keys up to this length are repeated on the stack; Longer keys need a heap pattern
+#define XOR_PATTERN_SLACK   (0x100)  // Pattern bytes past the key, so four 64-byte loads can start at any key offset
+#define ANUBIS_BLOCK_SIZE   (16)
+#define ANUBIS_MIN_KEY_SIZE   (16)  // Key sizes run from 16 to 40 bytes in steps of 4
+#define ANUBIS_MAX_KEY_SIZE   (40)
+#define ANUBIS_MAX_ROUNDS   (18)  // 8 + (key size / 4)
+#define ANUBIS_LANES   (4)  // Independent counter blocks that `anubis_ctr()` runs through the rounds together
+#define CRC32C_LONG   (8192)  // Bytes per stream in the long blocks of the three-way hardware CRC32C
+#define CRC32C_SHORT   (256)  // Bytes per stream in the short blocks of the three-way hardware CRC32C
+#define ADLER32_BASE   (0xFFF1U)  // Largest prime below 2^16
+#define ADLER32_NMAX   (5552)  // Most bytes that may be summed before `b` (and the 32-bit SIMD lanes) could overflow
+#define ADLER64_BASE   (0xFFFFFFF1ULL)  // Largest prime below 2^32
+#define FLETCHER_NMAX   ADLER32_NMAX  // Elements summed between reductions; every byte plane of an element obeys the Adler-32 bound
+#define CHECKSUM_CRC8   (0x00)  // Streaming checksum identifiers for `checksum_init()`
+#define CHECKSUM_CRC16   (0x01)
+#define CHECKSUM_CRC32   (0x02)  // Same as `crc32(0x0, ...)`
+#define CHECKSUM_CRC32C   (0x03)
+#define CHECKSUM_ADLER8   (0x04)
+#define CHECKSUM_ADLER16   (0x05)
+#define CHECKSUM_ADLER32   (0x06)
+#define CHECKSUM_ADLER64   (0x07)
+#define CHECKSUM_FLETCHER8   (0x08)
+#define CHECKSUM_FLETCHER16   (0x09)
+#define CHECKSUM_FLETCHER32   (0x0A)  // 16-bit native-endian elements
+#define CHECKSUM_FLETCHER64   (0x0B)  // 32-bit native-endian elements
 
 
 #define byteswap8(x)   endianswap8((x))
@@ -52,9 +99,32 @@ License along with this library.
 
 /* DATATYPES */
 typedef struct { uint8_t R, i, j, k; } quaternion_crypt_byte;
+/** State of the xoshiro256** generator (`prng_seed()`); Any state that is not all zero is valid */
+typedef struct prng_state { uint64_t s[4]; } prng_state;
+/** State of a streaming checksum (`checksum_init()`, `checksum_update()`, `checksum_final()`, `checksum_clone()`) */
+typedef struct checksum_ctx {
+    uint64_t sum1, sum2;  // CRC register in `sum1`, otherwise the reduced Adler/Fletcher sums
+    uint64_t length;  // Bytes fed so far
+    uint8_t pending[4];  // Bytes of an incomplete Fletcher-32/64 element
+    uint8_t npending;
+    uint8_t algorithm;  // CHECKSUM_* identifier
+    uint16_t reserved;  // Fills the context out to 32 bytes
+} checksum_ctx;
+/** Expanded Anubis key (`anubis_setkey()`) */
+typedef struct anubis_ctx {
+    uint32_t E[ANUBIS_MAX_ROUNDS + 1][4];  // Encryption round keys
+    uint32_t D[ANUBIS_MAX_ROUNDS + 1][4];  // Decryption round keys
+    int rounds;
+} anubis_ctx;
 /* CONSTANTS */
 extern const uint16_t crc16_table[256];
 extern const uint32_t crc32_table[256];
+extern const uint32_t crc32_slice_table[16][256];
+extern const uint32_t crc32_x2n_table[64];
+extern const uint32_t crc32c_table[8][256];
+extern const uint32_t crc32c_long_shift[4][256];
+extern const uint32_t crc32c_short_shift[4][256];
+extern const uint32_t crc32c_x2n_table[64];
 extern const uint8_t Sbox[256];
 extern const u32 ANUBIS_T0[256];
 extern const u32 ANUBIS_T1[256];
@@ -64,6 +134,23 @@ extern const u32 ANUBIS_T4[256];
 extern const u32 ANUBIS_T5[256];
 extern const u32 ANUBIS_RC[];
 /* FUNCTIONS */
+#ifdef __GNUC__
+void prng_seed(prng_state *__restrict__ state, const uint64_t seed) __attribute__((nonnull));
+uint64_t prng_next(prng_state *__restrict__ state) __attribute__((hot, nonnull));
+void prng_jump(prng_state *__restrict__ state) __attribute__((nonnull));
+void prng_long_jump(prng_state *__restrict__ state) __attribute__((nonnull));
+void prng_fill(prng_state *__restrict__ state, void *__restrict__ buf, size_t len) __attribute__((nonnull(1)));
+prng_state *prng_thread_state(void) __attribute__((returns_nonnull));
+void fill_random(void *__restrict__ buf, const size_t len);
+#else
+void prng_seed(prng_state *__restrict__ state, const uint64_t seed);
+uint64_t prng_next(prng_state *__restrict__ state);
+void prng_jump(prng_state *__restrict__ state);
+void prng_long_jump(prng_state *__restrict__ state);
+void prng_fill(prng_state *__restrict__ state, void *__restrict__ buf, size_t len);
+prng_state *prng_thread_state(void);
+void fill_random(void *__restrict__ buf, const size_t len);
+#endif
 int randomint(void);
 ulint randomlong(void);
 char *randstr(const size_t length);
@@ -76,15 +163,21 @@ uint8_t endianswap8(uint8_t x) __attribute__((const));
 uint16_t endianswap16(uint16_t x) __attribute__((const));
 uint32_t endianswap32(uint32_t x) __attribute__((const));
 uint64_t endianswap64(uint64_t x) __attribute__((const));
+uint32_t prng_bounded32(prng_state *__restrict__ state, const uint32_t range) __attribute__((hot, nonnull));
+uint64_t prng_bounded(prng_state *__restrict__ state, const uint64_t range) __attribute__((hot, nonnull));
 void shuffle_int(signed int *__restrict__ array, const size_t num_items) __attribute__((nonnull));
 void shuffle_uint32(uint32_t *__restrict__ array, const uint32_t num_items) __attribute__((nonnull));
+void shuffle_uint32_parallel(uint32_t *__restrict__ array, const size_t num_items, unsigned int num_threads) __attribute__((nonnull));
 #else
 uint8_t endianswap8(uint8_t x);
 uint16_t endianswap16(uint16_t x);
 uint32_t endianswap32(uint32_t x);
 uint64_t endianswap64(uint64_t x);
+uint32_t prng_bounded32(prng_state *__restrict__ state, const uint32_t range);
+uint64_t prng_bounded(prng_state *__restrict__ state, const uint64_t range);
 void shuffle_int(signed int *__restrict__ array, const size_t num_items);
 void shuffle_uint32(uint32_t *__restrict__ array, const uint32_t num_items);
+void shuffle_uint32_parallel(uint32_t *__restrict__ array, const size_t num_items, unsigned int num_threads);
 #endif
 void byte_rotl(uint8_t byte, const uint8_t num);
 void byte_rotr(uint8_t byte, const uint8_t num);
@@ -101,6 +194,8 @@ void caesar_cipher(char *__restrict__ data, const ulint shift) __attribute__((no
 void decrypt_caesar_cipher(char *__restrict__ data, const ulint shift) __attribute__((nonnull));
 void xor_cipher(char *__restrict__ data, const char *__restrict__ password) __attribute__((nonnull));
 void nxor_cipher(char *__restrict__ data, const char *__restrict__ password) __attribute__((nonnull));
+void xor_cipher_buf(uint8_t *__restrict__ data, const size_t len, const uint8_t *__restrict__ key, const size_t keylen) __attribute__((nonnull(3)));
+void nxor_cipher_buf(uint8_t *__restrict__ data, const size_t len, const uint8_t *__restrict__ key, const size_t keylen) __attribute__((nonnull(3)));
 #else
 void array_rotl(uint8_t *__restrict__ array, const size_t len, const uint32_t num_shifts);
 void array_rotl64(uint8_t *__restrict__ array, const uint64_t len, const uint64_t num_shifts);
@@ -114,6 +209,8 @@ void caesar_cipher(char *__restrict__ data, const ulint shift);
 void decrypt_caesar_cipher(char *__restrict__ data, const ulint shift);
 void xor_cipher(char *__restrict__ data, const char *__restrict__ password);
 void nxor_cipher(char *__restrict__ data, const char *__restrict__ password);
+void xor_cipher_buf(uint8_t *__restrict__ data, const size_t len, const uint8_t *__restrict__ key, const size_t keylen);
+void nxor_cipher_buf(uint8_t *__restrict__ data, const size_t len, const uint8_t *__restrict__ key, const size_t keylen);
 #endif
 void tea_cipher(uint32_t *__restrict__ v, const uint32_t *__restrict__ k);
 void decrypt_tea_cipher(uint32_t *__restrict__ v, const uint32_t *__restrict__ k);
@@ -123,6 +220,34 @@ void xxtea_cipher(uint32_t *__restrict__ v, const int32_t num_items, const uint3
 void treyfer_cipher(uint8_t text[8], const uint8_t key[8]);
 void decrypt_treyfer_cipher(uint8_t text[8], const uint8_t key[8]);
 #ifdef __GNUC__
+void tea_cipher_blocks(uint32_t *__restrict__ v, const size_t nblocks, const uint32_t *__restrict__ k) __attribute__((nonnull(3)));
+void decrypt_tea_cipher_blocks(uint32_t *__restrict__ v, const size_t nblocks, const uint32_t *__restrict__ k) __attribute__((nonnull(3)));
+void xtea_cipher_blocks(const uint32_t num_rounds, uint32_t *__restrict__ v, const size_t nblocks, const uint32_t key[4]) __attribute__((nonnull(4)));
+void decrypt_xtea_cipher_blocks(const uint32_t num_rounds, uint32_t *__restrict__ v, const size_t nblocks, const uint32_t key[4]) __attribute__((nonnull(4)));
+void xxtea_cipher_blocks(uint32_t *__restrict__ v, const size_t nblocks, const int32_t num_items, const uint32_t key[4]) __attribute__((nonnull(4)));
+void tea_ctr(const uint32_t k[4], uint64_t *__restrict__ counter, uint8_t *dest, const uint8_t *src, size_t len) __attribute__((nonnull(1, 2)));
+void xtea_ctr(const uint32_t num_rounds, const uint32_t key[4], uint64_t *__restrict__ counter, uint8_t *dest, const uint8_t *src, size_t len) __attribute__((nonnull(2, 3)));
+#else
+void tea_cipher_blocks(uint32_t *__restrict__ v, const size_t nblocks, const uint32_t *__restrict__ k);
+void decrypt_tea_cipher_blocks(uint32_t *__restrict__ v, const size_t nblocks, const uint32_t *__restrict__ k);
+void xtea_cipher_blocks(const uint32_t num_rounds, uint32_t *__restrict__ v, const size_t nblocks, const uint32_t key[4]);
+void decrypt_xtea_cipher_blocks(const uint32_t num_rounds, uint32_t *__restrict__ v, const size_t nblocks, const uint32_t key[4]);
+void xxtea_cipher_blocks(uint32_t *__restrict__ v, const size_t nblocks, const int32_t num_items, const uint32_t key[4]);
+void tea_ctr(const uint32_t k[4], uint64_t *__restrict__ counter, uint8_t *dest, const uint8_t *src, size_t len);
+void xtea_ctr(const uint32_t num_rounds, const uint32_t key[4], uint64_t *__restrict__ counter, uint8_t *dest, const uint8_t *src, size_t len);
+#endif
+#ifdef __GNUC__
+int anubis_setkey(anubis_ctx *__restrict__ ctx, const uint8_t *__restrict__ key, const size_t key_len) __attribute__((nonnull));
+void anubis_encrypt(const anubis_ctx *__restrict__ ctx, uint8_t dest[ANUBIS_BLOCK_SIZE], const uint8_t src[ANUBIS_BLOCK_SIZE]) __attribute__((flatten, nonnull));
+void anubis_decrypt(const anubis_ctx *__restrict__ ctx, uint8_t dest[ANUBIS_BLOCK_SIZE], const uint8_t src[ANUBIS_BLOCK_SIZE]) __attribute__((flatten, nonnull));
+void anubis_ctr(const anubis_ctx *__restrict__ ctx, uint8_t counter[ANUBIS_BLOCK_SIZE], uint8_t *dest, const uint8_t *src, size_t len) __attribute__((flatten, nonnull(1, 2)));
+#else
+int anubis_setkey(anubis_ctx *__restrict__ ctx, const uint8_t *__restrict__ key, const size_t key_len);
+void anubis_encrypt(const anubis_ctx *__restrict__ ctx, uint8_t dest[ANUBIS_BLOCK_SIZE], const uint8_t src[ANUBIS_BLOCK_SIZE]);
+void anubis_decrypt(const anubis_ctx *__restrict__ ctx, uint8_t dest[ANUBIS_BLOCK_SIZE], const uint8_t src[ANUBIS_BLOCK_SIZE]);
+void anubis_ctr(const anubis_ctx *__restrict__ ctx, uint8_t counter[ANUBIS_BLOCK_SIZE], uint8_t *dest, const uint8_t *src, size_t len);
+#endif
+#ifdef __GNUC__
 void quaternion_encryption32(uint8_t *__restrict__ data, const uint32_t datasize, const uint8_t *__restrict__ key) __attribute__((flatten, nonnull));
 void quaternion_decryption32(uint8_t *__restrict__ data, const uint32_t datasize, const uint8_t *__restrict__ key) __attribute__((flatten, nonnull));
 void quaternion_encryption64(uint8_t *__restrict__ data, const uint32_t datasize, const uint8_t *__restrict__ key) __attribute__((flatten, nonnull));
@@ -155,32 +280,71 @@ uint16_t crc16memx(const uint8_t *data);
 #endif
 uint32_t crc32(uint32_t crc, const uint8_t *__restrict__ data, const size_t len);
 uint32_t crc32x(uint32_t crc, const uint8_t *__restrict__ data);
+#ifdef __GNUC__
+uint32_t crc32_slice8(uint32_t crc, const uint8_t *__restrict__ data, size_t len) __attribute__((flatten, pure));
+uint32_t crc32_slice16(uint32_t crc, const uint8_t *__restrict__ data, size_t len) __attribute__((flatten, pure));
+uint32_t crc32_shift(uint32_t crc, uint64_t len) __attribute__((const));
+uint32_t crc32_combine(const uint32_t crc1, const uint32_t crc2, const uint64_t len2) __attribute__((const));
+#   ifdef CRYPTX_X86_DISPATCH
+uint32_t crc32_clmul(uint32_t crc, const uint8_t *__restrict__ data, size_t len) __attribute__((flatten, pure));
+uint32_t crc32c_hw(uint32_t crc, const uint8_t *__restrict__ data, size_t len) __attribute__((flatten, pure));
+#   endif
+uint32_t crc32c_init(void) __attribute__((const));
+uint32_t crc32c_sw(uint32_t crc, const uint8_t *__restrict__ data, size_t len) __attribute__((flatten, pure));
+uint32_t crc32c_update(uint32_t crc, const uint8_t *__restrict__ data, const size_t len) __attribute__((flatten, pure));
+uint32_t crc32c_final(const uint32_t crc) __attribute__((const));
+uint32_t crc32c(const uint8_t *__restrict__ data, const size_t len) __attribute__((flatten, pure));
+uint32_t crc32c_combine(const uint32_t crc1, const uint32_t crc2, uint64_t len2) __attribute__((const));
+#else
+uint32_t crc32_slice8(uint32_t crc, const uint8_t *__restrict__ data, size_t len);
+uint32_t crc32_slice16(uint32_t crc, const uint8_t *__restrict__ data, size_t len);
+uint32_t crc32_shift(uint32_t crc, uint64_t len);
+uint32_t crc32_combine(const uint32_t crc1, const uint32_t crc2, const uint64_t len2);
+uint32_t crc32c_init(void);
+uint32_t crc32c_sw(uint32_t crc, const uint8_t *__restrict__ data, size_t len);
+uint32_t crc32c_update(uint32_t crc, const uint8_t *__restrict__ data, const size_t len);
+uint32_t crc32c_final(const uint32_t crc);
+uint32_t crc32c(const uint8_t *__restrict__ data, const size_t len);
+uint32_t crc32c_combine(const uint32_t crc1, const uint32_t crc2, uint64_t len2);
+#endif
 #ifdef INTEL64
 uint32_t fastcrc32(char *str, const uint32_t len);
 #endif
 #ifdef __GNUC__
 uint8_t adler8(const uint8_t *__restrict__ data, register size_t len) __attribute__((const, flatten, nonnull));
 uint16_t adler16(const uint8_t *__restrict__ data, register size_t len) __attribute__((const, flatten, nonnull));
-uint32_t adler32(const uint8_t *__restrict__ data, register size_t len) __attribute__((const, flatten, nonnull));
-uint64_t adler64(const uint8_t *__restrict__ data, register size_t len) __attribute__((const, flatten, nonnull));
+uint32_t adler32(const uint8_t *__restrict__ data, register size_t len) __attribute__((flatten, nonnull, pure));
+uint32_t adler32_update(uint32_t adler, const uint8_t *__restrict__ data, size_t len) __attribute__((flatten, pure));
+uint32_t adler32_combine(const uint32_t adler1, const uint32_t adler2, const uint64_t len2) __attribute__((const));
+uint64_t adler64(const uint8_t *__restrict__ data, register size_t len) __attribute__((flatten, nonnull, pure));
+uint64_t adler64_update(uint64_t adler, const uint8_t *__restrict__ data, size_t len) __attribute__((flatten, pure));
+uint64_t adler64_combine(const uint64_t adler1, const uint64_t adler2, const uint64_t len2) __attribute__((const));
 uint64_t antiadler64(const uint8_t *__restrict__ data, register size_t len) __attribute__((const, flatten, nonnull));
 uint64_t antiadler64rev2(const uint8_t *__restrict__ data, register size_t len) __attribute__((const, flatten, nonnull));
 #ifdef UINT128_SUPPORTED
 uint128_t adler128(const uint8_t *__restrict__ data, register size_t len) __attribute__((const, flatten, nonnull));
 #endif
 uint8_t fletcher8(const uint8_t *__restrict__ data, const size_t count) __attribute__((const, flatten, nonnull));
-uint16_t fletcher16(const uint8_t *__restrict__ data, const size_t count) __attribute__((const, flatten, nonnull));
+uint16_t fletcher16(const uint8_t *__restrict__ data, const size_t count) __attribute__((flatten, nonnull, pure));
 uint16_t fletcher16fast(const uint8_t *__restrict__ data, const size_t words) __attribute__((const, flatten, nonnull));
-uint32_t fletcher32(const uint16_t *__restrict__ data, const size_t count) __attribute__((const, flatten, nonnull));
+uint32_t fletcher32(const uint16_t *__restrict__ data, const size_t count) __attribute__((flatten, nonnull, pure));
 uint32_t fletcher32fast(const uint16_t *__restrict__ data, const size_t words) __attribute__((const, flatten, nonnull));
-uint64_t fletcher64(const uint32_t *__restrict__ data, const size_t count) __attribute__((const, flatten, nonnull));
-uint64_t fletcher64char(const uint8_t *__restrict__ data, const size_t count) __attribute__((const, flatten, nonnull));
-uint32_t collier32(const uint16_t *__restrict__ data, const size_t count) __attribute__((const, flatten, nonnull));
+uint64_t fletcher64(const uint32_t *__restrict__ data, const size_t count) __attribute__((flatten, nonnull, pure));
+uint64_t fletcher64char(const uint8_t *__restrict__ data, const size_t count) __attribute__((flatten, nonnull, pure));
+uint32_t collier32(const uint16_t *__restrict__ data, const size_t count) __attribute__((flatten, nonnull, pure));
+int checksum_init(checksum_ctx *__restrict__ ctx, const unsigned int algorithm) __attribute__((nonnull));
+void checksum_update(checksum_ctx *__restrict__ ctx, const uint8_t *__restrict__ data, size_t len) __attribute__((flatten, nonnull(1)));
+uint64_t checksum_final(const checksum_ctx *__restrict__ ctx) __attribute__((nonnull, pure));
+void checksum_clone(checksum_ctx *__restrict__ dest, const checksum_ctx *__restrict__ src) __attribute__((nonnull));
 #else
 uint8_t adler8(const uint8_t *__restrict__ data, register size_t len);
 uint16_t adler16(const uint8_t *__restrict__ data, register size_t len);
 uint32_t adler32(const uint8_t *__restrict__ data, register size_t len);
+uint32_t adler32_update(uint32_t adler, const uint8_t *__restrict__ data, size_t len);
+uint32_t adler32_combine(const uint32_t adler1, const uint32_t adler2, const uint64_t len2);
 uint64_t adler64(const uint8_t *__restrict__ data, register size_t len);
+uint64_t adler64_update(uint64_t adler, const uint8_t *__restrict__ data, size_t len);
+uint64_t adler64_combine(const uint64_t adler1, const uint64_t adler2, const uint64_t len2);
 uint64_t antiadler64(const uint8_t *__restrict__ data, register size_t len);
 uint64_t antiadler64rev2(const uint8_t *__restrict__ data, register size_t len);
 #ifdef UINT128_SUPPORTED
@@ -194,6 +358,10 @@ uint32_t fletcher32fast(const uint16_t *__restrict__ data, const size_t words);
 uint64_t fletcher64(const uint32_t *__restrict__ data, const size_t count);
 uint64_t fletcher64char(const uint8_t *__restrict__ data, const size_t count);
 uint32_t collier32(const uint16_t *__restrict__ data, const size_t count);
+int checksum_init(checksum_ctx *__restrict__ ctx, const unsigned int algorithm);
+void checksum_update(checksum_ctx *__restrict__ ctx, const uint8_t *__restrict__ data, size_t len);
+uint64_t checksum_final(const checksum_ctx *__restrict__ ctx);
+void checksum_clone(checksum_ctx *__restrict__ dest, const checksum_ctx *__restrict__ src);
 #endif
 
 #endif
@@ -0,0 +1,294 @@
+// -*- coding: utf-8 -*-
+// vim:fileencoding=utf-8
+/**
+@file pycompression.c
+@author Devyn Collier Johnson <DevynCJohnson@Gmail.com>
+@copyright LGPLv3
+
+@brief Compression Functions
+@version 2016.03.20
+
+@section DESCRIPTION
+This is a Python3 module that uses functions from compression.c
+Buffers are accepted through the buffer protocol (bytes, bytearray, memoryview, mmap) without being copied, and the GIL is released while zlib runs
+
+@section LICENSE
+GNU Lesser General Public License v3
+Copyright (c) Devyn Collier Johnson, All rights reserved.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 3.0 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library.
+*/
+
+
+#include "compression.h"  // Must precede PY_MACROS.h (see the ptrdiff_t note in compression.h)
+#include "PY_MACROS.h"
+
+#define MODNAME   "compression"
+#define MODINIT   PyMODINIT_FUNC PyInit_compression(void)
+MODINIT __attribute__((flatten, hot));
+
+
+/* FUNCTION DEFINITIONS */
+
+
+#ifdef __GNUC__
+static PyObject *compression_raise(const int ret) __attribute__((cold));
+static FILE *compression_fdopen(PyObject *fileobj, const char *mode) __attribute__((nonnull));
+static PyObject *compression_compress(FUNCARGS) __attribute__((flatten));
+static PyObject *compression_decompress(FUNCARGS) __attribute__((flatten));
+static PyObject *compression_compress_file(FUNCARGS) __attribute__((flatten));
+static PyObject *compression_decompress_file(FUNCARGS) __attribute__((flatten));
+static PyObject *compression_compress_stream(FUNCARGS) __attribute__((flatten));
+static PyObject *compression_decompress_stream(FUNCARGS) __attribute__((flatten));
+#else
+static PyObject *compression_raise(const int ret);
+static FILE *compression_fdopen(PyObject *fileobj, const char *mode);
+static PyObject *compression_compress(FUNCARGS);
+static PyObject *compression_decompress(FUNCARGS);
+static PyObject *compression_compress_file(FUNCARGS);
+static PyObject *compression_decompress_file(FUNCARGS);
+static PyObject *compression_compress_stream(FUNCARGS);
+static PyObject *compression_decompress_stream(FUNCARGS);
+#endif
+
+
+/* DOCSTRINGS */
+
+
+static char module_docstring[32] = "Compression Functions";
+PyDoc_STRVAR(compression_compress_docstring,
+    "compress(data: bytes-like, level: int = -1) -> bytes\nCompress a buffer into a zlib stream");
+PyDoc_STRVAR(compression_decompress_docstring,
+    "decompress(data: bytes-like) -> bytes\nDecompress a zlib or gzip stream held in a buffer; Concatenated gzip members are all decompressed\n\n>>> import gzip\n>>> decompress(gzip.compress(b'one') + gzip.compress(b'two'))\nb'onetwo'");
+PyDoc_STRVAR(compression_compress_file_docstring,
+    "compress_file(source: str, dest: str, level: int = -1, threads: int = 1) -> None\nCompress a file into a zlib stream; A threads value other than 1 deflates in parallel blocks (0 uses every processor)");
+PyDoc_STRVAR(compression_decompress_file_docstring,
+    "decompress_file(source: str, dest: str) -> None\nDecompress a zlib file with constant memory use");
+PyDoc_STRVAR(compression_compress_stream_docstring,
+    "compress_stream(source: file, dest: file, level: int = -1) -> None\nCompress from one file object (or descriptor) into another; The descriptors are used directly, so buffered Python data is not seen");
+PyDoc_STRVAR(compression_decompress_stream_docstring,
+    "decompress_stream(source: file, dest: file) -> None\nDecompress from one file object (or descriptor) into another; The descriptors are used directly, so buffered Python data is not seen");
+
+
+/* MODULE SPECIFICATION */
+
+
+static PyMethodDef module_methods[16] = {  // Method Table
+    {"compress", (PyCFunction)compression_compress, METH_VARARGS, compression_compress_docstring},
+    {"decompress", (PyCFunction)compression_decompress, METH_VARARGS, compression_decompress_docstring},
+    {"compress_file", (PyCFunction)compression_compress_file, METH_VARARGS, compression_compress_file_docstring},
+    {"decompress_file", (PyCFunction)compression_decompress_file, METH_VARARGS, compression_decompress_file_docstring},
+    {"compress_stream", (PyCFunction)compression_compress_stream, METH_VARARGS, compression_compress_stream_docstring},
+    {"decompress_stream", (PyCFunction)compression_decompress_stream, METH_VARARGS, compression_decompress_stream_docstring},
+    {NULL, NULL, 0, NULL}
+};
+
+
+static struct PyModuleDef module = {  // Module Definition
+    PyModuleDef_HEAD_INIT,
+    MODNAME,  // Module name
+    module_docstring,  // Module docstring
+    -1,  // Module size
+    module_methods,  // Module methods
+    NULL,  // Module reload
+    NULL,  // Module traverse
+    NULL,  // Module clear
+    NULL  // Module free
+};
+
+
+MODINIT {  // Initialize module
+    PyObject *m;
+    m = PyModule_Create(&module);
+#   ifndef NOAUTHOR
+    PyModule_AddStringConstant(m, "__author__", __author__);
+#   endif
+#   ifndef NOVERSION
+    PyModule_AddStringConstant(m, "__version__", __version__);
+#   endif
+    if (m == (PyObject *)NULL) return NULL;
+    return m;
+}
+
+
+/* C CODE */
+
+
+/* HELPERS */
+
+
+/** Private Function: Raise the Python exception that matches a zlib return code */
+static PyObject *compression_raise(const int ret) {
+    switch (ret) {
+        case Z_MEM_ERROR:
+            return PyErr_NoMemory();
+        case Z_ERRNO:
+            return PyErr_SetFromErrno(PyExc_OSError);
+        case Z_STREAM_ERROR:
+            PyErr_SetString(PyExc_ValueError, "zlib: Invalid compression level");
+            return NULL;
+        case Z_DATA_ERROR:
+            PyErr_SetString(PyExc_ValueError, "zlib: Invalid or incomplete deflate data");
+            return NULL;
+        case Z_BUF_ERROR:
+            PyErr_SetString(PyExc_ValueError, "zlib: Output buffer is too small");
+            return NULL;
+        case Z_VERSION_ERROR:
+            PyErr_SetString(PyExc_ValueError, "zlib: Version mismatch");
+            return NULL;
+        default:
+            PyErr_SetString(PyExc_ValueError, "zlib: Unknown error");
+            return NULL;
+    }
+}
+
+
+/** Private Function: Open a C stream on a duplicate of the descriptor behind a Python file object or integer */
+static FILE *compression_fdopen(PyObject *fileobj, const char *mode) {
+    if (PyObject_HasAttrString(fileobj, "flush")) {  // Push out data buffered by Python
+        PyObject *flushed = PyObject_CallMethod(fileobj, "flush", NULL);
+        if (flushed == (PyObject *)NULL) return (FILE *)NULL;
+        Py_DECREF(flushed);
+    }
+    const int fd = PyObject_AsFileDescriptor(fileobj);
+    if (fd < 0x00) return (FILE *)NULL;
+    const int dupfd = dup(fd);
+    if (dupfd < 0x00) {
+        PyErr_SetFromErrno(PyExc_OSError);
+        return (FILE *)NULL;
+    }
+    FILE *stream = fdopen(dupfd, mode);
+    if (stream == (FILE *)NULL) {
+        PyErr_SetFromErrno(PyExc_OSError);
+        close(dupfd);
+    }
+    return stream;
+}
+
+
+/* BUFFERS */
+
+
+static PyObject *compression_compress(FUNCARGS) {
+    Py_buffer view;
+    int level = Z_DEFAULT_COMPRESSION, ret;
+    if (!PyArg_ParseTuple(args, "y*|i", &view, &level)) return NULL;
+    size_t dest_len = (size_t)compressBound((uLong)view.len);
+    PyObject *output = PyBytes_FromStringAndSize(NULL, (Py_ssize_t)dest_len);
+    if (output == (PyObject *)NULL) {
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+    uint8_t *dest = (uint8_t *)PyBytes_AS_STRING(output);
+    Py_BEGIN_ALLOW_THREADS
+    ret = zlib_compress_buffer((const uint8_t *)view.buf, (size_t)view.len, dest, &dest_len, level);
+    Py_END_ALLOW_THREADS
+    PyBuffer_Release(&view);
+    if (ret != Z_OK) {
+        Py_DECREF(output);
+        return compression_raise(ret);
+    }
+    if (_PyBytes_Resize(&output, (Py_ssize_t)dest_len) != 0x00) return NULL;
+    return output;
+}
+
+
+static PyObject *compression_decompress(FUNCARGS) {
+    Py_buffer view;
+    uint8_t *dest = NULL;
+    size_t dest_len = 0x00;
+    int ret;
+    if (!PyArg_ParseTuple(args, "y*", &view)) return NULL;
+    Py_BEGIN_ALLOW_THREADS
+    ret = zlib_decompress_buffer((const uint8_t *)view.buf, (size_t)view.len, &dest, &dest_len);
+    Py_END_ALLOW_THREADS
+    PyBuffer_Release(&view);
+    if (ret != Z_OK) return compression_raise(ret);
+    PyObject *output = PyBytes_FromStringAndSize((const char *)dest, (Py_ssize_t)dest_len);
+    free(dest);
+    return output;
+}
+
+
+/* FILES */
+
+
+static PyObject *compression_compress_file(FUNCARGS) {
+    char *source_filename, *dest_filename;
+    int level = Z_DEFAULT_COMPRESSION, ret;
+    unsigned int threads = 0x01;
+    if (!PyArg_ParseTuple(args, "ss|iI", &source_filename, &dest_filename, &level, &threads)) return NULL;
+    Py_BEGIN_ALLOW_THREADS
+    ret = ((threads == 0x01) ? zlib_compress_file_mmap(source_filename, dest_filename, level) : zlib_compress_file(source_filename, dest_filename, level, threads));
+    Py_END_ALLOW_THREADS
+    if (ret != Z_OK) return compression_raise(ret);
+    Py_RETURN_NONE;
+}
+
+
+static PyObject *compression_decompress_file(FUNCARGS) {
+    char *source_filename, *dest_filename;
+    int ret;
+    ASSERT_2STRING_ARG(source_filename, dest_filename);
+    Py_BEGIN_ALLOW_THREADS
+    ret = zlib_decompress_file_mmap(source_filename, dest_filename);
+    Py_END_ALLOW_THREADS
+    if (ret != Z_OK) return compression_raise(ret);
+    Py_RETURN_NONE;
+}
+
+
+/* STREAMS */
+
+
+static PyObject *compression_compress_stream(FUNCARGS) {
+    PyObject *source_obj, *dest_obj;
+    int level = Z_DEFAULT_COMPRESSION, ret;
+    if (!PyArg_ParseTuple(args, "OO|i", &source_obj, &dest_obj, &level)) return NULL;
+    FILE *source = compression_fdopen(source_obj, "rb");
+    if (source == (FILE *)NULL) return NULL;
+    FILE *dest = compression_fdopen(dest_obj, "wb");
+    if (dest == (FILE *)NULL) {
+        fclose(source);
+        return NULL;
+    }
+    Py_BEGIN_ALLOW_THREADS
+    ret = zlib_compress_stream(source, dest, level);
+    fclose(source);
+    if (fclose(dest) != 0x00 && ret == Z_OK) ret = Z_ERRNO;
+    Py_END_ALLOW_THREADS
+    if (ret != Z_OK) return compression_raise(ret);
+    Py_RETURN_NONE;
+}
+
+
+static PyObject *compression_decompress_stream(FUNCARGS) {
+    PyObject *source_obj, *dest_obj;
+    int ret;
+    if (!PyArg_ParseTuple(args, "OO", &source_obj, &dest_obj)) return NULL;
+    FILE *source = compression_fdopen(source_obj, "rb");
+    if (source == (FILE *)NULL) return NULL;
+    FILE *dest = compression_fdopen(dest_obj, "wb");
+    if (dest == (FILE *)NULL) {
+        fclose(source);
+        return NULL;
+    }
+    Py_BEGIN_ALLOW_THREADS
+    ret = zlib_decompress_stream(source, dest);
+    fclose(source);
+    if (fclose(dest) != 0x00 && ret == Z_OK) ret = Z_ERRNO;
+    Py_END_ALLOW_THREADS
+    if (ret != Z_OK) return compression_raise(ret);
+    Py_RETURN_NONE;
+}
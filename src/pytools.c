@@ -61,6 +61,9 @@ static PyObject *tools_isstrhex(FUNCARGS) __attribute__((flatten));
 static PyObject *tools_strreplace(FUNCARGS) __attribute__((flatten));
 static PyObject *tools_strreplace_once(FUNCARGS) __attribute__((flatten));
 static PyObject *tools_rmgravequote(FUNCARGS) __attribute__((flatten));
+static PyObject *tools_filechecksums(FUNCARGS) __attribute__((flatten));
+static PyObject *tools_xor_cipher_buf(FUNCARGS) __attribute__((flatten));
+static PyObject *tools_nxor_cipher_buf(FUNCARGS) __attribute__((flatten));
 #else
 static PyObject *tools_lowercasestr(FUNCARGS);
 static PyObject *tools_lowercasestr15(FUNCARGS);
@@ -78,6 +81,9 @@ static PyObject *tools_isstrhex(FUNCARGS);
 static PyObject *tools_strreplace(FUNCARGS);
 static PyObject *tools_strreplace_once(FUNCARGS);
 static PyObject *tools_rmgravequote(FUNCARGS);
+static PyObject *tools_filechecksums(FUNCARGS);
+static PyObject *tools_xor_cipher_buf(FUNCARGS);
+static PyObject *tools_nxor_cipher_buf(FUNCARGS);
 #endif
 #if (defined(ENV64BIT) && (defined(__x86_64__) || defined(__x86_64)))
 static PyObject *tools_rdtsc(void);
@@ -232,6 +238,12 @@ PyDoc_STRVAR(tools_strreplace_once_docstring,
     "strreplace_once(orig_string: str, find: str, replace_with: str) -> str\nReplace first occurrence of \"find\" with \"replace_with\"");
 PyDoc_STRVAR(tools_rmgravequote_docstring,
     "rmgravequote(string: str) -> str\nFind and remove grave-quotes (`)");
+PyDoc_STRVAR(tools_filechecksums_docstring,
+    "filechecksums(filename: str, which: int = FILESUM_ALL, threads: int = 0) -> dict\nChecksum a file in one pass with `threads` parallel readers (0 = every CPU); `which` ORs FILESUM_* flags and the dict holds `length` plus the selected checksums");
+PyDoc_STRVAR(tools_xor_cipher_buf_docstring,
+    "xor_cipher_buf(data: bytes, key: bytes) -> bytes\nXOR each byte of the data with the repeated key (encrypts and decrypts)");
+PyDoc_STRVAR(tools_nxor_cipher_buf_docstring,
+    "nxor_cipher_buf(data: bytes, key: bytes) -> bytes\nNXOR each byte of the data with the repeated key (encrypts and decrypts)");
 #if (defined(ENV64BIT) && (defined(__x86_64__) || defined(__x86_64)))
 PyDoc_STRVAR(tools_rdtsc_docstring,
     "rdtsc() -> int\nThe rdtsc (Read Time-Stamp Counter) instruction is used to determine how many CPU ticks occurred since the processor was reset");
@@ -474,6 +486,9 @@ static PyMethodDef module_methods[128] = {  // Method Table
     {"strreplace", (PyCFunction)tools_strreplace, METH_VARARGS, tools_strreplace_docstring},
     {"strreplace_once", (PyCFunction)tools_strreplace_once, METH_VARARGS, tools_strreplace_once_docstring},
     {"rmgravequote", (PyCFunction)tools_rmgravequote, METH_VARARGS, tools_rmgravequote_docstring},
+    {"filechecksums", (PyCFunction)tools_filechecksums, METH_VARARGS, tools_filechecksums_docstring},
+    {"xor_cipher_buf", (PyCFunction)tools_xor_cipher_buf, METH_VARARGS, tools_xor_cipher_buf_docstring},
+    {"nxor_cipher_buf", (PyCFunction)tools_nxor_cipher_buf, METH_VARARGS, tools_nxor_cipher_buf_docstring},
 #if defined(ENV64BIT) && (defined(__x86_64__) || defined(__x86_64))
     {"rdtsc", (PyCFunction)tools_rdtsc, METH_NOARGS, tools_rdtsc_docstring},
     {"get_vendor_id", (PyCFunction)tools_get_vendor_id, METH_NOARGS, tools_get_vendor_id_docstring},
@@ -616,6 +631,15 @@ MODINIT {  // Initialize module
     PyModule_AddStringConstant(m, "__version__", __version__);
 #   endif
     if (m == (PyObject *)NULL) return NULL;
+    PyModule_AddIntConstant(m, "FILESUM_CRC32", FILESUM_CRC32);
+    PyModule_AddIntConstant(m, "FILESUM_CRC32C", FILESUM_CRC32C);
+    PyModule_AddIntConstant(m, "FILESUM_ADLER32", FILESUM_ADLER32);
+    PyModule_AddIntConstant(m, "FILESUM_ADLER64", FILESUM_ADLER64);
+    PyModule_AddIntConstant(m, "FILESUM_FLETCHER16", FILESUM_FLETCHER16);
+    PyModule_AddIntConstant(m, "FILESUM_FLETCHER32", FILESUM_FLETCHER32);
+    PyModule_AddIntConstant(m, "FILESUM_FLETCHER64", FILESUM_FLETCHER64);
+    PyModule_AddIntConstant(m, "FILESUM_PARITY", FILESUM_PARITY);
+    PyModule_AddIntConstant(m, "FILESUM_ALL", FILESUM_ALL);
     return m;
 }
 
@@ -949,6 +973,88 @@ static PyObject *tools_rmgravequote(FUNCARGS) {
 }
 
 
+/* FILE INTEGRITY */
+
+
+static PyObject *tools_filechecksums(FUNCARGS) {
+    const char *filename;
+    unsigned int which = FILESUM_ALL, num_threads = 0x0;
+    register unsigned int i;
+    filesums sums;
+    int ret;
+    PyObject *result, *value;
+    if (!PyArg_ParseTuple(args, "s|II", &filename, &which, &num_threads)) return NULL;
+    Py_BEGIN_ALLOW_THREADS
+    ret = filechecksums_parallel(filename, which, num_threads, &sums);
+    Py_END_ALLOW_THREADS
+    if (ret != 0x0) {
+        errno = ret;
+        return PyErr_SetFromErrnoWithFilename(PyExc_OSError, filename);
+    }
+    const struct { unsigned int flag; const char *key; uint64_t value; } fields[9] = {
+        { FILESUM_ALL, "length", sums.length },
+        { FILESUM_CRC32, "crc32", sums.crc32 },
+        { FILESUM_CRC32C, "crc32c", sums.crc32c },
+        { FILESUM_ADLER32, "adler32", sums.adler32 },
+        { FILESUM_ADLER64, "adler64", sums.adler64 },
+        { FILESUM_FLETCHER16, "fletcher16", sums.fletcher16 },
+        { FILESUM_FLETCHER32, "fletcher32", sums.fletcher32 },
+        { FILESUM_FLETCHER64, "fletcher64", sums.fletcher64 },
+        { FILESUM_PARITY, "parity", sums.parity }
+    };
+    result = PyDict_New();
+    if (result == (PyObject *)NULL) return NULL;
+    for (i = 0x0; i < 9; ++i) {
+        if (!(sums.which & fields[i].flag)) continue;
+        value = PyLong_FromUnsignedLongLong((unsigned long long)fields[i].value);
+        if (value == (PyObject *)NULL || PyDict_SetItemString(result, fields[i].key, value) != 0x0) {
+            Py_XDECREF(value);
+            Py_DECREF(result);
+            return NULL;
+        }
+        Py_DECREF(value);
+    }
+    return result;
+}
+
+
+/* CIPHERS */
+
+
+static PyObject *tools_xor_cipher_buf(FUNCARGS) {
+    Py_buffer data, key;
+    if (!PyArg_ParseTuple(args, "y*y*", &data, &key)) return NULL;
+    PyObject *output = PyBytes_FromStringAndSize(NULL, data.len);  // Not from `data.buf`, which may hand back a shared one-byte object
+    if (output != (PyObject *)NULL) {
+        uint8_t *dest = (uint8_t *)PyBytes_AS_STRING(output);
+        Py_BEGIN_ALLOW_THREADS
+        memcpy(dest, data.buf, (size_t)data.len);
+        xor_cipher_buf(dest, (size_t)data.len, (const uint8_t *)key.buf, (size_t)key.len);
+        Py_END_ALLOW_THREADS
+    }
+    PyBuffer_Release(&data);
+    PyBuffer_Release(&key);
+    return output;
+}
+
+
+static PyObject *tools_nxor_cipher_buf(FUNCARGS) {
+    Py_buffer data, key;
+    if (!PyArg_ParseTuple(args, "y*y*", &data, &key)) return NULL;
+    PyObject *output = PyBytes_FromStringAndSize(NULL, data.len);  // Not from `data.buf`, which may hand back a shared one-byte object
+    if (output != (PyObject *)NULL) {
+        uint8_t *dest = (uint8_t *)PyBytes_AS_STRING(output);
+        Py_BEGIN_ALLOW_THREADS
+        memcpy(dest, data.buf, (size_t)data.len);
+        nxor_cipher_buf(dest, (size_t)data.len, (const uint8_t *)key.buf, (size_t)key.len);
+        Py_END_ALLOW_THREADS
+    }
+    PyBuffer_Release(&data);
+    PyBuffer_Release(&key);
+    return output;
+}
+
+
 /* ASSEMBLY-RELATED COMMANDS */
 
 
@@ -956,10 +1062,9 @@ static PyObject *tools_rmgravequote(FUNCARGS) {
 
 
 static PyObject *tools_rdtsc(void) {
-    //register ullint cpu_ticks;
-    register ullint cpu_ticks;
-    __asm__ volatile ("rdtsc;" : "=A" ( cpu_ticks ));  // `=A` is `edx:eax`
-    return ull2int(cpu_ticks);
+    register uint32_t low, high;
+    __asm__ volatile ("rdtsc;" : "=a" ( low ), "=d" ( high ));  // `=A` only names one of `edx:eax` on x86-64
+    return ull2int((ullint)high << 32 | (ullint)low);
 }
 
 
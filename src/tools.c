@@ -1117,6 +1117,264 @@ uint32_t filecollier32(const char *__restrict__ filename) {
 }
 
 
+/** Private Function: Append a chunk's packed Fletcher sums (`sum2 << shift | sum1`, `count` elements) to the running packed sums */
+static uint64_t filesums_fletcher_join(const uint64_t sums, const uint64_t chunk, const uint64_t count, const unsigned int shift, const uint64_t modulus) {
+    const uint64_t mask = (((uint64_t)0x1 << shift) - 1);
+    const uint64_t sum1 = (((sums & mask) + (chunk & mask)) % modulus);
+    const uint64_t sum2 = (((sums >> shift) + (count % modulus) * (sums & mask) + (chunk >> shift)) % modulus);
+    return (uint64_t)((sum2 << shift) | sum1);
+}
+
+
+/** Private Function: Reset `sums` to the initial state of every checksum selected by `which` */
+static void filesums_init(filesums *__restrict__ sums, const unsigned int which) {
+    memset(sums, 0x0, sizeof(filesums));
+    sums->which = (which & FILESUM_ALL);
+    sums->crc32c = crc32c_init();
+    sums->adler32 = 0x1;
+    sums->adler64 = 0x1;
+}
+
+
+/** Private Function: Feed one chunk of the file into every checksum selected in `sums->which`; Every chunk but the last is a multiple of 8 bytes */
+static void filesums_update(filesums *__restrict__ sums, const uint8_t *__restrict__ data, const size_t len) {
+    const unsigned int which = sums->which;
+    uint64_t word, parity = 0x0;
+    uint32_t pad[2] = { 0x0, 0x0 };
+    register size_t i;
+    if (which & FILESUM_CRC32) sums->crc32 = crc32(sums->crc32, data, len);
+    if (which & FILESUM_CRC32C) sums->crc32c = crc32c_update(sums->crc32c, data, len);
+    if (which & FILESUM_ADLER32) sums->adler32 = adler32_update(sums->adler32, data, len);
+    if (which & FILESUM_ADLER64) sums->adler64 = adler64_update(sums->adler64, data, len);
+    if (which & FILESUM_FLETCHER16) sums->fletcher16 = (uint16_t)filesums_fletcher_join(sums->fletcher16, fletcher16(data, len), len, 8, 0xFF);
+    if (which & (FILESUM_FLETCHER32 | FILESUM_FLETCHER64)) memcpy(pad, data + (len & ~(size_t)0x3), (len & 0x3));
+#   ifdef __clang__
+#      pragma GCC diagnostic ignored "-Wcast-align"
+#   endif
+    if (which & FILESUM_FLETCHER32) {
+        sums->fletcher32 = (uint32_t)filesums_fletcher_join(sums->fletcher32, fletcher32((const uint16_t *)data, (len >> 1)), (len >> 1), 16, 0xFFFF);
+        if (len & 0x1) sums->fletcher32 = (uint32_t)filesums_fletcher_join(sums->fletcher32, fletcher32((const uint16_t *)(const void *)pad + ((len & 0x3) >> 1), 1), 1, 16, 0xFFFF);
+    }
+    if (which & FILESUM_FLETCHER64) {
+        sums->fletcher64 = filesums_fletcher_join(sums->fletcher64, fletcher64((const uint32_t *)data, (len >> 2)), (len >> 2), 32, 0xFFFFFFFF);
+        if (len & 0x3) sums->fletcher64 = filesums_fletcher_join(sums->fletcher64, fletcher64(pad, 1), 1, 32, 0xFFFFFFFF);
+    }
+#   ifdef __clang__
+#      pragma GCC diagnostic warning "-Wcast-align"
+#   endif
+    if (which & FILESUM_PARITY) {
+        for (i = 0x0; (i + 8) <= len; i += 8) {
+            memcpy(&word, data + i, 8);
+            parity ^= word;
+        }
+        for (; i < len; ++i) parity ^= data[i];
+        parity ^= (parity >> 32);
+        sums->parity = (uint8_t)(sums->parity ^ bitparity64(parity));
+    }
+    sums->length += len;
+}
+
+
+/** Open the specified file and compute every checksum selected by `which` (FILESUM_* flags) in a single pass; Memory use is bounded by FILESUM_WINDOW (mmap windows on POSIX, otherwise a read buffer); Return 0 on success or an errno value */
+int filechecksums(const char *__restrict__ filename, const unsigned int which, filesums *__restrict__ sums) {
+    FILE *fileptr;
+    uint8_t *buffer;
+    register size_t got;
+    if (filename == (const char *)NULL || sums == (filesums *)NULL || (which & FILESUM_ALL) == 0x0) return EINVAL;
+    filesums_init(sums, which);
+#   ifdef OSPOSIX
+    struct stat filestat;
+    void *window;
+    off_t offset = 0x0;
+    size_t len;
+    const int fd = open(filename, O_RDONLY);
+    if (fd < 0) return errno;
+    if (fstat(fd, &filestat) == 0x0 && S_ISREG(filestat.st_mode)) {
+        for (; offset < filestat.st_size; offset += (off_t)len) {
+            len = (((filestat.st_size - offset) > FILESUM_WINDOW) ? FILESUM_WINDOW : (size_t)(filestat.st_size - offset));
+            window = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, offset);
+            if (window == MAP_FAILED) break;  // Finish with buffered reads
+            (void)madvise(window, len, MADV_SEQUENTIAL);
+            filesums_update(sums, (const uint8_t *)window, len);
+            munmap(window, len);
+        }
+        if (offset >= filestat.st_size) {
+            close(fd);
+            sums->crc32c = crc32c_final(sums->crc32c);
+            return 0;
+        }
+        if (lseek(fd, offset, SEEK_SET) != offset) {
+            const int err = errno;
+            close(fd);
+            return err;
+        }
+    }
+    fileptr = fdopen(fd, "rb");
+    if (fileptr == (FILE *)NULL) {
+        const int err = errno;
+        close(fd);
+        return err;
+    }
+#   else
+    fileptr = fopen(filename, "rb");
+    if (fileptr == (FILE *)NULL) return errno;
+#   endif
+    buffer = (uint8_t *)malloc(FILESUM_WINDOW);
+    if (buffer == (uint8_t *)NULL) {
+        fclose(fileptr);
+        return ENOMEM;
+    }
+    do {
+        got = fread(buffer, 0x1, FILESUM_WINDOW, fileptr);  // Only the final read is short, so chunks stay whole elements
+        if (got) filesums_update(sums, buffer, got);
+    } while (got == FILESUM_WINDOW);
+    free(buffer);
+    if (ferror(fileptr)) {
+        fclose(fileptr);
+        return EIO;
+    }
+    fclose(fileptr);
+    sums->crc32c = crc32c_final(sums->crc32c);
+    return 0;
+}
+
+
+/** Private Function: Append the checksums of the range that follows `sums` (started from the initial state and finished) to `sums` */
+static void filesums_merge(filesums *__restrict__ sums, const filesums *__restrict__ next) {
+    sums->crc32 = crc32_combine(sums->crc32, next->crc32, next->length);
+    sums->crc32c = crc32c_combine(sums->crc32c, next->crc32c, next->length);
+    sums->adler32 = adler32_combine(sums->adler32, next->adler32, next->length);
+    sums->adler64 = adler64_combine(sums->adler64, next->adler64, next->length);
+    sums->fletcher16 = (uint16_t)filesums_fletcher_join(sums->fletcher16, next->fletcher16, next->length, 8, 0xFF);
+    sums->fletcher32 = (uint32_t)filesums_fletcher_join(sums->fletcher32, next->fletcher32, ((next->length + 1) >> 1), 16, 0xFFFF);
+    sums->fletcher64 = filesums_fletcher_join(sums->fletcher64, next->fletcher64, ((next->length + 3) >> 2), 32, 0xFFFFFFFF);
+    sums->parity = (uint8_t)(sums->parity ^ next->parity);
+    sums->length += next->length;
+}
+
+
+#ifdef OSPOSIX
+/** One byte range of the file handled by a `filechecksums_parallel()` worker */
+typedef struct filesums_job {
+    filesums sums;
+    uint64_t offset, length;
+    unsigned int which;
+    int fd, ret;  // `ret` is 0 or an errno value
+    int reserved;  // Rounds the job up to a multiple of 8 bytes
+} filesums_job;
+
+
+/** Private Function: Worker of `filechecksums_parallel()`; Checksum one byte range of the file with `pread()` through a FILESUM_WINDOW buffer */
+static void *filesums_range(void *arg) {
+    filesums_job *job = (filesums_job *)arg;
+    uint8_t *buffer = (uint8_t *)malloc(FILESUM_WINDOW);
+    uint64_t done = 0x0;
+    size_t want, have;
+    ssize_t got;
+    filesums_init(&job->sums, job->which);
+    job->ret = 0;
+    if (buffer == (uint8_t *)NULL) {
+        job->ret = ENOMEM;
+        return NULL;
+    }
+    while (done < job->length && job->ret == 0) {
+        want = (((job->length - done) > FILESUM_WINDOW) ? FILESUM_WINDOW : (size_t)(job->length - done));
+        for (have = 0x0; have < want; have += (size_t)got) {
+            got = pread(job->fd, buffer + have, want - have, (off_t)(job->offset + done + have));
+            if (got < 0 && errno == EINTR) {
+                got = 0;
+                continue;
+            } else if (got <= 0) {  // A file that shrank mid-read is reported as an I/O error
+                job->ret = ((got < 0) ? errno : EIO);
+                break;
+            }
+        }
+        if (job->ret == 0) filesums_update(&job->sums, buffer, want);
+        done += want;
+    }
+    free(buffer);
+    job->sums.crc32c = crc32c_final(job->sums.crc32c);
+    return NULL;
+}
+#endif
+
+
+/** Open the specified file and compute the checksums selected by `which` (FILESUM_* flags) by splitting it into `num_threads` ranges that are read with `pread()` in parallel and merged with the combine functions; The results equal those of `filechecksums()`; `num_threads` of 0 uses every online CPU; Return 0 on success or an errno value */
+int filechecksums_parallel(const char *__restrict__ filename, const unsigned int which, unsigned int num_threads, filesums *__restrict__ sums) {
+#ifdef OSPOSIX
+    struct stat filestat;
+    filesums_job *jobs;
+    uint64_t windows, per_job, remaining;
+    register unsigned int i, njobs;
+    int ret = 0;
+    if (filename == (const char *)NULL || sums == (filesums *)NULL || (which & FILESUM_ALL) == 0x0) return EINVAL;
+    if (num_threads == 0x0) {
+        const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = ((cpus > 0) ? (unsigned int)cpus : 0x1);
+    }
+    const int fd = open(filename, O_RDONLY);
+    if (fd < 0) return errno;
+    if (fstat(fd, &filestat) != 0x0 || !S_ISREG(filestat.st_mode) || num_threads == 0x1) {  // Pipes and the like cannot be split
+        close(fd);
+        return filechecksums(filename, which, sums);
+    }
+    // Ranges are whole windows, so every range but the last holds whole Fletcher elements
+    windows = (((uint64_t)filestat.st_size + FILESUM_WINDOW - 1) / FILESUM_WINDOW);
+    njobs = (unsigned int)((windows < (uint64_t)num_threads) ? windows : (uint64_t)num_threads);
+    if (njobs == 0x0) njobs = 0x1;
+    per_job = (((windows + njobs - 1) / njobs) * FILESUM_WINDOW);
+    jobs = (filesums_job *)calloc((size_t)njobs, sizeof(filesums_job));
+    if (jobs == (filesums_job *)NULL) {
+        close(fd);
+        return ENOMEM;
+    }
+    remaining = (uint64_t)filestat.st_size;
+    for (i = 0x0; i < njobs; i++) {
+        jobs[i].fd = fd;
+        jobs[i].which = which;
+        jobs[i].offset = ((uint64_t)filestat.st_size - remaining);
+        jobs[i].length = ((remaining > per_job) ? per_job : remaining);
+        remaining -= jobs[i].length;
+    }
+#   ifdef __PTHREAD_ENABLED__
+    pthread_t *threads = (pthread_t *)calloc((size_t)njobs, sizeof(pthread_t));
+    uint8_t *spawned = (uint8_t *)calloc((size_t)njobs, 0x1);
+    if (threads == (pthread_t *)NULL || spawned == (uint8_t *)NULL) {
+        for (i = 0x0; i < njobs; i++) (void)filesums_range(&jobs[i]);
+    } else {
+        for (i = 0x1; i < njobs; i++) {
+            spawned[i] = (uint8_t)(pthread_create(&threads[i], NULL, filesums_range, &jobs[i]) == 0x0);
+            if (!spawned[i]) (void)filesums_range(&jobs[i]);
+        }
+        (void)filesums_range(&jobs[0]);
+        for (i = 0x1; i < njobs; i++) {
+            if (spawned[i]) (void)pthread_join(threads[i], NULL);
+        }
+    }
+    free(threads);
+    free(spawned);
+#   else
+    for (i = 0x0; i < njobs; i++) (void)filesums_range(&jobs[i]);
+#   endif
+    close(fd);
+    // Stitch the ranges together in file order
+    *sums = jobs[0].sums;
+    for (i = 0x0; i < njobs; i++) {
+        if (jobs[i].ret != 0) {
+            ret = jobs[i].ret;
+            break;
+        }
+        if (i != 0x0) filesums_merge(sums, &jobs[i].sums);
+    }
+    free(jobs);
+    return ret;
+#else
+    (void)num_threads;
+    return filechecksums(filename, which, sums);
+#endif
+}
+
+
 /* STRING CONVERSIONS */
 
 
@@ -35,11 +35,43 @@ License along with this library.
 #define FILE_TOOLS_SEEN
 
 
+#include "cryptx.h"  // Checksum kernels used by the file integrity engine; Includes MACROS.h
 #include "MACROS.h"
 
 #ifdef OSPOSIX
+#   include <fcntl.h>  // http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/fcntl.h.html
+#   include <sys/mman.h>  // http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/sys_mman.h.html
 #   include <sys/stat.h>  // http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/sys_stat.h.html
+#   include <unistd.h>  // http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/unistd.h.html
 #endif
+#ifdef __PTHREAD_ENABLED__
+#   include <pthread.h>
+#endif
+
+
+#define FILESUM_CRC32   (0x01)  // `crc32(0x0, ...)` of the file
+#define FILESUM_CRC32C   (0x02)  // `crc32c()` of the file
+#define FILESUM_ADLER32   (0x04)  // `adler32()` of the file
+#define FILESUM_ADLER64   (0x08)  // `adler64()` of the file
+#define FILESUM_FLETCHER16   (0x10)  // `fletcher16()` of the file
+#define FILESUM_FLETCHER32   (0x20)  // `fletcher32()` of the file; An odd final byte is zero-padded to a whole element
+#define FILESUM_FLETCHER64   (0x40)  // `fletcher64()` of the file; A partial final element is zero-padded
+#define FILESUM_PARITY   (0x80)  // Parity of every bit in the file
+#define FILESUM_ALL   (0xFF)
+#define FILESUM_WINDOW   (0x800000)  // Bytes mapped (or read) per step of `filechecksums()`; Bounds its memory use and must be a multiple of the page size
+
+
+/* DATATYPES */
+/** Checksums produced by one pass of `filechecksums()`; Only the members selected by `which` are meaningful */
+typedef struct filesums {
+    uint64_t length;  // Bytes read
+    uint64_t adler64, fletcher64;
+    uint32_t crc32, crc32c, adler32, fletcher32;
+    uint16_t fletcher16;
+    uint8_t parity;
+    uint8_t reserved;  // Keeps `which` 4-byte aligned without implicit padding
+    unsigned int which;  // FILESUM_* flags that were computed
+} filesums;
 
 
 /* STD-STRING AND STD-CTYPES ALTERNATIVES */
@@ -159,6 +191,8 @@ uint16_t filefletcher16fast(const char *__restrict__ filename) __attribute__((fl
 uint32_t filefletcher32(const char *__restrict__ filename) __attribute__((flatten, nonnull));
 uint32_t filefletcher32fast(const char *__restrict__ filename) __attribute__((flatten, nonnull));
 uint32_t filecollier32(const char *__restrict__ filename) __attribute__((flatten, nonnull));
+int filechecksums(const char *__restrict__ filename, const unsigned int which, filesums *__restrict__ sums);
+int filechecksums_parallel(const char *__restrict__ filename, const unsigned int which, unsigned int num_threads, filesums *__restrict__ sums);
 #else
 uint8_t filebitparity64(const char *__restrict__ filename);
 uint16_t fileadler16(const char *__restrict__ filename);
@@ -171,6 +205,8 @@ uint16_t filefletcher16(const char *__restrict__ filename);
 uint32_t filefletcher32(const char *__restrict__ filename);
 uint32_t filefletcher32fast(const char *__restrict__ filename);
 uint32_t filecollier32(const char *__restrict__ filename);
+int filechecksums(const char *__restrict__ filename, const unsigned int which, filesums *__restrict__ sums);
+int filechecksums_parallel(const char *__restrict__ filename, const unsigned int which, unsigned int num_threads, filesums *__restrict__ sums);
 #endif
 /* STRING CONVERSIONS */
 #ifdef __GNUC__
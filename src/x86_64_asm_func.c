@@ -90,9 +90,9 @@ const char *amd_gpu(void) {
 
 /** The rdtsc (Read Time-Stamp Counter) instruction is used to determine how many CPU ticks occurred since the processor was reset */
 ullint rdtsc(void) {
-    register ullint cpu_ticks;
-    __asm__ volatile ("rdtsc;" : "=A" ( cpu_ticks ));  // `=A` is `edx:eax`
-    return cpu_ticks;
+    register uint32_t low, high;
+    __asm__ volatile ("rdtsc;" : "=a" ( low ), "=d" ( high ));  // `=A` only names one of `edx:eax` on x86-64
+    return ((ullint)high << 32 | (ullint)low);
 }
 
 
@@ -125,6 +125,29 @@ setup(
 )
 
 
+setup(
+    name='compression',
+    version=__version__,
+    description='Compression Functions',
+    author=__author__,
+    author_email=__email__,
+    maintainer=__author__,
+    maintainer_email=__email__,
+    url=__url__,
+    license=__copyright__,
+    classifiers=CLASSIFIERS,
+    ext_modules=[Extension(
+        'compression',
+        sources=[SRCDIR + 'pycompression.c', SRCDIR + 'compression.c'],
+        include_dirs=INCLUDE_DIRS,
+        library_dirs=LIBRARY_DIRS,
+        libraries=['z', 'm'],
+        extra_compile_args=COMPILE_ARGS,
+        extra_link_args=LINK_ARGS,
+    )],
+)
+
+
 setup(
     name='geometry',
     version=__version__,
@@ -231,6 +254,7 @@ setup(
         sources=[SRCDIR + 'pytools.c'],
         include_dirs=INCLUDE_DIRS,
         library_dirs=LIBRARY_DIRS,
+        libraries=['tools'],
         extra_compile_args=COMPILE_ARGS,
         extra_link_args=LINK_ARGS,
     )],